@@ -1995,6 +1995,10 @@ SOURCE=.\src\sat\cnf\cnfPost.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\cnf\cnfPre.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\cnf\cnfUtil.c
 # End Source File
 # Begin Source File
@@ -2047,6 +2051,10 @@ SOURCE=.\src\sat\bmc\bmcBmcS.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\bmc\bmcCache.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\bmc\bmcCexCare.c
 # End Source File
 # Begin Source File
@@ -2139,6 +2147,10 @@ SOURCE=.\src\sat\bmc\bmcMulti.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\bmc\bmcPort.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\bmc\bmcUnroll.c
 # End Source File
 # End Group
@@ -2175,6 +2187,14 @@ SOURCE=.\src\sat\satoko\cnf_reader.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\satoko\drat.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\sat\satoko\drat.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\satoko\utils\heap.h
 # End Source File
 # Begin Source File
@@ -2407,6 +2427,10 @@ SOURCE=.\src\sat\glucose2\AbcGlucoseCmd2.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\glucose2\AbcGlucosePort2.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\glucose2\Alg.h
 # End Source File
 # Begin Source File
@@ -3199,6 +3223,10 @@ SOURCE=.\src\opt\sfm\sfmNtk.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\opt\sfm\sfmPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\opt\sfm\sfmSat.c
 # End Source File
 # Begin Source File
@@ -3731,6 +3759,10 @@ SOURCE=.\src\map\scl\sclLiberty.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\map\scl\sclLibCache.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\map\scl\sclLibScl.c
 # End Source File
 # Begin Source File
@@ -3743,6 +3775,10 @@ SOURCE=.\src\map\scl\sclLoad.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\map\scl\sclPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\map\scl\sclSize.c
 # End Source File
 # Begin Source File
@@ -4123,6 +4159,14 @@ SOURCE=.\src\misc\util\utilIsop.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\misc\util\utilMbox.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\misc\util\utilMbox.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\misc\util\utilMem.c
 # End Source File
 # Begin Source File
@@ -4139,6 +4183,18 @@ SOURCE=.\src\misc\util\utilNam.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\misc\util\utilPool.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\misc\util\utilPool.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\misc\util\utilAtomic.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\misc\util\utilSignal.c
 # End Source File
 # Begin Source File
@@ -5039,6 +5095,10 @@ SOURCE=.\src\aig\gia\giaHash.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaHashMt.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaIf.c
 # End Source File
 # Begin Source File
@@ -5259,6 +5319,10 @@ SOURCE=.\src\aig\gia\giaSplit.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaSta.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaStg.c
 # End Source File
 # Begin Source File
@@ -5987,6 +6051,10 @@ SOURCE=.\src\proof\pdr\pdrMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\pdr\pdrPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\pdr\pdrSat.c
 # End Source File
 # Begin Source File
@@ -6003,6 +6071,10 @@ SOURCE=.\src\proof\pdr\pdrTsim3.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\pdr\pdrTsim4.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\pdr\pdrUtil.c
 # End Source File
 # End Group
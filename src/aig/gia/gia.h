@@ -53,6 +53,7 @@ typedef struct Gia_MmFixed_t_        Gia_MmFixed_t;
 typedef struct Gia_MmFlex_t_         Gia_MmFlex_t;     
 typedef struct Gia_MmStep_t_         Gia_MmStep_t;     
 typedef struct Gia_Dat_t_            Gia_Dat_t;
+typedef struct Gia_HashMt_t_         Gia_HashMt_t;
 
 typedef struct Gia_Rpr_t_ Gia_Rpr_t;
 struct Gia_Rpr_t_
@@ -131,8 +132,9 @@ struct Gia_Man_t_
     int            nTerStates;    // the total number of ternary states
     int *          pFanData;      // the database to store fanout information
     int            nFansAlloc;    // the size of fanout representation
-    Vec_Int_t *    vFanoutNums;   // static fanout
-    Vec_Int_t *    vFanout;       // static fanout
+    Vec_Int_t *    vFanoutOffs;   // static fanout: offset and number of fanouts of each object
+    Vec_Int_t *    vFanout;       // static fanout: packed fanout IDs
+    int            nFanoutFree;   // static fanout: unused entries left by incremental updates
     Vec_Int_t *    vMapping;      // mapping for each node
     Vec_Wec_t *    vMapping2;     // mapping for each node
     Vec_Wec_t *    vFanouts2;     // mapping fanouts 
@@ -300,8 +302,12 @@ struct Gia_ParSim_t_
     int            fCheckMiter;   // check if miter outputs are non-zero
     int            fVerbose;      // enables verbose output
     int            iOutFail;      // index of the failed output
+    int            nThreads;      // the number of threads
 };
 
+// simulation callback for the words wStart..wStop-1 of each object
+typedef void (*Gia_SimBlockFunc_t)( void * pArg, int wStart, int wStop );
+
 typedef struct Gia_ManSim_t_ Gia_ManSim_t;
 struct Gia_ManSim_t_
 {
@@ -1095,9 +1101,9 @@ static inline void        Gia_ClassUndoPair( Gia_Man_t * p, int i )          { a
     for ( assert(Gia_ObjIsHead(p, i)), iObj = Gia_ObjNext(p, Start); iObj > 0; iObj = Gia_ObjNext(p, iObj) )
 
 
-static inline int         Gia_ObjFoffsetId( Gia_Man_t * p, int Id )                { return Vec_IntEntry( p->vFanout, Id );                                 }
+static inline int         Gia_ObjFoffsetId( Gia_Man_t * p, int Id )                { return Vec_IntEntry( p->vFanoutOffs, 2*Id );                           }
 static inline int         Gia_ObjFoffset( Gia_Man_t * p, Gia_Obj_t * pObj )        { return Gia_ObjFoffsetId( p, Gia_ObjId(p, pObj) );                      }
-static inline int         Gia_ObjFanoutNumId( Gia_Man_t * p, int Id )              { return Vec_IntEntry( p->vFanoutNums, Id );                             }
+static inline int         Gia_ObjFanoutNumId( Gia_Man_t * p, int Id )              { return Vec_IntEntry( p->vFanoutOffs, 2*Id+1 );                         }
 static inline int         Gia_ObjFanoutNum( Gia_Man_t * p, Gia_Obj_t * pObj )      { return Gia_ObjFanoutNumId( p, Gia_ObjId(p, pObj) );                    }
 static inline int         Gia_ObjFanoutId( Gia_Man_t * p, int Id, int i )          { return Vec_IntEntry( p->vFanout, Gia_ObjFoffsetId(p, Id) + i );        }
 static inline Gia_Obj_t * Gia_ObjFanout0( Gia_Man_t * p, Gia_Obj_t * pObj )        { return Gia_ManObj( p, Gia_ObjFanoutId(p, Gia_ObjId(p, pObj), 0) );     }
@@ -1110,7 +1116,7 @@ static inline void        Gia_ObjSetFanoutInt( Gia_Man_t * p, Gia_Obj_t * pObj,
 #define Gia_ObjForEachFanoutStaticId( p, Id, FanId, i )           \
     for ( i = 0; (i < Gia_ObjFanoutNumId(p, Id)) && ((FanId = Gia_ObjFanoutId(p, Id, i)), 1); i++ )
 #define Gia_ObjForEachFanoutStaticIndex( p, Id, FanId, i, Index ) \
-    for ( i = 0; (i < Gia_ObjFanoutNumId(p, Id)) && (Index = Vec_IntEntry(p->vFanout, Id)+i) && ((FanId = Vec_IntEntry(p->vFanout, Index)), 1); i++ )
+    for ( i = 0; (i < Gia_ObjFanoutNumId(p, Id)) && ((Index = Gia_ObjFoffsetId(p, Id)+i), 1) && ((FanId = Vec_IntEntry(p->vFanout, Index)), 1); i++ )
 
 static inline int         Gia_ManHasMapping( Gia_Man_t * p )                { return p->vMapping != NULL;                                                   }
 static inline int         Gia_ObjIsLut( Gia_Man_t * p, int Id )             { return Vec_IntEntry(p->vMapping, Id) != 0;                                    }
@@ -1249,6 +1255,7 @@ static inline int         Gia_ObjCellId( Gia_Man_t * p, int iLit )          { re
 extern int                 Gia_FileSize( char * pFileName );
 extern Gia_Man_t *         Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck );
 extern Gia_Man_t *         Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck );
+extern Gia_Man_t *         Gia_AigerReadMmap( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck, int fVerbose );
 extern void                Gia_AigerWrite( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine );
 extern void                Gia_DumpAiger( Gia_Man_t * p, char * pFilePrefix, int iFileNum, int nFileNumDigits );
 extern Vec_Str_t *         Gia_AigerWriteIntoMemoryStr( Gia_Man_t * p );
@@ -1442,7 +1449,12 @@ extern void                Gia_ObjRemoveFanout( Gia_Man_t * p, Gia_Obj_t * pObj,
 extern void                Gia_ManFanoutStart( Gia_Man_t * p );
 extern void                Gia_ManFanoutStop( Gia_Man_t * p );
 extern void                Gia_ManStaticFanoutStart( Gia_Man_t * p );
+extern void                Gia_ManStaticFanoutStartMt( Gia_Man_t * p, int nThreads );
 extern void                Gia_ManStaticFanoutStop( Gia_Man_t * p );
+extern void                Gia_ObjAddFanoutStatic( Gia_Man_t * p, int iObj, int iFanout );
+extern void                Gia_ObjRemoveFanoutStatic( Gia_Man_t * p, int iObj, int iFanout );
+extern void                Gia_ManStaticFanoutCompact( Gia_Man_t * p );
+extern int                 Gia_ManStaticFanoutCheck( Gia_Man_t * p );
 extern void                Gia_ManStaticMappingFanoutStart( Gia_Man_t * p, Vec_Int_t ** pvIndex );
 /*=== giaForce.c =========================================================*/
 extern void                For_ManExperiment( Gia_Man_t * pGia, int nIters, int fClustered, int fVerbose );
@@ -1480,6 +1492,15 @@ extern int                 Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia
 extern int                 Gia_ManHashAndMulti( Gia_Man_t * p, Vec_Int_t * vLits );
 extern int                 Gia_ManHashAndMulti2( Gia_Man_t * p, Vec_Int_t * vLits );
 extern int                 Gia_ManHashDualMiter( Gia_Man_t * p, Vec_Int_t * vOuts );
+/*=== giaHashMt.c ===========================================================*/
+extern Gia_HashMt_t *      Gia_ManHashMtStart( Gia_Man_t * p, int nObjsMax );
+extern void                Gia_ManHashMtStop( Gia_HashMt_t * p );
+extern double              Gia_ManHashMtMemory( Gia_HashMt_t * p );
+extern int                 Gia_ManHashMtAnd( Gia_HashMt_t * p, int iLit0, int iLit1 );
+extern int                 Gia_ManHashMtLookup( Gia_HashMt_t * p, int iLit0, int iLit1 );
+extern int                 Gia_ManHashMtOverflow( Gia_HashMt_t * p );
+extern Gia_Man_t *         Gia_ManRehashMt( Gia_Man_t * p, int nProcs );
+extern void                Gia_ManHashMtBench( Gia_Man_t * p, int nProcs );
 /*=== giaIf.c ===========================================================*/
 extern void                Gia_ManPrintMappingStats( Gia_Man_t * p, char * pDumpFile );
 extern void                Gia_ManPrintPackingStats( Gia_Man_t * p );
@@ -1608,8 +1629,18 @@ extern void                Gia_ManIncrSimSet( Gia_Man_t * p, Vec_Int_t * vObjLit
 extern int                 Gia_ManIncrSimCheckOver( Gia_Man_t * p, int iLit0, int iLit1 );
 extern int                 Gia_ManIncrSimCheckEqual( Gia_Man_t * p, int iLit0, int iLit1 );
 /*=== giaSimBase.c ============================================================*/
+extern int                 Gia_ManSimdLevel();
+extern void                Gia_ManSimdSetLevel( int Level );
+extern char *              Gia_ManSimdName();
+extern void                Gia_ManSimdAnd( word * pOut, word * p0, word * p1, word Diff0, word Diff1, int nWords );
+extern void                Gia_ManSimdXor( word * pOut, word * p0, word * p1, word Diff, int nWords );
+extern void                Gia_ManSimdMux( word * pOut, word * pC, word * p1, word * p0, word DiffC, word Diff1, word Diff0, int nWords );
+extern void                Gia_ManSimdCopy( word * pOut, word * p0, word Diff0, int nWords );
+extern int                 Gia_ManSimdEqual( word * p0, word * p1, int nWords );
 extern Vec_Wrd_t *         Gia_ManSimPatSim( Gia_Man_t * p );
 extern Vec_Wrd_t *         Gia_ManSimPatSimOut( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi, int fOuts );
+extern int                 Gia_ManSimBlocksRun( int nWords, int nAlign, int nThreads, Gia_SimBlockFunc_t pFunc, void * pArg );
+extern Vec_Wrd_t *         Gia_ManSimPatSimMt( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi, int nThreads );
 extern void                Gia_ManSim2ArrayOne( Vec_Wrd_t * vSimsPi, Vec_Int_t * vRes );
 extern Vec_Wec_t *         Gia_ManSim2Array( Vec_Ptr_t * vSims );
 extern Vec_Wrd_t *         Gia_ManArray2SimOne( Vec_Int_t * vRes );
@@ -1624,6 +1655,24 @@ extern Gia_Man_t *         Gia_ManSpeedup( Gia_Man_t * p, int Percentage, int De
 /*=== giaSplit.c ============================================================*/
 extern void                Gia_ManComputeOneWinStart( Gia_Man_t * p, int nAnds, int fReverse );
 extern int                 Gia_ManComputeOneWin( Gia_Man_t * p, int iPivot, Vec_Int_t ** pvRoots, Vec_Int_t ** pvNodes, Vec_Int_t ** pvLeaves, Vec_Int_t ** pvAnds );
+/*=== giaSta.c ============================================================*/
+typedef struct Gia_Sta_t_ Gia_Sta_t;
+typedef float (*Gia_StaDelay_f)( void * pUser, int iObj, int iPin, int nPins );
+extern Gia_Sta_t *         Gia_StaStart( Gia_Man_t * pGia, Gia_StaDelay_f pFuncDelay, void * pUser, int fSortPins );
+extern Gia_Sta_t *         Gia_StaStartLut( Gia_Man_t * pGia );
+extern void                Gia_StaStop( Gia_Sta_t * p );
+extern void                Gia_StaSetFanins( Gia_Sta_t * p, int iObj, Vec_Int_t * vFaninsNew );
+extern void                Gia_StaUpdateDelay( Gia_Sta_t * p, int iObj );
+extern void                Gia_StaSetCiArrival( Gia_Sta_t * p, int iObj, float tArr );
+extern float               Gia_StaUpdate( Gia_Sta_t * p );
+extern float               Gia_StaArrival( Gia_Sta_t * p, int iObj );
+extern float               Gia_StaRequired( Gia_Sta_t * p, int iObj );
+extern float               Gia_StaSlack( Gia_Sta_t * p, int iObj );
+extern void                Gia_StaVisitNum( Gia_Sta_t * p, int * pnVisitsA, int * pnVisitsR );
+extern Vec_Int_t *         Gia_StaSlackHistogram( Gia_Sta_t * p, int nSteps );
+extern void                Gia_StaTransferTiming( Gia_Sta_t * p );
+extern int                 Gia_StaVerify( Gia_Sta_t * p );
+extern int                 Gia_StaRandomCheck( Gia_Man_t * pGia, int nChanges );
 /*=== giaStg.c ============================================================*/
 extern void                Gia_ManStgPrint( FILE * pFile, Vec_Int_t * vLines, int nIns, int nOuts, int nStates );
 extern Gia_Man_t *         Gia_ManStgRead( char * pFileName, int kHot, int fVerbose );
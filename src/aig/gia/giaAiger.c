@@ -22,11 +22,18 @@
 #include "gia.h"
 #include "misc/tim/tim.h"
 #include "base/main/main.h"
+#include "misc/util/utilAtomic.h"
+#include "misc/util/utilPool.h"
 
 ABC_NAMESPACE_IMPL_START
 
 #define XAIG_VERBOSE 0
 
+// the side index of the AND section (see Gia_AigerReadIndex)
+#define GIA_AIGER_INDEX_STEP  (1 << 16)                      // the number of AND gates in one chunk
+#define GIA_AIGER_INDEX_MIN   16                             // the smallest number of chunks to write the index
+#define GIA_AIGER_INDEX_LINE  "Index of AND gates at byte "  // followed by 20 decimal digits and a new line
+
 ////////////////////////////////////////////////////////////////////////
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
@@ -162,6 +169,220 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
     return vBinary;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Reads the side index of the AND section.]
+
+  Description [The index is an optional extension written by ABC for large 
+  AIGs. It records the byte offset of every nStep-th AND gate relative to 
+  the beginning of the AND section, which allows for decoding the chunks 
+  in parallel. Since the reader needs the index before the AND section is 
+  decoded, while the extensions follow the AND section and the symbol table,
+  the byte position of the index is stored in a fixed-size line at the end 
+  of the trailing comment. Returns the array of nChunks+1 offsets, or NULL 
+  if the index is absent or does not match the file.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static word * Gia_AigerReadIndex( char * pContents, iword nFileSize, unsigned char * pAnds, int nAnds, int * pnStep, int * pnChunks )
+{
+    int nLine = strlen(GIA_AIGER_INDEX_LINE) + 21;
+    unsigned char * pCur, * pLimit = (unsigned char *)pContents + nFileSize;
+    word * pOffs, Pos = 0;
+    int i, nStep, nChunks;
+    if ( nFileSize < nLine || strncmp( pContents + nFileSize - nLine, GIA_AIGER_INDEX_LINE, strlen(GIA_AIGER_INDEX_LINE) ) )
+        return NULL;
+    for ( pCur = (unsigned char *)pContents + nFileSize - 21; pCur < pLimit - 1; pCur++ )
+        if ( *pCur >= '0' && *pCur <= '9' )
+            Pos = 10 * Pos + (*pCur - '0');
+        else 
+            return NULL;
+    // the index record: 'x', size, step, chunks, and 64-bit offsets as pairs of 32-bit halves
+    if ( Pos < (word)(pAnds - (unsigned char *)pContents) || Pos + 13 > (word)nFileSize || pContents[Pos] != 'x' )
+        return NULL;
+    pCur    = (unsigned char *)pContents + Pos + 1;
+    nStep   = Gia_AigerReadInt( pCur + 4 );
+    nChunks = Gia_AigerReadInt( pCur + 8 );
+    if ( nStep <= 0 || nChunks != (nAnds + nStep - 1) / nStep || Gia_AigerReadInt(pCur) != 8 + 8 * (nChunks + 1) || 
+         pCur + 4 + Gia_AigerReadInt(pCur) > pLimit )
+        return NULL;
+    pCur += 12;
+    pOffs = ABC_ALLOC( word, nChunks + 1 );
+    for ( i = 0; i <= nChunks; i++, pCur += 8 )
+    {
+        pOffs[i] = ((word)(unsigned)Gia_AigerReadInt(pCur) << 32) | (word)(unsigned)Gia_AigerReadInt(pCur + 4);
+        if ( (i == 0 && pOffs[i] != 0) || (i > 0 && pOffs[i] <= pOffs[i-1]) || pAnds + pOffs[i] > pLimit )
+        {
+            ABC_FREE( pOffs );
+            return NULL;
+        }
+    }
+    *pnStep = nStep;
+    *pnChunks = nChunks;
+    return pOffs;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Decodes the AND section directly into the object array.]
+
+  Description [Succeeds if reading the AND gates one by one would append 
+  each of them as a new object, that is, if AIGER variables can be used as 
+  object IDs without remapping. This is true when no AND gate is simplified 
+  by constant propagation or trivial rules and, if structural hashing is 
+  requested, when there are no structural duplicates. In this case, the 
+  fanins are written into the pre-allocated objects and the strashing is 
+  skipped. Since the objects do not depend on each other, the chunks listed
+  in the side index are decoded in parallel, and so is the duplicate check,
+  whose hash table is split into disjoint parts owned by different threads.
+  Otherwise, returns 0 and leaves the manager unchanged.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_AigerReadNode( Vec_Int_t * vNodes, int iVar )
+{
+    return vNodes ? Vec_IntEntry(vNodes, iVar) : Abc_Var2Lit(iVar, 0);
+}
+static int Gia_AigerDecodeAnds( Gia_Obj_t * pObjs, unsigned char ** ppCur, int iStart, int iStop, int fKeepConst )
+{
+    unsigned uLit0, uLit1, uLit;
+    int iObj;
+    for ( iObj = iStart; iObj < iStop; iObj++ )
+    {
+        Gia_Obj_t * pObj = pObjs + iObj;
+        uLit  = ((unsigned)iObj << 1);
+        uLit1 = uLit  - Gia_AigerReadUnsigned( ppCur );
+        uLit0 = uLit1 - Gia_AigerReadUnsigned( ppCur );
+        if ( uLit1 >= uLit || uLit0 > uLit1 || (uLit0 >> 1) == (uLit1 >> 1) || (!fKeepConst && uLit0 < 2) )
+            return 0;
+        pObj->iDiff0  = iObj - (uLit0 >> 1);
+        pObj->fCompl0 = uLit0 & 1;
+        pObj->iDiff1  = iObj - (uLit1 >> 1);
+        pObj->fCompl1 = uLit1 & 1;
+    }
+    return 1;
+}
+
+typedef struct Gia_AigerDec_t_ Gia_AigerDec_t;
+struct Gia_AigerDec_t_
+{
+    Gia_Man_t *      p;
+    unsigned char *  pAnds;      // the beginning of the AND section
+    word *           pOffs;      // chunk offsets from the side index
+    int              iFirst;     // the first AND gate
+    int              nAnds;      // the number of AND gates
+    int              nStep;      // the number of AND gates in one chunk
+    int              fKeepConst; // keeps AND gates with constant fanins
+    word *           pTable;     // the hash table of fanin pairs
+    int              nBits;      // the table has 2^nBits entries
+    int              nPartBits;  // the table is split into 2^nPartBits parts
+    volatile int     fFailed;    // set when a chunk cannot be decoded directly or a duplicate is found
+};
+static void Gia_AigerDecodeChunks( void * pArg, int kStart, int kStop )
+{
+    Gia_AigerDec_t * p = (Gia_AigerDec_t *)pArg;
+    int k;
+    for ( k = kStart; k < kStop && !Abc_AtomicLoadInt(&p->fFailed); k++ )
+    {
+        unsigned char * pCur = p->pAnds + p->pOffs[k];
+        int iStart = p->iFirst + k * p->nStep;
+        int iStop  = Abc_MinInt( iStart + p->nStep, p->iFirst + p->nAnds );
+        if ( !Gia_AigerDecodeAnds( p->p->pObjs, &pCur, iStart, iStop, p->fKeepConst ) || pCur != p->pAnds + p->pOffs[k+1] )
+            Abc_AtomicStoreInt( &p->fFailed, 1 );
+    }
+}
+static void Gia_AigerFindDupAnds( void * pArg, int iPartStart, int iPartStop )
+{
+    // the table stores fanin literal pairs rather than object IDs to avoid 
+    // touching the objects while probing; zero is never a valid pair here;
+    // the slots of a batch of objects are prefetched before probing
+    Gia_AigerDec_t * p = (Gia_AigerDec_t *)pArg;
+    int nPartBits = p->nBits - p->nPartBits;
+    word Mask = ((word)1 << nPartBits) - 1, Hash, Pairs[64], Keys[64];
+    int i, k, nBatch, iPart, iStop = p->iFirst + p->nAnds;
+    for ( iPart = iPartStart; iPart < iPartStop; iPart++ )
+    {
+        word * pTable = p->pTable + ((word)iPart << nPartBits);
+        for ( i = p->iFirst; i < iStop && !Abc_AtomicLoadInt(&p->fFailed); i += 64 )
+        {
+            for ( nBatch = k = 0; k < 64 && i + k < iStop; k++ )
+            {
+                Gia_Obj_t * pObj = Gia_ManObj( p->p, i + k );
+                word Pair = ((word)Gia_ObjFaninLit0(pObj, i + k) << 32) | (word)Gia_ObjFaninLit1(pObj, i + k);
+                Hash = (Pair * ABC_CONST(0x9E3779B97F4A7C15)) >> (64 - p->nBits);
+                if ( (int)(Hash >> nPartBits) != iPart )
+                    continue;
+                Pairs[nBatch] = Pair;
+                Keys[nBatch]  = Hash & Mask;
+#if defined(__GNUC__)
+                __builtin_prefetch( pTable + Keys[nBatch] );
+#endif
+                nBatch++;
+            }
+            for ( k = 0; k < nBatch; k++ )
+            {
+                for ( Hash = Keys[k]; pTable[Hash]; Hash = (Hash + 1) & Mask )
+                    if ( pTable[Hash] == Pairs[k] )
+                    {
+                        Abc_AtomicStoreInt( &p->fFailed, 1 );
+                        return;
+                    }
+                pTable[Hash] = Pairs[k];
+            }
+        }
+    }
+}
+static int Gia_AigerReadAndsDirect( Gia_Man_t * p, unsigned char ** ppCur, int nAnds, int fGiaSimple, int fSkipStrash, word ** ppOffs, int nStep, int nThreads )
+{
+    Gia_AigerDec_t Dec, * pDec = &Dec;
+    assert( p->nObjsAlloc >= p->nObjs + nAnds );
+    memset( pDec, 0, sizeof(Gia_AigerDec_t) );
+    pDec->p          = p;
+    pDec->pAnds      = *ppCur;
+    pDec->pOffs      = *ppOffs;
+    pDec->iFirst     = p->nObjs;
+    pDec->nAnds      = nAnds;
+    pDec->nStep      = nStep;
+    // without strashing, AND gates with constant fanins are kept as they are
+    pDec->fKeepConst = !fGiaSimple && fSkipStrash;
+    if ( *ppOffs && nThreads > 1 )
+    {
+        Gia_ManSimBlocksRun( (nAnds + nStep - 1) / nStep, 1, nThreads, Gia_AigerDecodeChunks, pDec );
+        *ppCur = pDec->pAnds + (*ppOffs)[(nAnds + nStep - 1) / nStep];
+        if ( pDec->fFailed ) // retry without the index in case it is stale
+        {
+            memset( p->pObjs + pDec->iFirst, 0, sizeof(Gia_Obj_t) * (size_t)nAnds );
+            *ppCur = pDec->pAnds;
+            pDec->fFailed = 0;
+            ABC_FREE( *ppOffs );
+        }
+    }
+    if ( !*ppOffs && !Gia_AigerDecodeAnds( p->pObjs, ppCur, pDec->iFirst, pDec->iFirst + nAnds, pDec->fKeepConst ) )
+        pDec->fFailed = 1;
+    p->nObjs += nAnds;
+    if ( !pDec->fFailed && !fGiaSimple && !fSkipStrash )
+    {
+        // each part of the table is filled by one thread
+        pDec->nBits     = Abc_MaxInt( 4, Abc_Base2Log(nAnds) + 1 );
+        pDec->nPartBits = Abc_MinInt( Abc_Base2Log(nThreads), pDec->nBits - 4 );
+        pDec->pTable    = ABC_CALLOC( word, (word)1 << pDec->nBits );
+        Gia_ManSimBlocksRun( 1 << pDec->nPartBits, 1, nThreads, Gia_AigerFindDupAnds, pDec );
+        ABC_FREE( pDec->pTable );
+    }
+    if ( !pDec->fFailed )
+        return 1;
+    memset( p->pObjs + pDec->iFirst, 0, sizeof(Gia_Obj_t) * (size_t)nAnds );
+    p->nObjs = pDec->iFirst;
+    *ppCur = pDec->pAnds;
+    return 0;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Reads the AIG in the binary AIGER format.]
@@ -173,17 +394,20 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+static Gia_Man_t * Gia_AigerReadFromMemoryInt( char * pContents, iword nFileSize, int fGiaSimple, int fSkipStrash, int fCheck, int fVerbose )
 {
     Gia_Man_t * pNew, * pTemp;
     Vec_Ptr_t * vNamesIn = NULL, * vNamesOut = NULL, * vNamesRegIn = NULL, * vNamesRegOut = NULL, * vNamesNode = NULL;
     Vec_Int_t * vLits = NULL, * vPoTypes = NULL;
     Vec_Int_t * vNodes, * vDrivers, * vInits = NULL;
-    int iObj, iNode0, iNode1, fHieOnly = 0;
+    int iNode0, iNode1, fHieOnly = 0;
     int nTotal, nInputs, nOutputs, nLatches, nAnds, i;
     int nBad = 0, nConstr = 0, nJust = 0, nFair = 0;
-    unsigned char * pDrivers, * pSymbols, * pCur;
+    unsigned char * pDrivers, * pSymbols, * pAnds, * pCur;
     unsigned uLit0, uLit1, uLit;
+    word * pOffs = NULL;
+    int nStep = 0, nChunks = 0, nThreads = 1;
+    abctime clk = Abc_Clock();
 
     // read the parameters (M I L O A + B C J F)
     pCur = (unsigned char *)pContents;         while ( *pCur != ' ' ) pCur++; pCur++;
@@ -258,16 +482,9 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     pNew->nConstrs = nConstr;
     pNew->fGiaSimple = fGiaSimple;
 
-    // prepare the array of nodes
-    vNodes = Vec_IntAlloc( 1 + nTotal );
-    Vec_IntPush( vNodes, 0 );
-
     // create the PIs
     for ( i = 0; i < nInputs + nLatches; i++ )
-    {
-        iObj = Gia_ManAppendCi(pNew);    
-        Vec_IntPush( vNodes, iObj );
-    }
+        Gia_ManAppendCi( pNew );
 
     // remember the beginning of latch/PO literals
     pDrivers = pCur;
@@ -284,29 +501,53 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     }
 
     // create the AND gates
-    if ( !fGiaSimple && !fSkipStrash )
-        Gia_ManHashAlloc( pNew );
-    for ( i = 0; i < nAnds; i++ )
+    pAnds = pCur;
+    if ( nAnds >= GIA_AIGER_INDEX_STEP * GIA_AIGER_INDEX_MIN )
+        nThreads = Abc_PoolThreadNum();
+    if ( nThreads > 1 )
+        pOffs = Gia_AigerReadIndex( pContents, nFileSize, pAnds, nAnds, &nStep, &nChunks );
+    if ( Gia_AigerReadAndsDirect( pNew, &pCur, nAnds, fGiaSimple, fSkipStrash, &pOffs, nStep, nThreads ) )
+        vNodes = NULL;
+    else
     {
-        uLit = ((i + 1 + nInputs + nLatches) << 1);
-        uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
-        uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
-//        assert( uLit1 > uLit0 );
-        iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), uLit0 & 1 );
-        iNode1 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit1 >> 1), uLit1 & 1 );
-        assert( Vec_IntSize(vNodes) == i + 1 + nInputs + nLatches );
-        if ( !fGiaSimple && fSkipStrash )
+        // prepare the array of nodes
+        pCur = pAnds;
+        vNodes = Vec_IntAlloc( 1 + nTotal );
+        for ( i = 0; i < 1 + nInputs + nLatches; i++ )
+            Vec_IntPush( vNodes, Abc_Var2Lit(i, 0) );
+        if ( !fGiaSimple && !fSkipStrash )
+            Gia_ManHashAlloc( pNew );
+        for ( i = 0; i < nAnds; i++ )
         {
-            if ( iNode0 == iNode1 )
-                Vec_IntPush( vNodes, Gia_ManAppendBuf(pNew, iNode0) );
+            uLit = ((i + 1 + nInputs + nLatches) << 1);
+            uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
+            uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+//            assert( uLit1 > uLit0 );
+            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), uLit0 & 1 );
+            iNode1 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit1 >> 1), uLit1 & 1 );
+            assert( Vec_IntSize(vNodes) == i + 1 + nInputs + nLatches );
+            if ( !fGiaSimple && fSkipStrash )
+            {
+                if ( iNode0 == iNode1 )
+                    Vec_IntPush( vNodes, Gia_ManAppendBuf(pNew, iNode0) );
+                else
+                    Vec_IntPush( vNodes, Gia_ManAppendAnd(pNew, iNode0, iNode1) );
+            }
             else
-                Vec_IntPush( vNodes, Gia_ManAppendAnd(pNew, iNode0, iNode1) );
+                Vec_IntPush( vNodes, Gia_ManHashAnd(pNew, iNode0, iNode1) );
         }
-        else
-            Vec_IntPush( vNodes, Gia_ManHashAnd(pNew, iNode0, iNode1) );
+        if ( !fGiaSimple && !fSkipStrash )
+            Gia_ManHashStop( pNew );
     }
-    if ( !fGiaSimple && !fSkipStrash )
-        Gia_ManHashStop( pNew );
+    if ( fVerbose )
+    {
+        printf( "Decoded %d AND gates %s", nAnds, vNodes ? "with remapping" : "directly (no strashing needed)" );
+        if ( pOffs )
+            printf( " using %d threads and side index with %d chunks", nThreads, nChunks );
+        printf( ".  " );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    ABC_FREE( pOffs );
 
     // remember the place where symbols begin
     pSymbols = pCur;
@@ -333,14 +574,14 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
                 pCur++;
                 Vec_IntPush( vInits, 0 );
             }
-            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), (uLit0 & 1) );
+            iNode0 = Abc_LitNotCond( Gia_AigerReadNode(vNodes, uLit0 >> 1), (uLit0 & 1) );
             Vec_IntPush( vDrivers, iNode0 );
         }
         // read the PO driver literals
         for ( i = 0; i < nOutputs; i++ )
         {
             uLit0 = atoi( (char *)pCur );   while ( *pCur++ != '\n' );
-            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), (uLit0 & 1) );
+            iNode0 = Abc_LitNotCond( Gia_AigerReadNode(vNodes, uLit0 >> 1), (uLit0 & 1) );
             Vec_IntPush( vDrivers, iNode0 );
         }
 
@@ -351,14 +592,14 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
         for ( i = 0; i < nLatches; i++ )
         {
             uLit0 = Vec_IntEntry( vLits, i );
-            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), (uLit0 & 1) );
+            iNode0 = Abc_LitNotCond( Gia_AigerReadNode(vNodes, uLit0 >> 1), (uLit0 & 1) );
             Vec_IntPush( vDrivers, iNode0 );
         }
         // read the PO driver literals
         for ( i = 0; i < nOutputs; i++ )
         {
             uLit0 = Vec_IntEntry( vLits, i+nLatches );
-            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), (uLit0 & 1) );
+            iNode0 = Abc_LitNotCond( Gia_AigerReadNode(vNodes, uLit0 >> 1), (uLit0 & 1) );
             Vec_IntPush( vDrivers, iNode0 );
         }
         Vec_IntFree( vLits );
@@ -870,12 +1111,18 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
                     printf( "Cannot read extension \"w\" because AIG is rehashed. Use \"&r -s <file.aig>\".\n" );
                 Vec_IntFree( vPairs );
             }
+            // skip the side index of the AND section (used before decoding)
+            else if ( *pCur == 'x' )
+            {
+                pCur++;
+                pCur += 4 + Gia_AigerReadInt(pCur);
+            }
             else break;
         }
     }
 
     // skipping the comments
-    Vec_IntFree( vNodes );
+    Vec_IntFreeP( &vNodes );
 
     // update polarity of the additional outputs
     if ( nBad || nConstr || nJust || nFair )
@@ -1000,6 +1247,11 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     return pNew;
 }
 
+Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadFromMemoryInt( pContents, (iword)nFileSize, fGiaSimple, fSkipStrash, fCheck, 0 );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Reads the AIG in the binary AIGER format.]
@@ -1011,11 +1263,21 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
   SeeAlso     []
 
 ***********************************************************************/
+static void Gia_AigerReadSetName( Gia_Man_t * pNew, char * pFileName )
+{
+    char * pName;
+    ABC_FREE( pNew->pName );
+    pName = Gia_FileNameGeneric( pFileName );
+    pNew->pName = Abc_UtilStrsav( pName );
+    ABC_FREE( pName );
+    assert( pNew->pSpec == NULL );
+    pNew->pSpec = Abc_UtilStrsav( pFileName );
+}
 Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck )
 {
     FILE * pFile;
     Gia_Man_t * pNew;
-    char * pName, * pContents;
+    char * pContents;
     int nFileSize;
     int RetValue;
 
@@ -1030,14 +1292,51 @@ Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, in
     pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
     ABC_FREE( pContents );
     if ( pNew )
-    {
-        ABC_FREE( pNew->pName );
-        pName = Gia_FileNameGeneric( pFileName );
-        pNew->pName = Abc_UtilStrsav( pName );
-        ABC_FREE( pName );
+        Gia_AigerReadSetName( pNew, pFileName );
+    return pNew;
+}
 
-        assert( pNew->pSpec == NULL );
-        pNew->pSpec = Abc_UtilStrsav( pFileName );
+/**Function*************************************************************
+
+  Synopsis    [Reads the AIG in the binary AIGER format using mmap().]
+
+  Description [Maps the file into memory instead of copying it into a heap 
+  buffer, which avoids holding two copies of a large AIG during reading and 
+  supports files larger than 2GB. The pages are mapped copy-on-write since 
+  the parser terminates the symbol names in place. Falls back to the regular 
+  reader if the file cannot be mapped.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_AigerReadMmap( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck, int fVerbose )
+{
+    Gia_Man_t * pNew;
+    char * pContents;
+    iword nFileSize;
+    abctime clk = Abc_Clock(), clkMap;
+    Gia_FileFixName( pFileName );
+    pContents = Abc_FileMap( pFileName, &nFileSize );
+    if ( pContents == NULL )
+    {
+        if ( fVerbose )
+            printf( "Cannot map file \"%s\" into memory. Using the regular reader.\n", pFileName );
+        return Gia_AigerRead( pFileName, fGiaSimple, fSkipStrash, fCheck );
+    }
+    clkMap = Abc_Clock() - clk;
+    pNew = Gia_AigerReadFromMemoryInt( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck, fVerbose );
+    Abc_FileUnmap( pContents, nFileSize );
+    if ( pNew )
+        Gia_AigerReadSetName( pNew, pFileName );
+    if ( fVerbose )
+    {
+        abctime clkTotal = Abc_Clock() - clk;
+        printf( "Mapped %.2f MB.  ", 1.0*nFileSize/(1<<20) );
+        Abc_PrintTime( 1, "Map time", clkMap );
+        printf( "Read %.2f MB/sec.  ", clkTotal ? 1.0*nFileSize/(1<<20)/(1.0*clkTotal/CLOCKS_PER_SEC) : 0.0 );
+        Abc_PrintTime( 1, "Total time", clkTotal );
     }
     return pNew;
 }
@@ -1221,7 +1520,9 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
     Gia_Man_t * p;
     Gia_Obj_t * pObj;
     Vec_Str_t * vStrExt;
-    int i, nBufferSize, Pos;
+    Vec_Wrd_t * vOffs = NULL;
+    iword IndexPos = -1;
+    int i, k, nBufferSize, Pos;
     unsigned char * pBuffer;
     unsigned uLit0, uLit1, uLit;
     assert( pInit->nXors == 0 && pInit->nMuxes == 0 );
@@ -1290,8 +1591,13 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
     Pos = 0;
     nBufferSize = 8 * Gia_ManAndNum(p) + 100; // skeptically assuming 3 chars per one AIG edge
     pBuffer = ABC_ALLOC( unsigned char, nBufferSize );
+    if ( Gia_ManAndNum(p) >= GIA_AIGER_INDEX_STEP * GIA_AIGER_INDEX_MIN )
+        vOffs = Vec_WrdAlloc( Gia_ManAndNum(p) / GIA_AIGER_INDEX_STEP + 2 );
+    k = 0;
     Gia_ManForEachAnd( p, pObj, i )
     {
+        if ( vOffs && k++ % GIA_AIGER_INDEX_STEP == 0 )
+            Vec_WrdPush( vOffs, (word)Pos );
         uLit  = Abc_Var2Lit( i, 0 );
         uLit0 = Gia_ObjFaninLit0( pObj, i );
         uLit1 = Gia_ObjFaninLit1( pObj, i );
@@ -1304,10 +1610,13 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
             fclose( pFile );
             if ( p != pInit )
                 Gia_ManStop( p );
+            Vec_WrdFreeP( &vOffs );
             return;
         }
     }
     assert( Pos < nBufferSize );
+    if ( vOffs )
+        Vec_WrdPush( vOffs, (word)Pos );
 
     // write the buffer
     fwrite( pBuffer, 1, Pos, pFile );
@@ -1551,11 +1860,31 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         fwrite( p->pName, 1, strlen(p->pName), pFile );
         fprintf( pFile, "%c", '\0' );
     }
+    // write the side index of the AND section; it goes last because 
+    // earlier readers stop at an unknown extension
+    if ( vOffs )
+    {
+        word Offset;
+        IndexPos = (iword)ftell( pFile );
+        fprintf( pFile, "x" );
+        Gia_FileWriteBufferSize( pFile, 8 + 8 * Vec_WrdSize(vOffs) );
+        Gia_FileWriteBufferSize( pFile, GIA_AIGER_INDEX_STEP );
+        Gia_FileWriteBufferSize( pFile, Vec_WrdSize(vOffs) - 1 );
+        Vec_WrdForEachEntry( vOffs, Offset, i )
+        {
+            Gia_FileWriteBufferSize( pFile, (int)(Offset >> 32) );
+            Gia_FileWriteBufferSize( pFile, (int)(Offset & 0xFFFFFFFF) );
+        }
+        Vec_WrdFree( vOffs );
+    }
     // write comments
     if ( fWriteNewLine )
         fprintf( pFile, "c\n" );
     fprintf( pFile, "\nThis file was produced by the GIA package in ABC on %s\n", Gia_TimeStamp() );
     fprintf( pFile, "For information about AIGER format, refer to %s\n", "http://fmv.jku.at/aiger" );
+    // the position of the index is the last line of the file
+    if ( IndexPos >= 0 )
+        fprintf( pFile, "%s%020llu\n", GIA_AIGER_INDEX_LINE, (unsigned long long)IndexPos );
     fclose( pFile );
     if ( p != pInit )
     {
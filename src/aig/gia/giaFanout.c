@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "gia.h"
+#include "misc/util/utilPool.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -199,125 +200,148 @@ void Gia_ObjRemoveFanout( Gia_Man_t * p, Gia_Obj_t * pObj, Gia_Obj_t * pFanout )
 
 /**Function*************************************************************
 
-  Synopsis    [Compute the map of all edges.]
+  Synopsis    [Converts fanout counts into the end offsets of fanout lists.]
 
-  Description []
+  Description [The static fanout is a CSR index: vFanoutOffs stores the
+  offset and the number of fanouts of each object next to each other,
+  while vFanout stores all fanout IDs packed in the order of objects.
+  On entry, entry 2*i+1 of pOffs is the fanout count of object i; on
+  exit, entry 2*i is the offset where the fanout list of object i ends.
+  For large graphs, the prefix sum is computed in blocks by several
+  threads. Returns the total number of fanouts.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Vec_Int_t * Gia_ManStartFanoutMap( Gia_Man_t * p, Vec_Int_t * vFanoutNums )
+#define GIA_FAN_BLOCK_MIN  (1 << 16)   // the smallest number of objects in a parallel block
+
+typedef struct Gia_FanScan_t_ Gia_FanScan_t;
+struct Gia_FanScan_t_
 {
-    Vec_Int_t * vEdgeMap;
-    Gia_Obj_t * pObj;
-    int i, iOffset;
-    iOffset  = Gia_ManObjNum(p);
-    vEdgeMap = Vec_IntStart( iOffset + Gia_ManMuxNum(p) + 2 * Gia_ManAndNum(p) + Gia_ManCoNum(p) - Gia_ManBufNum(p) );
-    Gia_ManForEachObj( p, pObj, i )
+    int *          pOffs;        // offsets and counts
+    int            iStart;       // first object of the block
+    int            iStop;        // last object of the block plus one
+    int            Sum;          // the number of fanouts before or inside the block
+};
+static void * Gia_ManFanoutScanSum( void * pArg )
+{
+    Gia_FanScan_t * p = (Gia_FanScan_t *)pArg;
+    int i, Sum = 0;
+    for ( i = p->iStart; i < p->iStop; i++ )
+        Sum += p->pOffs[2*i+1];
+    p->Sum = Sum;
+    return NULL;
+}
+static void * Gia_ManFanoutScanSet( void * pArg )
+{
+    Gia_FanScan_t * p = (Gia_FanScan_t *)pArg;
+    int i, Sum = p->Sum;
+    for ( i = p->iStart; i < p->iStop; i++ )
+        p->pOffs[2*i] = (Sum += p->pOffs[2*i+1]);
+    return NULL;
+}
+static int Gia_ManFanoutScan( int * pOffs, int nObjs, int nThreads )
+{
+    Gia_FanScan_t pBlocks[ABC_POOL_THR_MAX];
+    Abc_Task_t * pTasks[ABC_POOL_THR_MAX];
+    int b, Sum = 0, nBlocks = Abc_MinInt( Abc_MinInt(nThreads, nObjs / GIA_FAN_BLOCK_MIN), ABC_POOL_THR_MAX );
+    if ( nBlocks <= 1 )
+    {
+        Gia_FanScan_t Block = { pOffs, 0, nObjs, 0 };
+        Gia_ManFanoutScanSet( &Block );
+        return nObjs ? pOffs[2*(nObjs-1)] : 0;
+    }
+    for ( b = 0; b < nBlocks; b++ )
     {
-        Vec_IntWriteEntry( vEdgeMap, i, iOffset );
-        iOffset += Vec_IntEntry( vFanoutNums, Gia_ObjId(p, pObj) );
+        pBlocks[b].pOffs  = pOffs;
+        pBlocks[b].iStart = (int)((word)nObjs * b / nBlocks);
+        pBlocks[b].iStop  = (int)((word)nObjs * (b+1) / nBlocks);
     }
-    assert( iOffset <= Vec_IntSize(vEdgeMap) );
-    return vEdgeMap;
+    // count fanouts in each block
+    for ( b = 0; b < nBlocks; b++ )
+        pTasks[b] = Abc_TaskStart( Abc_PoolGlobal(), Gia_ManFanoutScanSum, pBlocks + b );
+    for ( b = 0; b < nBlocks; b++ )
+        Abc_TaskWait( pTasks[b] ), Abc_TaskFree( pTasks[b] );
+    // derive the starting sum of each block
+    for ( b = 0; b < nBlocks; b++ )
+    {
+        int Temp = pBlocks[b].Sum;
+        pBlocks[b].Sum = Sum;
+        Sum += Temp;
+    }
+    // assign offsets in each block
+    for ( b = 0; b < nBlocks; b++ )
+        pTasks[b] = Abc_TaskStart( Abc_PoolGlobal(), Gia_ManFanoutScanSet, pBlocks + b );
+    for ( b = 0; b < nBlocks; b++ )
+        Abc_TaskWait( pTasks[b] ), Abc_TaskFree( pTasks[b] );
+    return Sum;
 }
 
 /**Function*************************************************************
 
   Synopsis    [Allocates static fanout.]
 
-  Description []
+  Description [Counts the fanouts, computes the offsets, and fills in
+  the fanout lists by visiting the objects in the reverse order while
+  moving the end offsets back to the beginning of each list. This way
+  the fanouts of each object are listed in the increasing order of IDs
+  and no additional memory is needed.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_ManStaticFanoutStart( Gia_Man_t * p )
+void Gia_ManStaticFanoutStartMt( Gia_Man_t * p, int nThreads )
 {
-    Vec_Int_t * vCounts;
-    int * pRefsOld;
-    Gia_Obj_t * pObj, * pFanin;
-    int i, iFanout;
-    assert( p->vFanoutNums == NULL );
+    Gia_Obj_t * pObj;
+    int i, * pOffs, * pFans, nFans;
+    assert( p->vFanoutOffs == NULL );
     assert( p->vFanout == NULL );
-    // recompute reference counters
-    pRefsOld = p->pRefs; p->pRefs = NULL;
-    Gia_ManCreateRefs(p);
-    p->vFanoutNums = Vec_IntAllocArray( p->pRefs, Gia_ManObjNum(p) );
-    p->pRefs = pRefsOld;
-    // start the fanout maps
-    p->vFanout = Gia_ManStartFanoutMap( p, p->vFanoutNums );
-    // incrementally add fanouts
-    vCounts = Vec_IntStart( Gia_ManObjNum(p) );
+    // count the fanouts
+    p->vFanoutOffs = Vec_IntStart( 2 * Gia_ManObjNum(p) );
+    pOffs = Vec_IntArray( p->vFanoutOffs );
     Gia_ManForEachObj( p, pObj, i )
     {
         if ( Gia_ObjIsAnd(pObj) || Gia_ObjIsCo(pObj) )
-        {
-            pFanin = Gia_ObjFanin0(pObj);
-            iFanout = Vec_IntEntry( vCounts, Gia_ObjId(p, pFanin) );
-            Gia_ObjSetFanout( p, pFanin, iFanout, pObj );
-            Vec_IntAddToEntry( vCounts, Gia_ObjId(p, pFanin), 1 );
-        }
+            pOffs[2*Gia_ObjFaninId0(pObj, i)+1]++;
         if ( Gia_ObjIsAnd(pObj) && !Gia_ObjIsBuf(pObj) )
-        {
-            pFanin = Gia_ObjFanin1(pObj);
-            iFanout = Vec_IntEntry( vCounts, Gia_ObjId(p, pFanin) );
-            Gia_ObjSetFanout( p, pFanin, iFanout, pObj );
-            Vec_IntAddToEntry( vCounts, Gia_ObjId(p, pFanin), 1 );
-        }
-        if ( Gia_ObjIsMux(p, pObj) )
-        {
-
-            pFanin = Gia_ObjFanin2(p, pObj);
-            iFanout = Vec_IntEntry( vCounts, Gia_ObjId(p, pFanin) );
-            Gia_ObjSetFanout( p, pFanin, iFanout, pObj );
-            Vec_IntAddToEntry( vCounts, Gia_ObjId(p, pFanin), 1 );
-        }
+            pOffs[2*Gia_ObjFaninId1(pObj, i)+1]++;
+        if ( Gia_ObjIsMuxId(p, i) )
+            pOffs[2*Gia_ObjFaninId2(p, i)+1]++;
     }
-    // double-check the current number of fanouts added
-    Gia_ManForEachObj( p, pObj, i )
-        assert( Vec_IntEntry(vCounts, i) == Gia_ObjFanoutNum(p, pObj) );
-    Vec_IntFree( vCounts );
-}
-
-
-/**Function*************************************************************
-
-  Synopsis    [Compute the map of all edges.]
-
-  Description []
-               
-  SideEffects []
-
-  SeeAlso     []
-
-***********************************************************************/
-Vec_Int_t * Gia_ManStartMappingFanoutMap( Gia_Man_t * p, Vec_Int_t * vFanoutNums )
-{
-    Gia_Obj_t * pObj;
-    int i, iOffset = Gia_ManObjNum(p);
-    Vec_Int_t * vEdgeMap = Vec_IntAlloc( 2 * iOffset );
-    Vec_IntFill( vEdgeMap, iOffset, 0 );
-    Gia_ManForEachObj( p, pObj, i )
+    // compute the end of each fanout list
+    nFans = Gia_ManFanoutScan( pOffs, Gia_ManObjNum(p), nThreads );
+    // fill in the fanout lists
+    p->vFanout = Vec_IntStart( nFans );
+    pFans = Vec_IntArray( p->vFanout );
+    for ( i = Gia_ManObjNum(p) - 1; i > 0; i-- )
     {
-        if ( Vec_IntEntry(vFanoutNums, i) == 0 )
-            continue;
-        Vec_IntWriteEntry( vEdgeMap, i, iOffset );
-        iOffset += Vec_IntEntry( vFanoutNums, i );
-        Vec_IntFillExtra( vEdgeMap, iOffset, 0 );
+        pObj = Gia_ManObj( p, i );
+        if ( Gia_ObjIsMuxId(p, i) )
+            pFans[--pOffs[2*Gia_ObjFaninId2(p, i)]] = i;
+        if ( Gia_ObjIsAnd(pObj) && !Gia_ObjIsBuf(pObj) )
+            pFans[--pOffs[2*Gia_ObjFaninId1(pObj, i)]] = i;
+        if ( Gia_ObjIsAnd(pObj) || Gia_ObjIsCo(pObj) )
+            pFans[--pOffs[2*Gia_ObjFaninId0(pObj, i)]] = i;
     }
-    //printf( "Fanout map is %.2fx larger than AIG manager.\n", 1.0*Vec_IntSize(vEdgeMap)/Gia_ManObjNum(p) );
-    return vEdgeMap;
+    p->nFanoutFree = 0;
+}
+void Gia_ManStaticFanoutStart( Gia_Man_t * p )
+{
+    int nThreads = Gia_ManObjNum(p) >= 16 * GIA_FAN_BLOCK_MIN ? Abc_PoolThreadNum() : 1;
+    Gia_ManStaticFanoutStartMt( p, nThreads );
 }
 
 /**Function*************************************************************
 
-  Synopsis    [Allocates static fanout.]
+  Synopsis    [Allocates static fanout of the mapping.]
 
-  Description []
+  Description [Uses the mapping in p->vMapping if present, and otherwise
+  the mapping in p->vMapping2. The index of the fanin in p->vMapping can
+  only be returned for the former.]
                
   SideEffects []
 
@@ -334,49 +358,61 @@ void Gia_ObjCheckDupMappingFanins( Gia_Man_t * p, int iObj )
 }
 void Gia_ManStaticMappingFanoutStart( Gia_Man_t * p, Vec_Int_t ** pvIndex )
 {
-    Vec_Int_t * vCounts;
-    int * pRefsOld;
-    Gia_Obj_t * pObj, * pFanin;
-    int i, k, iFan, iFanout, Index;
-    assert( p->vFanoutNums == NULL );
+    Gia_Obj_t * pObj;
+    int i, k, iFan, * pOffs, * pFans, nFans;
+    assert( p->vFanoutOffs == NULL );
     assert( p->vFanout == NULL );
-    // recompute reference counters
-    pRefsOld = p->pLutRefs; p->pLutRefs = NULL;
-    Gia_ManSetLutRefs(p);
-    p->vFanoutNums = Vec_IntAllocArray( p->pLutRefs, Gia_ManObjNum(p) );
-    p->pLutRefs = pRefsOld;
-    // start the fanout maps
-    p->vFanout = Gia_ManStartMappingFanoutMap( p, p->vFanoutNums );
-    if ( pvIndex )
-        *pvIndex = Vec_IntStart( Vec_IntSize(p->vFanout) );
-    // incrementally add fanouts
-    vCounts = Vec_IntStart( Gia_ManObjNum(p) );
-    Gia_ManForEachLut( p, i )
+    assert( Gia_ManHasMapping(p) || (Gia_ManHasMapping2(p) && pvIndex == NULL) );
+    // count the fanouts
+    p->vFanoutOffs = Vec_IntStart( 2 * Gia_ManObjNum(p) );
+    pOffs = Vec_IntArray( p->vFanoutOffs );
+    if ( Gia_ManHasMapping(p) )
     {
-        Gia_ObjCheckDupMappingFanins( p, i );
-        pObj = Gia_ManObj( p, i );
-        Gia_LutForEachFaninIndex( p, i, iFan, k, Index )
+        Gia_ManForEachLut( p, i )
         {
-            pFanin = Gia_ManObj( p, iFan );
-            iFanout = Vec_IntEntry( vCounts, iFan );
-            Gia_ObjSetFanout( p, pFanin, iFanout, pObj );
-            Vec_IntAddToEntry( vCounts, iFan, 1 );
-            if ( pvIndex )
-                Vec_IntWriteEntry( *pvIndex, Vec_IntEntry(p->vFanout, iFan) + iFanout, Index );
+            Gia_ObjCheckDupMappingFanins( p, i );
+            Gia_LutForEachFanin( p, i, iFan, k )
+                pOffs[2*iFan+1]++;
         }
     }
+    else
+    {
+        Gia_ManForEachLut2( p, i )
+            Vec_IntForEachEntry( Gia_ObjLutFanins2(p, i), iFan, k )
+                pOffs[2*iFan+1]++;
+    }
     Gia_ManForEachCo( p, pObj, i )
+        pOffs[2*Gia_ObjFaninId0p(p, pObj)+1]++;
+    // compute the end of each fanout list
+    nFans = Gia_ManFanoutScan( pOffs, Gia_ManObjNum(p), 1 );
+    p->vFanout = Vec_IntStart( nFans );
+    pFans = Vec_IntArray( p->vFanout );
+    if ( pvIndex )
+        *pvIndex = Vec_IntStart( nFans );
+    // fill in the fanout lists (COs are listed after the LUTs)
+    for ( i = Gia_ManCoNum(p) - 1; i >= 0; i-- )
     {
-        iFan = Gia_ObjFaninId0p(p, pObj);
-        pFanin = Gia_ManObj( p, iFan );
-        iFanout = Vec_IntEntry( vCounts, iFan );
-        Gia_ObjSetFanout( p, pFanin, iFanout, pObj );
-        Vec_IntAddToEntry( vCounts, iFan, 1 );
+        pObj = Gia_ManCo( p, i );
+        pFans[--pOffs[2*Gia_ObjFaninId0p(p, pObj)]] = Gia_ObjId( p, pObj );
     }
-    // double-check the current number of fanouts added
-    Gia_ManForEachObj( p, pObj, i )
-        assert( Vec_IntEntry(vCounts, i) == Gia_ObjFanoutNum(p, pObj) );
-    Vec_IntFree( vCounts );
+    if ( Gia_ManHasMapping(p) )
+    {
+        Gia_ManForEachLutReverse( p, i )
+            for ( k = Gia_ObjLutSize(p, i) - 1; k >= 0; k-- )
+            {
+                iFan = Gia_ObjLutFanin( p, i, k );
+                pFans[--pOffs[2*iFan]] = i;
+                if ( pvIndex )
+                    Vec_IntWriteEntry( *pvIndex, pOffs[2*iFan], Vec_IntEntry(p->vMapping, i) + 1 + k );
+            }
+    }
+    else
+    {
+        Gia_ManForEachLut2Reverse( p, i )
+            Vec_IntForEachEntryReverse( Gia_ObjLutFanins2(p, i), iFan, k )
+                pFans[--pOffs[2*iFan]] = i;
+    }
+    p->nFanoutFree = 0;
 }
 
 /**Function*************************************************************
@@ -392,8 +428,128 @@ void Gia_ManStaticMappingFanoutStart( Gia_Man_t * p, Vec_Int_t ** pvIndex )
 ***********************************************************************/
 void Gia_ManStaticFanoutStop( Gia_Man_t * p )
 {
-    Vec_IntFreeP( &p->vFanoutNums );
+    Vec_IntFreeP( &p->vFanoutOffs );
     Vec_IntFreeP( &p->vFanout );
+    p->nFanoutFree = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Updates static fanout after small changes of the AIG.]
+
+  Description [A fanout added to the list ending at the end of the packed
+  array is appended in place; otherwise, the list is moved to the end of
+  the array and the old entries are left unused. Removing a fanout keeps
+  the order of the remaining fanouts. New objects can be added to the
+  AIG after the fanout was computed; their fanout lists start empty.
+  The unused entries are reclaimed when they exceed the used ones.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_ManStaticFanoutGrow( Gia_Man_t * p, int iObj )
+{
+    if ( 2 * iObj >= Vec_IntSize(p->vFanoutOffs) )
+        Vec_IntFillExtra( p->vFanoutOffs, 2 * Abc_MaxInt(iObj + 1, Gia_ManObjNum(p)), 0 );
+}
+void Gia_ObjAddFanoutStatic( Gia_Man_t * p, int iObj, int iFanout )
+{
+    int i, iStart, nFans;
+    assert( p->vFanoutOffs != NULL );
+    Gia_ManStaticFanoutGrow( p, Abc_MaxInt(iObj, iFanout) );
+    iStart = Gia_ObjFoffsetId( p, iObj );
+    nFans  = Gia_ObjFanoutNumId( p, iObj );
+    if ( iStart + nFans != Vec_IntSize(p->vFanout) )
+    {
+        // move the fanout list to the end of the array
+        Vec_IntWriteEntry( p->vFanoutOffs, 2*iObj, Vec_IntSize(p->vFanout) );
+        for ( i = 0; i < nFans; i++ )
+            Vec_IntPush( p->vFanout, Vec_IntEntry(p->vFanout, iStart + i) );
+        p->nFanoutFree += nFans;
+    }
+    Vec_IntPush( p->vFanout, iFanout );
+    Vec_IntAddToEntry( p->vFanoutOffs, 2*iObj+1, 1 );
+    if ( p->nFanoutFree > Vec_IntSize(p->vFanout) / 2 )
+        Gia_ManStaticFanoutCompact( p );
+}
+void Gia_ObjRemoveFanoutStatic( Gia_Man_t * p, int iObj, int iFanout )
+{
+    int i, * pFans, iStart = Gia_ObjFoffsetId( p, iObj ), nFans = Gia_ObjFanoutNumId( p, iObj );
+    pFans = Vec_IntEntryP( p->vFanout, iStart );
+    for ( i = 0; i < nFans; i++ )
+        if ( pFans[i] == iFanout )
+            break;
+    assert( i < nFans );
+    for ( ; i < nFans - 1; i++ )
+        pFans[i] = pFans[i+1];
+    Vec_IntAddToEntry( p->vFanoutOffs, 2*iObj+1, -1 );
+    if ( iStart + nFans == Vec_IntSize(p->vFanout) )
+        Vec_IntShrink( p->vFanout, iStart + nFans - 1 );
+    else
+        p->nFanoutFree++;
+}
+void Gia_ManStaticFanoutCompact( Gia_Man_t * p )
+{
+    Vec_Int_t * vFanout = Vec_IntAlloc( Vec_IntSize(p->vFanout) - p->nFanoutFree );
+    int i, k, iStart, nFans;
+    for ( i = 0; 2 * i < Vec_IntSize(p->vFanoutOffs); i++ )
+    {
+        iStart = Gia_ObjFoffsetId( p, i );
+        nFans  = Gia_ObjFanoutNumId( p, i );
+        Vec_IntWriteEntry( p->vFanoutOffs, 2*i, Vec_IntSize(vFanout) );
+        for ( k = 0; k < nFans; k++ )
+            Vec_IntPush( vFanout, Vec_IntEntry(p->vFanout, iStart + k) );
+    }
+    Vec_IntFree( p->vFanout );
+    p->vFanout = vFanout;
+    p->nFanoutFree = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks static fanout against the current AIG.]
+
+  Description [Returns 1 if each fanin-fanout edge of the AIG is listed
+  exactly once in the fanout lists.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManStaticFanoutCheck( Gia_Man_t * p )
+{
+    Gia_Obj_t * pObj;
+    Vec_Int_t * vCounts = Vec_IntStart( Gia_ManObjNum(p) );
+    int i, k, iFan, nEdges = 0, RetValue = 1;
+    Gia_ManForEachObj( p, pObj, i )
+    {
+        if ( Gia_ObjIsAnd(pObj) || Gia_ObjIsCo(pObj) )
+            Vec_IntAddToEntry( vCounts, Gia_ObjFaninId0(pObj, i), 1 ), nEdges++;
+        if ( Gia_ObjIsAnd(pObj) && !Gia_ObjIsBuf(pObj) )
+            Vec_IntAddToEntry( vCounts, Gia_ObjFaninId1(pObj, i), 1 ), nEdges++;
+        if ( Gia_ObjIsMuxId(p, i) )
+            Vec_IntAddToEntry( vCounts, Gia_ObjFaninId2(p, i), 1 ), nEdges++;
+    }
+    Gia_ManForEachObj( p, pObj, i )
+    {
+        if ( 2 * i >= Vec_IntSize(p->vFanoutOffs) || Gia_ObjFanoutNumId(p, i) != Vec_IntEntry(vCounts, i) )
+        {
+            RetValue = 0;
+            break;
+        }
+        Gia_ObjForEachFanoutStaticId( p, i, iFan, k )
+            if ( Gia_ObjFaninId0p(p, Gia_ManObj(p, iFan)) != i && 
+                 (!Gia_ObjIsAnd(Gia_ManObj(p, iFan)) || Gia_ObjFaninId1(Gia_ManObj(p, iFan), iFan) != i) && 
+                 (!Gia_ObjIsMuxId(p, iFan) || Gia_ObjFaninId2(p, iFan) != i) )
+                RetValue = 0;
+    }
+    if ( RetValue && Vec_IntSize(p->vFanout) - p->nFanoutFree != nEdges )
+        RetValue = 0;
+    Vec_IntFree( vCounts );
+    return RetValue;
 }
 
 
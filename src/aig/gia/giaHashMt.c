@@ -0,0 +1,405 @@
+/**CFile****************************************************************
+
+  FileName    [giaHashMt.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Concurrent structural hashing.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: giaHashMt.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+#include "misc/util/utilAtomic.h"
+#include "misc/util/utilPool.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define GIA_HASH_PROC_MAX 64
+
+// The table uses open addressing with linear probing. A slot is claimed
+// by a CAS on its key (the pair of fanin literals), after which the owner
+// creates the node and publishes its ID. Other threads looking for the
+// same key wait until the ID appears. Node IDs are taken from one atomic
+// counter, so a node returned by the table always has a smaller ID than
+// any node created after that, which keeps the AIG topologically ordered.
+// If the reserved object storage is exhausted, the slot gets value -1 and
+// the callers get literal -1, after which the AIG should be discarded.
+
+struct Gia_HashMt_t_
+{
+    Gia_Man_t *     pGia;           // the AIG manager
+    int             nObjsMax;       // reserved object storage
+    int             fHashOld;       // the sequential table was started
+    int             fOverflow;      // the reserved object storage was exceeded
+    int             nLogSize;       // log2 of the table size
+    unsigned        Mask;           // table size minus one
+    word *          pKeys;          // fanin literal pairs
+    int *           pVals;          // object IDs
+};
+
+static inline unsigned Gia_ManHashMtSlot( Gia_HashMt_t * p, word Key ) { return (unsigned)((Key * ABC_CONST(0x9E3779B97F4A7C15)) >> (64 - p->nLogSize)); }
+static inline word     Gia_ManHashMtKey( int iLit0, int iLit1 )        { return ((word)iLit0 << 32) | (word)iLit1;                                         }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts concurrent structural hashing.]
+
+  Description [Reserves object storage for nObjsMax objects, so that the
+  object array is never reallocated while threads add nodes. Only AND
+  nodes can be added while the concurrent table is active. The sequential
+  table, if present, is restored when the concurrent table is stopped.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_HashMt_t * Gia_ManHashMtStart( Gia_Man_t * p, int nObjsMax )
+{
+    Gia_HashMt_t * pHash;
+    Gia_Obj_t * pObj; int i;
+    assert( p->pMuxes == NULL && !p->fGiaSimple && !p->fAddStrash );
+    assert( p->pFanData == NULL && !p->fSweeper && !p->fBuiltInSim && p->vSuppWords == NULL );
+    nObjsMax = Abc_MinInt( Abc_MaxInt(nObjsMax, Gia_ManObjNum(p) + 1), (1 << 29) );
+    pHash = ABC_CALLOC( Gia_HashMt_t, 1 );
+    pHash->pGia     = p;
+    pHash->nObjsMax = nObjsMax;
+    pHash->fHashOld = Vec_IntSize(&p->vHTable) > 0;
+    if ( pHash->fHashOld )
+        Gia_ManHashStop( p );
+    // reserve object storage
+    if ( p->nObjsAlloc < nObjsMax )
+    {
+        p->pObjs = ABC_REALLOC( Gia_Obj_t, p->pObjs, nObjsMax );
+        memset( p->pObjs + p->nObjsAlloc, 0, sizeof(Gia_Obj_t) * (nObjsMax - p->nObjsAlloc) );
+        p->nObjsAlloc = nObjsMax;
+    }
+    // start the table with load factor below 2/3
+    pHash->nLogSize = Abc_MaxInt( 10, Abc_Base2Log(nObjsMax + nObjsMax / 2) );
+    pHash->Mask     = (unsigned)((1 << pHash->nLogSize) - 1);
+    pHash->pKeys    = ABC_CALLOC( word, pHash->Mask + 1 );
+    pHash->pVals    = ABC_CALLOC( int,  pHash->Mask + 1 );
+    // add the existing nodes
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        word Key = Gia_ManHashMtKey( Gia_ObjFaninLit0(pObj, i), Gia_ObjFaninLit1(pObj, i) );
+        unsigned iSlot = Gia_ManHashMtSlot( pHash, Key );
+        if ( Gia_ObjIsBuf(pObj) )
+            continue;
+        while ( pHash->pKeys[iSlot] && pHash->pKeys[iSlot] != Key )
+            iSlot = (iSlot + 1) & pHash->Mask;
+        if ( pHash->pKeys[iSlot] )
+            continue;
+        pHash->pKeys[iSlot] = Key;
+        pHash->pVals[iSlot] = i;
+    }
+    return pHash;
+}
+void Gia_ManHashMtStop( Gia_HashMt_t * p )
+{
+    if ( p->pGia->nObjs > p->nObjsMax )
+        p->pGia->nObjs = p->nObjsMax;
+    if ( p->fHashOld )
+        Gia_ManHashStart( p->pGia );
+    ABC_FREE( p->pKeys );
+    ABC_FREE( p->pVals );
+    ABC_FREE( p );
+}
+double Gia_ManHashMtMemory( Gia_HashMt_t * p )
+{
+    return (double)(sizeof(word) + sizeof(int)) * (p->Mask + 1);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Creates a new AND node (called by one thread at a time).]
+
+  Description [Returns -1 if the reserved object storage is exceeded.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_ManHashMtAppendAnd( Gia_HashMt_t * p, int iLit0, int iLit1 )
+{
+    Gia_Obj_t * pObj;
+    int iObj = Abc_AtomicAddInt( &p->pGia->nObjs, 1 );
+    if ( iObj >= p->nObjsMax )
+    {
+        Abc_AtomicStoreInt( &p->fOverflow, 1 );
+        return -1;
+    }
+    assert( iLit0 < iLit1 && Abc_Lit2Var(iLit1) < iObj );
+    pObj = p->pGia->pObjs + iObj;
+    pObj->iDiff0  = (unsigned)(iObj - Abc_Lit2Var(iLit0));
+    pObj->fCompl0 = (unsigned)(Abc_LitIsCompl(iLit0));
+    pObj->iDiff1  = (unsigned)(iObj - Abc_Lit2Var(iLit1));
+    pObj->fCompl1 = (unsigned)(Abc_LitIsCompl(iLit1));
+    return iObj;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds or adds an AND node (can be called by several threads).]
+
+  Description [Returns -1 if the node cannot be added because the reserved
+  object storage is exceeded.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManHashMtAnd( Gia_HashMt_t * p, int iLit0, int iLit1 )
+{
+    word Key, KeyThis;
+    unsigned iSlot;
+    int iObj;
+    if ( iLit0 < 2 )
+        return iLit0 ? iLit1 : 0;
+    if ( iLit1 < 2 )
+        return iLit1 ? iLit0 : 0;
+    if ( iLit0 == iLit1 )
+        return iLit1;
+    if ( iLit0 == Abc_LitNot(iLit1) )
+        return 0;
+    if ( iLit0 > iLit1 )
+        iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
+    Key = Gia_ManHashMtKey( iLit0, iLit1 );
+    for ( iSlot = Gia_ManHashMtSlot(p, Key); ; iSlot = (iSlot + 1) & p->Mask )
+    {
+        KeyThis = Abc_AtomicLoadWord( p->pKeys + iSlot );
+        if ( KeyThis == 0 )
+        {
+            if ( Abc_AtomicCasWord( p->pKeys + iSlot, 0, Key ) )
+            {
+                iObj = Gia_ManHashMtAppendAnd( p, iLit0, iLit1 );
+                Abc_AtomicStoreInt( p->pVals + iSlot, iObj );
+                return iObj == -1 ? -1 : Abc_Var2Lit( iObj, 0 );
+            }
+            KeyThis = Abc_AtomicLoadWord( p->pKeys + iSlot );
+        }
+        if ( KeyThis != Key )
+            continue;
+        // another thread has claimed this slot and may still be creating the node
+        while ( (iObj = Abc_AtomicLoadInt(p->pVals + iSlot)) == 0 )
+            Abc_AtomicPause();
+        return iObj == -1 ? -1 : Abc_Var2Lit( iObj, 0 );
+    }
+    assert( 0 );
+    return -1;
+}
+int Gia_ManHashMtLookup( Gia_HashMt_t * p, int iLit0, int iLit1 )
+{
+    word Key, KeyThis;
+    unsigned iSlot;
+    int iObj;
+    if ( iLit0 > iLit1 )
+        iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
+    Key = Gia_ManHashMtKey( iLit0, iLit1 );
+    for ( iSlot = Gia_ManHashMtSlot(p, Key); ; iSlot = (iSlot + 1) & p->Mask )
+    {
+        KeyThis = Abc_AtomicLoadWord( p->pKeys + iSlot );
+        if ( KeyThis == 0 )
+            return -1;
+        if ( KeyThis != Key )
+            continue;
+        while ( (iObj = Abc_AtomicLoadInt(p->pVals + iSlot)) == 0 )
+            Abc_AtomicPause();
+        return iObj == -1 ? -1 : Abc_Var2Lit( iObj, 0 );
+    }
+    assert( 0 );
+    return -1;
+}
+int Gia_ManHashMtOverflow( Gia_HashMt_t * p )
+{
+    return Abc_AtomicLoadInt( &p->fOverflow );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Rehashes the AIG using several threads.]
+
+  Description [The COs are divided into contiguous groups, and each thread
+  duplicates the fanin cones of its group in the DFS order. When the cones
+  overlap, several threads may visit the same node, but they are guaranteed
+  to get the same literal from the concurrent table. The resulting AIG is
+  structurally equivalent to that of Gia_ManRehash() while the node order
+  may be different.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Gia_HashMtThData_t_
+{
+    Gia_Man_t *     p;              // the AIG to be rehashed
+    Gia_HashMt_t *  pHash;          // the concurrent table
+    int             iStart;         // first CO
+    int             iStop;          // last CO
+} Gia_HashMtThData_t;
+
+static void Gia_ManRehashMtCone( Gia_Man_t * p, Gia_HashMt_t * pHash, int iRoot, Vec_Int_t * vStack )
+{
+    // visits the cone in the DFS order using an explicit stack,
+    // because deep AIGs may overflow the stacks of the worker threads
+    Gia_Obj_t * pObj;
+    int iObj, Lit0, Lit1, Value;
+    Vec_IntClear( vStack );
+    Vec_IntPush( vStack, iRoot );
+    while ( Vec_IntSize(vStack) > 0 )
+    {
+        iObj = Vec_IntEntryLast( vStack );
+        pObj = Gia_ManObj( p, iObj );
+        if ( Abc_AtomicLoadInt((volatile int *)&pObj->Value) != -1 )
+        {
+            Vec_IntPop( vStack );
+            continue;
+        }
+        assert( Gia_ObjIsAnd(pObj) );
+        Lit0 = Abc_AtomicLoadInt( (volatile int *)&Gia_ObjFanin0(pObj)->Value );
+        Lit1 = Abc_AtomicLoadInt( (volatile int *)&Gia_ObjFanin1(pObj)->Value );
+        if ( Lit0 == -1 || Lit1 == -1 )
+        {
+            if ( Lit0 == -1 )
+                Vec_IntPush( vStack, Gia_ObjFaninId0(pObj, iObj) );
+            if ( Lit1 == -1 )
+                Vec_IntPush( vStack, Gia_ObjFaninId1(pObj, iObj) );
+            continue;
+        }
+        Vec_IntPop( vStack );
+        Value = Gia_ManHashMtAnd( pHash, Abc_LitNotCond(Lit0, Gia_ObjFaninC0(pObj)), Abc_LitNotCond(Lit1, Gia_ObjFaninC1(pObj)) );
+        if ( Value == -1 )
+            return;
+        Abc_AtomicStoreInt( (volatile int *)&pObj->Value, Value );
+    }
+}
+static void * Gia_ManRehashMtTask( void * pArg )
+{
+    Gia_HashMtThData_t * pThData = (Gia_HashMtThData_t *)pArg;
+    Vec_Int_t * vStack = Vec_IntAlloc( 1000 );
+    int i;
+    for ( i = pThData->iStart; i < pThData->iStop && !Gia_ManHashMtOverflow(pThData->pHash); i++ )
+        Gia_ManRehashMtCone( pThData->p, pThData->pHash, Gia_ObjFaninId0p(pThData->p, Gia_ManCo(pThData->p, i)), vStack );
+    Vec_IntFree( vStack );
+    return NULL;
+}
+Gia_Man_t * Gia_ManRehashMt( Gia_Man_t * p, int nProcs )
+{
+    Abc_Task_t * pTasks[GIA_HASH_PROC_MAX];
+    Gia_HashMtThData_t ThData[GIA_HASH_PROC_MAX];
+    Gia_Man_t * pNew, * pTemp;
+    Gia_HashMt_t * pHash;
+    Gia_Obj_t * pObj;
+    int i, nChunk, fOverflow;
+    if ( nProcs <= 1 )
+        return Gia_ManRehash( p, 0 );
+    assert( p->pMuxes == NULL );
+    nProcs = Abc_MinInt( nProcs, GIA_HASH_PROC_MAX );
+    pNew = Gia_ManStart( Gia_ManObjNum(p) );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    Gia_ManFillValue( p );
+    Gia_ManConst0(p)->Value = 0;
+    Gia_ManForEachCi( p, pObj, i )
+        pObj->Value = Gia_ManAppendCi( pNew );
+    // duplicate the internal nodes (the calling thread processes the first group)
+    pHash  = Gia_ManHashMtStart( pNew, Gia_ManObjNum(p) );
+    nChunk = (Gia_ManCoNum(p) + nProcs - 1) / nProcs;
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].p      = p;
+        ThData[i].pHash  = pHash;
+        ThData[i].iStart = Abc_MinInt( i * nChunk, Gia_ManCoNum(p) );
+        ThData[i].iStop  = Abc_MinInt( (i + 1) * nChunk, Gia_ManCoNum(p) );
+    }
+    for ( i = 1; i < nProcs; i++ )
+        pTasks[i] = Abc_TaskStart( Abc_PoolGlobal(), Gia_ManRehashMtTask, ThData + i );
+    Gia_ManRehashMtTask( ThData );
+    for ( i = 1; i < nProcs; i++ )
+    {
+        Abc_TaskWait( pTasks[i] );
+        Abc_TaskFree( pTasks[i] );
+    }
+    fOverflow = Gia_ManHashMtOverflow( pHash );
+    Gia_ManHashMtStop( pHash );
+    if ( fOverflow )
+    {
+        // the storage is reserved for the original number of objects, which
+        // is never exceeded when rehashing; fall back to sequential hashing
+        Gia_ManStop( pNew );
+        return Gia_ManRehash( p, 0 );
+    }
+    // add the COs
+    Gia_ManForEachCo( p, pObj, i )
+        pObj->Value = Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(pObj) );
+    Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
+    pNew = Gia_ManCleanup( pTemp = pNew );
+    Gia_ManStop( pTemp );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Compares the sequential and the concurrent tables.]
+
+  Description [Rehashes the AIG using the sequential table and using the
+  concurrent table with the given number of threads, and reports the
+  number of AND nodes added per second of elapsed time.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManHashMtBench( Gia_Man_t * p, int nProcs )
+{
+    Gia_Man_t * pNew1, * pNew2;
+    abctime clk1, clk2;
+    clk1  = Abc_ClockWall();
+    pNew1 = Gia_ManRehash( p, 0 );
+    clk1  = Abc_ClockWall() - clk1;
+    clk2  = Abc_ClockWall();
+    pNew2 = Gia_ManRehashMt( p, nProcs );
+    clk2  = Abc_ClockWall() - clk2;
+    printf( "Sequential table :  And = %9d  ", Gia_ManAndNum(pNew1) );
+    printf( "Rate = %8.2f Mnodes/sec  ", 1.0 * Gia_ManAndNum(p) / Abc_MaxInt(1, clk1) * CLOCKS_PER_SEC / 1000000 );
+    Abc_PrintTime( 1, "Time", clk1 );
+    printf( "Concurrent table :  And = %9d  ", Gia_ManAndNum(pNew2) );
+    printf( "Rate = %8.2f Mnodes/sec  ", 1.0 * Gia_ManAndNum(p) / Abc_MaxInt(1, clk2) * CLOCKS_PER_SEC / 1000000 );
+    printf( "Threads = %d  ", nProcs );
+    Abc_PrintTime( 1, "Time", clk2 );
+    if ( Gia_ManAndNum(pNew1) != Gia_ManAndNum(pNew2) )
+        printf( "Node counts of the rehashed AIGs are different.\n" );
+    Gia_ManStop( pNew1 );
+    Gia_ManStop( pNew2 );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
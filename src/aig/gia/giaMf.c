@@ -25,6 +25,18 @@
 #include "sat/cnf/cnf.h"
 #include "opt/dau/dau.h"
 #include "bool/kit/kit.h"
+#include "misc/util/utilPool.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -39,6 +51,8 @@ ABC_NAMESPACE_IMPL_START
 #define MF_TT_WORDS  ((MF_LEAF_MAX > 6) ? 1 << (MF_LEAF_MAX-6) : 1)
 #define MF_NO_FUNC    134217727     // (1<<27)-1
 #define MF_EPSILON 0.005
+#define MF_PROC_MAX   64
+#define MF_PAR_MIN    64            // min number of nodes per thread in one level
 
 typedef struct Mf_Cut_t_ Mf_Cut_t; 
 struct Mf_Cut_t_
@@ -80,10 +94,14 @@ struct Mf_Man_t_
     abctime         clkStart;       // starting time
     double          CutCount[4];    // cut counts
     int             nCutCounts[MF_LEAF_MAX+1];
+    // multi-threading
+    Vec_Wec_t *     vLevels;        // AND nodes by level
+    Mf_Man_t *      pMain;          // main manager (used by per-thread copies)
+    void *          pMutex;         // mutex protecting page allocation
 };
 
 static inline Mf_Obj_t * Mf_ManObj( Mf_Man_t * p, int i )            { return p->pLfObjs + i;                                          }
-static inline int *      Mf_ManCutSet( Mf_Man_t * p, int i )         { return (int *)Vec_PtrEntry(&p->vPages, i >> 16) + (i & 0xFFFF); }
+static inline int *      Mf_ManCutSet( Mf_Man_t * p, int i )         { return (int *)p->vPages.pArray[i >> 16] + (i & 0xFFFF);         }
 static inline int *      Mf_ObjCutSet( Mf_Man_t * p, int i )         { return Mf_ManCutSet(p, Mf_ManObj(p, i)->iCutSet);               }
 static inline int *      Mf_ObjCutBest( Mf_Man_t * p, int i )        { return Mf_ObjCutSet(p, i) + 1;                                  }
 
@@ -101,6 +119,10 @@ static inline int        Mf_CutIsTriv( int * pCut, int i )           { return Mf
 
 extern int Kit_TruthToGia( Gia_Man_t * pMan, unsigned * pTruth, int nVars, Vec_Int_t * vMemory, Vec_Int_t * vLeaves, int fHash );
 
+static int  Mf_ManPageGrab( Mf_Man_t * p );
+static int  Mf_ManUseThreads( Mf_Man_t * p );
+static void Mf_ManPerformParallel( Mf_Man_t * p, int fMapping );
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -735,8 +757,8 @@ static inline int Mf_ManSaveCuts( Mf_Man_t * p, Mf_Cut_t ** pCuts, int nCuts )
     for ( i = 0; i < nCuts; i++ )
         nInts += pCuts[i]->nLeaves + 1;
     if ( (p->iCur & 0xFFFF) + nInts > 0xFFFF )
-        p->iCur = ((p->iCur >> 16) + 1) << 16;
-    if ( Vec_PtrSize(&p->vPages) == (p->iCur >> 16) )
+        p->iCur = p->pMain ? Mf_ManPageGrab(p) << 16 : ((p->iCur >> 16) + 1) << 16;
+    if ( !p->pMain && Vec_PtrSize(&p->vPages) == (p->iCur >> 16) )
         Vec_PtrPush( &p->vPages, ABC_ALLOC(int, (1<<16)) );
     iCur = p->iCur; p->iCur += nInts;
     pPlace = Mf_ManCutSet( p, iCur );
@@ -1419,6 +1441,7 @@ void Mf_ManFree( Mf_Man_t * p )
     if ( p->pPars->fCutMin )
         Vec_MemFree( p->vTtMem );
     Vec_PtrFreeData( &p->vPages );
+    Vec_WecFreeP( &p->vLevels );
     ABC_FREE( p->vCnfSizes.pArray );
     ABC_FREE( p->vCnfMem.pArray );
     ABC_FREE( p->vPages.pArray );
@@ -1462,6 +1485,7 @@ void Mf_ManSetDefaultPars( Jf_Par_t * pPars )
     pPars->fVeryVerbose =  0;
     pPars->nLutSizeMax  =  MF_LEAF_MAX;
     pPars->nCutNumMax   =  MF_CUT_MAX;
+    pPars->nProcNumMax  =  MF_PROC_MAX;
 }
 void Mf_ManPrintStats( Mf_Man_t * p, char * pTitle )
 {
@@ -1490,6 +1514,8 @@ void Mf_ManPrintInit( Mf_Man_t * p )
     printf( "Coarse = %d  ",  p->pPars->fCoarsen );
     printf( "CNF = %d  ",     p->pPars->fGenCnf );
     printf( "FFL = %d  ",     p->pPars->fGenLit );
+    if ( p->pPars->nProcNum > 1 )
+        printf( "Threads = %d  ", Mf_ManUseThreads(p) ? p->pPars->nProcNum : 1 );
     printf( "\n" );
     printf( "Computing cuts...\r" );
     fflush( stdout );
@@ -1531,8 +1557,11 @@ void Mf_ManPrintQuit( Mf_Man_t * p, Gia_Man_t * pNew )
 void Mf_ManComputeCuts( Mf_Man_t * p )
 {
     int i;
-    Gia_ManForEachAndId( p->pGia, i )
-        Mf_ObjMergeOrder( p, i );
+    if ( Mf_ManUseThreads(p) )
+        Mf_ManPerformParallel( p, 0 );
+    else
+        Gia_ManForEachAndId( p->pGia, i )
+            Mf_ObjMergeOrder( p, i );
     Mf_ManSetMapRefs( p );
     Mf_ManPrintStats( p, (char *)(p->fUseEla ? "Ela  " : (p->Iter ? "Area " : "Delay")) );
 }
@@ -1732,13 +1761,16 @@ int Mf_ManMappingFromMapping( Mf_Man_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-void Mf_ManPrintFanoutProfile( Mf_Man_t * p, Vec_Int_t * vFanCounts )
+void Mf_ManPrintFanoutProfile( Mf_Man_t * p )
 {
     Gia_Man_t * pGia = p->pGia0;
-    int i, Count, nMax = Vec_IntFindMax( vFanCounts );
-    Vec_Int_t * vCounts = Vec_IntStart( nMax + 1 );
-    Vec_IntForEachEntry( vFanCounts, Count, i )
-        if ( Count && Gia_ObjIsAnd(Gia_ManObj(pGia, i)) ) 
+    int i, Count, nMax = 0;
+    Vec_Int_t * vCounts;
+    for ( i = 0; i < Gia_ManObjNum(pGia); i++ )
+        nMax = Abc_MaxInt( nMax, Gia_ObjFanoutNumId(pGia, i) );
+    vCounts = Vec_IntStart( nMax + 1 );
+    for ( i = 0; i < Gia_ManObjNum(pGia); i++ )
+        if ( (Count = Gia_ObjFanoutNumId(pGia, i)) && Gia_ObjIsAnd(Gia_ManObj(pGia, i)) ) 
             Vec_IntAddToEntry( vCounts, Count, 1 );
     printf( "\nFanout distribution for internal nodes:\n" );
     Vec_IntForEachEntry( vCounts, Count, i )
@@ -1790,16 +1822,173 @@ void Mf_ManOptimization( Mf_Man_t * p )
     int i, Count, nNodes = Mf_ManMappingFromMapping( p );
     Gia_ManLevelNum( pGia );
     Gia_ManStaticMappingFanoutStart( pGia, NULL );
-    Mf_ManPrintFanoutProfile( p, pGia->vFanoutNums );
+    Mf_ManPrintFanoutProfile( p );
     printf( "\nIndividual logic cones for mapping with %d nodes:\n", nNodes );
-    Vec_IntForEachEntry( pGia->vFanoutNums, Count, i )
-        if ( Count >= 2 && Count <= nOutMax && Gia_ObjIsAnd(Gia_ManObj(pGia, i)) )
+    for ( i = 0; i < Gia_ManObjNum(pGia); i++ )
+        if ( (Count = Gia_ObjFanoutNumId(pGia, i)) >= 2 && Count <= nOutMax && Gia_ObjIsAnd(Gia_ManObj(pGia, i)) )
             Mf_ManOptimizationOne( p, i );
     printf( "\nFinished printing individual logic cones.\n" );
     Gia_ManStaticFanoutStop( pGia );
     Vec_IntFreeP( &pGia->vMapping );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Multi-threaded cut computation and area flow.]
+
+  Description [The AND nodes are partitioned by logic level. The nodes 
+  of one level depend only on the nodes of lower levels, so each level 
+  is split into contiguous chunks processed by separate threads. Every 
+  thread works with a shallow copy of the manager, which owns its own 
+  cut pages and statistics, while the per-node data is shared. The result 
+  is the same as that of the sequential computation.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+
+static int  Mf_ManPageGrab( Mf_Man_t * p )                       { assert( 0 ); return 0; }
+static int  Mf_ManUseThreads( Mf_Man_t * p )                     { return 0;              }
+static void Mf_ManPerformParallel( Mf_Man_t * p, int fMapping )  { assert( 0 );           }
+
+#else // pthreads are used
+
+typedef struct Mf_ThData_t_
+{
+    Mf_Man_t *  pMan;       // per-thread copy of the manager
+    Vec_Int_t * vNodes;     // nodes of the current level
+    int         iStart;     // first node to process
+    int         iStop;      // last node to process
+    int         fMapping;   // computing best cuts rather than cutsets
+} Mf_ThData_t;
+
+static int Mf_ManPageGrab( Mf_Man_t * p )
+{
+    Mf_Man_t * pMain = p->pMain;
+    int iPage;
+    pthread_mutex_lock( (pthread_mutex_t *)p->pMutex );
+    iPage = Vec_PtrSize( &pMain->vPages );
+    assert( iPage < Vec_PtrCap(&pMain->vPages) );
+    Vec_PtrPush( &pMain->vPages, ABC_ALLOC(int, (1<<16)) );
+    pthread_mutex_unlock( (pthread_mutex_t *)p->pMutex );
+    assert( pMain->vPages.pArray == p->vPages.pArray );
+    return iPage;
+}
+static int Mf_ManUseThreads( Mf_Man_t * p )
+{
+    // truth tables are hashed in the order of cut computation, 
+    // while choice nodes may use cutsets of nodes on higher levels
+    return p->pPars->nProcNum > 1 && !p->pPars->fCutMin && !Gia_ManHasChoices(p->pGia);
+}
+static void Mf_ManComputeLevels( Mf_Man_t * p )
+{
+    Gia_Obj_t * pObj; int i, Level;
+    Vec_Int_t * vLevel = Vec_IntStart( Gia_ManObjNum(p->pGia) );
+    assert( p->vLevels == NULL );
+    p->vLevels = Vec_WecAlloc( 100 );
+    Gia_ManForEachAnd( p->pGia, pObj, i )
+    {
+        Level = Abc_MaxInt( Vec_IntEntry(vLevel, Gia_ObjFaninId0(pObj, i)), Vec_IntEntry(vLevel, Gia_ObjFaninId1(pObj, i)) );
+        if ( Gia_ObjIsMuxId(p->pGia, i) )
+            Level = Abc_MaxInt( Level, Vec_IntEntry(vLevel, Gia_ObjFaninId2(p->pGia, i)) );
+        Vec_IntWriteEntry( vLevel, i, Level + 1 );
+        Vec_WecPush( p->vLevels, Level, i );
+    }
+    Vec_IntFree( vLevel );
+}
+static void Mf_ManProcessRange( Mf_Man_t * p, Vec_Int_t * vNodes, int iStart, int iStop, int fMapping )
+{
+    int i;
+    for ( i = iStart; i < iStop; i++ )
+        if ( fMapping )
+            Mf_ObjComputeBestCut( p, Vec_IntEntry(vNodes, i) );
+        else
+            Mf_ObjMergeOrder( p, Vec_IntEntry(vNodes, i) );
+}
+static void * Mf_WorkerTask( void * pArg )
+{
+    Mf_ThData_t * pThData = (Mf_ThData_t *)pArg;
+    Mf_ManProcessRange( pThData->pMan, pThData->vNodes, pThData->iStart, pThData->iStop, pThData->fMapping );
+    return NULL;
+}
+static void Mf_ManPerformParallel( Mf_Man_t * p, int fMapping )
+{
+    Abc_Task_t * pTasks[MF_PROC_MAX];
+    Mf_ThData_t ThData[MF_PROC_MAX];
+    pthread_mutex_t Mutex;
+    Mf_Man_t * pCopies;
+    Vec_Int_t * vNodes;
+    int nProcs = p->pPars->nProcNum;
+    int i, k, nNodes, nChunk;
+    assert( nProcs > 1 && nProcs <= MF_PROC_MAX );
+    if ( p->vLevels == NULL )
+        Mf_ManComputeLevels( p );
+    if ( !fMapping )
+    {
+        // reserve the page table, so that it is not reallocated while the threads read it
+        int nInts  = 1 + p->pPars->nCutNum * (p->pPars->nLutSize + 1);
+        int nPages = 2 + nProcs + (int)((double)Gia_ManAndNum(p->pGia) * nInts / (0xFFFF - nInts));
+        // page 0 is skipped, so that a cutset handle is never zero
+        if ( Vec_PtrSize(&p->vPages) == 0 )
+            Vec_PtrPush( &p->vPages, ABC_ALLOC(int, (1<<16)) );
+        Vec_PtrGrow( &p->vPages, Vec_PtrSize(&p->vPages) + nPages );
+    }
+    // create per-thread copies of the manager
+    pthread_mutex_init( &Mutex, NULL );
+    pCopies = ABC_ALLOC( Mf_Man_t, nProcs );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        pCopies[i] = *p;
+        pCopies[i].pMain  = p;
+        pCopies[i].pMutex = (void *)&Mutex;
+        pCopies[i].iCur   = 0xFFFF; // the first cutset saved will grab a new page
+        memset( pCopies[i].CutCount, 0, sizeof(p->CutCount) );
+        memset( pCopies[i].nCutCounts, 0, sizeof(p->nCutCounts) );
+        ThData[i].pMan     = pCopies + i;
+        ThData[i].fMapping = fMapping;
+    }
+    // process the levels (the calling thread processes the first chunk)
+    Vec_WecForEachLevel( p->vLevels, vNodes, k )
+    {
+        nNodes = Vec_IntSize(vNodes);
+        if ( nNodes < MF_PAR_MIN * nProcs )
+        {
+            Mf_ManProcessRange( pCopies, vNodes, 0, nNodes, fMapping );
+            continue;
+        }
+        nChunk = (nNodes + nProcs - 1) / nProcs;
+        for ( i = 0; i < nProcs; i++ )
+        {
+            ThData[i].vNodes = vNodes;
+            ThData[i].iStart = Abc_MinInt( i * nChunk, nNodes );
+            ThData[i].iStop  = Abc_MinInt( (i + 1) * nChunk, nNodes );
+        }
+        for ( i = 1; i < nProcs; i++ )
+            pTasks[i] = Abc_TaskStart( Abc_PoolGlobal(), Mf_WorkerTask, ThData + i );
+        Mf_WorkerTask( ThData );
+        for ( i = 1; i < nProcs; i++ )
+        {
+            Abc_TaskWait( pTasks[i] );
+            Abc_TaskFree( pTasks[i] );
+        }
+    }
+    // collect statistics
+    for ( i = 0; i < nProcs; i++ )
+    {
+        for ( k = 0; k < 4; k++ )
+            p->CutCount[k] += pCopies[i].CutCount[k];
+        for ( k = 0; k <= MF_LEAF_MAX; k++ )
+            p->nCutCounts[k] += pCopies[i].nCutCounts[k];
+    }
+    pthread_mutex_destroy( &Mutex );
+    ABC_FREE( pCopies );
+}
+
+#endif // pthreads are used
+
 /**Function*************************************************************
 
   Synopsis    [Technology mappping.]
@@ -1814,8 +2003,11 @@ void Mf_ManOptimization( Mf_Man_t * p )
 void Mf_ManComputeMapping( Mf_Man_t * p )
 {
     int i;
-    Gia_ManForEachAndId( p->pGia, i )
-        Mf_ObjComputeBestCut( p, i );
+    if ( !p->fUseEla && Mf_ManUseThreads(p) )
+        Mf_ManPerformParallel( p, 1 );
+    else
+        Gia_ManForEachAndId( p->pGia, i )
+            Mf_ObjComputeBestCut( p, i );
     Mf_ManSetMapRefs( p );
     Mf_ManPrintStats( p, (char *)(p->fUseEla ? "Ela  " : (p->Iter ? "Area " : "Delay")) );
 }
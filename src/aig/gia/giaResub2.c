@@ -1116,7 +1116,7 @@ int Gia_RsbFindFaninToAddToCut( Gia_Man_t * p, Vec_Int_t * vIns )
         assert( nFanins < 64 );
     }
     // find fanin with the highest count
-    if ( p->vFanoutNums != NULL )
+    if ( p->vFanoutOffs != NULL )
     {
         for ( i = 0; i < nFanins; i++ )
             if ( CountMax < pFaninCounts[i] || (CountMax == pFaninCounts[i] && (Gia_ObjFanoutNumId(p, iFanMax) < Gia_ObjFanoutNumId(p, pFanins[i]))) )
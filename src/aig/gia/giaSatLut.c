@@ -70,6 +70,7 @@ struct Sbl_Man_t_
     // timing 
     Vec_Int_t *    vArrs;        // arrival times  
     Vec_Int_t *    vReqs;        // required times  
+    Gia_Sta_t *    pSta;         // incremental timing of the mapping
     Vec_Wec_t *    vWindow;      // fanins of each node in the window
     Vec_Int_t *    vPath;        // critical path (as SAT variables)
     Vec_Int_t *    vEdges;       // fanin edges
@@ -180,8 +181,6 @@ void Sbl_ManClean( Sbl_Man_t * p )
     Vec_IntClear( p->vRoots );
     Vec_IntClear( p->vRootVars );
     // timing
-    Vec_IntClear( p->vArrs );
-    Vec_IntClear( p->vReqs );
     Vec_WecClear( p->vWindow );
     Vec_IntClear( p->vPath );
     Vec_IntClear( p->vEdges );
@@ -221,6 +220,8 @@ void Sbl_ManStop( Sbl_Man_t * p )
     // timing
     Vec_IntFree( p->vArrs );
     Vec_IntFree( p->vReqs );
+    if ( p->pSta )
+        Gia_StaStop( p->pSta );
     Vec_WecFree( p->vWindow );
     Vec_IntFree( p->vPath );
     Vec_IntFree( p->vEdges );
@@ -448,7 +449,9 @@ int Sbl_ManEvaluateMappingEdge( Sbl_Man_t * p, int DelayGlo )
   Synopsis    [Given mapping in p->vSolCur, check the critical path.]
 
   Description [Returns 1 if the mapping satisfies the timing. Returns 0, 
-  if the critical path is detected.]
+  if the critical path is detected. When the incremental timing engine
+  is used, only the arrival times of the window leaves are read from it,
+  instead of recomputing the timing of the whole mapping.]
                
   SideEffects []
 
@@ -467,12 +470,20 @@ int Sbl_ManEvaluateMapping( Sbl_Man_t * p, int DelayGlo )
 {
     abctime clk = Abc_Clock();
     Vec_Int_t * vFanins;
-    int i, iLut = -1, iAnd, Delay, Required;
+    int i, iLut = -1, iAnd, Delay, Required, DelaySta = 0, DelayMax = DelayGlo;
     if ( p->pGia->vEdge1 )
         return Sbl_ManEvaluateMappingEdge( p, DelayGlo );
     Vec_IntClear( p->vPath );
     // derive timing
-    Sbl_ManCreateTiming( p, DelayGlo );
+    if ( p->pSta )
+    {
+        DelaySta = (int)Gia_StaUpdate( p->pSta );
+        DelayMax = Abc_MaxInt( DelayGlo, DelaySta );
+        Vec_IntForEachEntry( p->vLeaves, iLut, i )
+            Vec_IntWriteEntry( p->vArrs, iLut, (int)Gia_StaArrival(p->pSta, iLut) );
+    }
+    else
+        Sbl_ManCreateTiming( p, DelayGlo );
     // update new timing
     Sbl_ManGetCurrentMapping( p );
     Vec_IntForEachEntry( p->vAnds, iLut, i )
@@ -485,7 +496,13 @@ int Sbl_ManEvaluateMapping( Sbl_Man_t * p, int DelayGlo )
     Vec_IntForEachEntry( p->vRoots, iLut, i )
     {
         Delay    = Vec_IntEntry( p->vArrs, iLut );
-        Required = Vec_IntEntry( p->vReqs, iLut );
+        if ( p->pSta )
+        {
+            float tRequired = Gia_StaRequired( p->pSta, iLut );
+            Required = tRequired == ABC_INFINITY ? ABC_INFINITY : (int)tRequired + DelayMax - DelaySta;
+        }
+        else
+            Required = Vec_IntEntry( p->vReqs, iLut );
         if ( Delay > Required ) // updated timing exceeded original timing
             break;
     }
@@ -1150,6 +1167,12 @@ int Sbl_ManTestSat( Sbl_Man_t * p, int iPivot )
             nDelayCur = Gia_ManEvalEdgeDelay( p->pGia );
             nEdgesCur = Gia_ManEvalEdgeCount( p->pGia );
         }
+        else if ( p->pSta )
+        {
+            Vec_IntForEachEntry( p->vAnds, Root, i )
+                Gia_StaSetFanins( p->pSta, Root, Gia_ObjLutFanins2(p->pGia, Root) );
+            nDelayCur = Abc_MaxInt( p->DelayMax, (int)Gia_StaUpdate(p->pSta) );
+        }
         else
             nDelayCur = Sbl_ManCreateTiming( p, p->DelayMax );
         if ( p->fVerbose )
@@ -1199,6 +1222,12 @@ void Gia_ManLutSat( Gia_Man_t * pGia, int LutSize, int nNumber, int nImproves, i
         p->DelayMax = Gia_ManEvalEdgeDelay( pGia );
     // iterate through the internal nodes
     Gia_ManComputeOneWinStart( pGia, nNumber, fReverse );
+    // the timing is updated incrementally after each change of the mapping
+    if ( fDelay && !pGia->vEdge1 && (pGia->pManTime == NULL || Tim_ManBoxNum((Tim_Man_t*)pGia->pManTime) == 0) )
+    {
+        p->pSta = Gia_StaStart( pGia, NULL, NULL, 0 );
+        Vec_IntFill( p->vArrs, Gia_ManObjNum(pGia), 0 );
+    }
     Gia_ManForEachLut2( pGia, iLut )
     {
         if ( Sbl_ManTestSat( p, iLut ) != 2 )
@@ -96,12 +96,14 @@ void Gia_ManSatokoReport( int iOutput, int status, abctime clk )
 
     Abc_PrintTime( 1, "Time", clk );
 }
-satoko_t * Gia_ManSatokoFromDimacs( char * pFileName, satoko_opts_t * opts )
+satoko_t * Gia_ManSatokoFromDimacs( char * pFileName, satoko_opts_t * opts, char * pProof, int fBinary )
 {
     satoko_t * pSat = satoko_create();
     char * pBuffer = Extra_FileReadContents( pFileName );
     Vec_Int_t * vLits = Vec_IntAlloc( 100 );
     char * pTemp; int fComp, Var, VarMax = 0;
+    if ( pProof )
+        satoko_proof_start( pSat, pProof, fBinary );
     for ( pTemp = pBuffer; *pTemp; pTemp++ )
     {
         if ( *pTemp == 'c' || *pTemp == 'p' ) 
@@ -145,17 +147,28 @@ satoko_t * Gia_ManSatokoFromDimacs( char * pFileName, satoko_opts_t * opts )
     Vec_IntFree( vLits );
     return pSat;
 }
-void Gia_ManSatokoDimacs( char * pFileName, satoko_opts_t * opts )
+void Gia_ManSatokoCheck( char * pFileCnf, char * pProof, int fVerbose )
+{
+    int RetValue = satoko_drat_check( pFileCnf, pProof, fVerbose );
+    if ( RetValue == 1 )
+        Abc_Print( 1, "The DRAT proof \"%s\" is verified.\n", pProof );
+    else if ( RetValue == 0 )
+        Abc_Print( 1, "The DRAT proof \"%s\" is NOT verified.\n", pProof );
+}
+void Gia_ManSatokoDimacs( char * pFileName, satoko_opts_t * opts, char * pProof, int fBinary, int fCheck )
 {
     abctime clk = Abc_Clock();  
     int status = SATOKO_UNSAT;
-    satoko_t * pSat = Gia_ManSatokoFromDimacs( pFileName, opts );
+    satoko_t * pSat = Gia_ManSatokoFromDimacs( pFileName, opts, pProof, fBinary );
     if ( pSat )
     {
         status = satoko_solve( pSat );
+        satoko_proof_stop( pSat );
         satoko_destroy( pSat );
     }
     Gia_ManSatokoReport( -1, status, Abc_Clock() - clk );
+    if ( pProof && fCheck && status == SATOKO_UNSAT )
+        Gia_ManSatokoCheck( pFileName, pProof, opts->verbose );
 }
 
 /**Function*************************************************************
@@ -169,10 +182,12 @@ void Gia_ManSatokoDimacs( char * pFileName, satoko_opts_t * opts )
   SeeAlso     []
 
 ***********************************************************************/
-satoko_t * Gia_ManSatokoInit( Cnf_Dat_t * pCnf, satoko_opts_t * opts )
+satoko_t * Gia_ManSatokoInitProof( Cnf_Dat_t * pCnf, satoko_opts_t * opts, char * pProof, int fBinary )
 {
     satoko_t * pSat = satoko_create();
     int i;
+    if ( pProof )
+        satoko_proof_start( pSat, pProof, fBinary );
     //sat_solver_setnvars( pSat, p->nVars );
     for ( i = 0; i < pCnf->nClauses; i++ )
     {
@@ -185,6 +200,10 @@ satoko_t * Gia_ManSatokoInit( Cnf_Dat_t * pCnf, satoko_opts_t * opts )
     satoko_configure(pSat, opts);
     return pSat;
 }
+satoko_t * Gia_ManSatokoInit( Cnf_Dat_t * pCnf, satoko_opts_t * opts )
+{
+    return Gia_ManSatokoInitProof( pCnf, opts, NULL, 0 );
+}
 satoko_t * Gia_ManSatokoCreate( Gia_Man_t * p, satoko_opts_t * opts )
 {
     Cnf_Dat_t * pCnf = (Cnf_Dat_t *)Mf_ManGenerateCnf( p, 8, 0, 1, 0, 0 );
@@ -211,6 +230,53 @@ int Gia_ManSatokoCallOne( Gia_Man_t * p, satoko_opts_t * opts, int iOutput )
     Gia_ManSatokoReport( iOutput, status, Abc_Clock() - clk );
     return Cost;
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the AIG while writing the DRAT proof.]
+
+  Description [The CNF that the proof refers to is written into file
+  "<pProof>.cnf", so that the proof can be checked independently.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSatokoCallProof( Gia_Man_t * p, satoko_opts_t * opts, char * pProof, int fBinary, int fCheck )
+{
+    abctime clk = Abc_Clock();
+    Cnf_Dat_t * pCnf = (Cnf_Dat_t *)Mf_ManGenerateCnf( p, 8, 0, 1, 0, 0 );
+    char * pFileCnf = ABC_ALLOC( char, strlen(pProof) + 5 );
+    satoko_t * pSat;
+    int status = SATOKO_UNSAT;
+    sprintf( pFileCnf, "%s.cnf", pProof );
+    Cnf_DataWriteIntoFile( pCnf, pFileCnf, 0, NULL, NULL );
+    pSat = Gia_ManSatokoInitProof( pCnf, opts, pProof, fBinary );
+    if ( pSat )
+    {
+        status = satoko_solve( pSat );
+        satoko_proof_stop( pSat );
+        satoko_destroy( pSat );
+    }
+    Cnf_DataFree( pCnf );
+    Gia_ManSatokoReport( -1, status, Abc_Clock() - clk );
+    if ( fCheck && status == SATOKO_UNSAT )
+        Gia_ManSatokoCheck( pFileCnf, pProof, opts->verbose );
+    ABC_FREE( pFileCnf );
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
 void Gia_ManSatokoCall( Gia_Man_t * p, satoko_opts_t * opts, int fSplit, int fIncrem )
 {
     int fUseCone = 1;
@@ -173,6 +173,7 @@ void Gia_ManSimSetDefaultParams( Gia_ParSim_t * p )
     p->fCheckMiter  =   0;    // check if miter outputs are non-zero 
     p->fVerbose     =   0;    // enables verbose output
     p->iOutFail     =  -1;    // index of the failed output
+    p->nThreads     =   1;    // the number of threads
 }
 
 /**Function*************************************************************
@@ -346,12 +347,12 @@ static inline void Gia_ManSimInfoCopy( Gia_ManSim_t * p, unsigned * pInfo, unsig
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManSimulateCi( Gia_ManSim_t * p, Gia_Obj_t * pObj, int iCi )
+static inline void Gia_ManSimulateCi( Gia_ManSim_t * p, Gia_Obj_t * pObj, int iCi, int wStart, int wStop )
 {
     unsigned * pInfo  = Gia_SimData( p, Gia_ObjValue(pObj) );
     unsigned * pInfo0 = Gia_SimDataCi( p, iCi );
     int w;
-    for ( w = p->nWords-1; w >= 0; w-- )
+    for ( w = wStop-1; w >= wStart; w-- )
         pInfo[w] = pInfo0[w];
 }
 
@@ -366,16 +367,21 @@ static inline void Gia_ManSimulateCi( Gia_ManSim_t * p, Gia_Obj_t * pObj, int iC
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManSimulateCo( Gia_ManSim_t * p, int iCo, Gia_Obj_t * pObj )
+static inline void Gia_ManSimulateCo( Gia_ManSim_t * p, int iCo, Gia_Obj_t * pObj, int wStart, int wStop )
 {
     unsigned * pInfo  = Gia_SimDataCo( p, iCo );
     unsigned * pInfo0 = Gia_SimData( p, Gia_ObjDiff0(pObj) );
     int w;
+    if ( ((p->nWords | wStart | wStop) & 1) == 0 ) // use 64-bit SIMD kernels
+    {
+        Gia_ManSimdCopy( (word *)(pInfo + wStart), (word *)(pInfo0 + wStart), Gia_ObjFaninC0(pObj) ? ~(word)0 : 0, (wStop - wStart)/2 );
+        return;
+    }
     if ( Gia_ObjFaninC0(pObj) )
-        for ( w = p->nWords-1; w >= 0; w-- )
+        for ( w = wStop-1; w >= wStart; w-- )
             pInfo[w] = ~pInfo0[w];
     else 
-        for ( w = p->nWords-1; w >= 0; w-- )
+        for ( w = wStop-1; w >= wStart; w-- )
             pInfo[w] = pInfo0[w];
 }
 
@@ -390,28 +396,33 @@ static inline void Gia_ManSimulateCo( Gia_ManSim_t * p, int iCo, Gia_Obj_t * pOb
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManSimulateNode( Gia_ManSim_t * p, Gia_Obj_t * pObj )
+static inline void Gia_ManSimulateNode( Gia_ManSim_t * p, Gia_Obj_t * pObj, int wStart, int wStop )
 {
     unsigned * pInfo  = Gia_SimData( p, Gia_ObjValue(pObj) );
     unsigned * pInfo0 = Gia_SimData( p, Gia_ObjDiff0(pObj) );
     unsigned * pInfo1 = Gia_SimData( p, Gia_ObjDiff1(pObj) );
     int w;
+    if ( ((p->nWords | wStart | wStop) & 1) == 0 ) // use 64-bit SIMD kernels
+    {
+        Gia_ManSimdAnd( (word *)(pInfo + wStart), (word *)(pInfo0 + wStart), (word *)(pInfo1 + wStart), Gia_ObjFaninC0(pObj) ? ~(word)0 : 0, Gia_ObjFaninC1(pObj) ? ~(word)0 : 0, (wStop - wStart)/2 );
+        return;
+    }
     if ( Gia_ObjFaninC0(pObj) )
     {
         if (  Gia_ObjFaninC1(pObj) )
-            for ( w = p->nWords-1; w >= 0; w-- )
+            for ( w = wStop-1; w >= wStart; w-- )
                 pInfo[w] = ~(pInfo0[w] | pInfo1[w]);
         else 
-            for ( w = p->nWords-1; w >= 0; w-- )
+            for ( w = wStop-1; w >= wStart; w-- )
                 pInfo[w] = ~pInfo0[w] & pInfo1[w];
     }
     else 
     {
         if (  Gia_ObjFaninC1(pObj) )
-            for ( w = p->nWords-1; w >= 0; w-- )
+            for ( w = wStop-1; w >= wStart; w-- )
                 pInfo[w] = pInfo0[w] & ~pInfo1[w];
         else 
-            for ( w = p->nWords-1; w >= 0; w-- )
+            for ( w = wStop-1; w >= wStart; w-- )
                 pInfo[w] = pInfo0[w] & pInfo1[w];
     }
 }
@@ -473,34 +484,40 @@ void Gia_ManSimInfoTransfer( Gia_ManSim_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_ManSimulateRound( Gia_ManSim_t * p )
+static void Gia_ManSimulateBlock( void * pArg, int wStart, int wStop )
 {
+    Gia_ManSim_t * p = (Gia_ManSim_t *)pArg;
     Gia_Obj_t * pObj;
     int i, iCis = 0, iCos = 0;
-    assert( p->pAig->nFront > 0 );
-    assert( Gia_ManConst0(p->pAig)->Value == 0 );
-    Gia_ManSimInfoZero( p, Gia_SimData(p, 0) );
     Gia_ManForEachObj1( p->pAig, pObj, i )
     {
         if ( Gia_ObjIsAndOrConst0(pObj) )
         {
             assert( Gia_ObjValue(pObj) < p->pAig->nFront );
-            Gia_ManSimulateNode( p, pObj );
+            Gia_ManSimulateNode( p, pObj, wStart, wStop );
         }
         else if ( Gia_ObjIsCo(pObj) )
         {
             assert( Gia_ObjValue(pObj) == GIA_NONE );
-            Gia_ManSimulateCo( p, iCos++, pObj );
+            Gia_ManSimulateCo( p, iCos++, pObj, wStart, wStop );
         }
         else // if ( Gia_ObjIsCi(pObj) )
         {
             assert( Gia_ObjValue(pObj) < p->pAig->nFront );
-            Gia_ManSimulateCi( p, pObj, iCis++ );
+            Gia_ManSimulateCi( p, pObj, iCis++, wStart, wStop );
         }
     }
     assert( Gia_ManCiNum(p->pAig) == iCis );
     assert( Gia_ManCoNum(p->pAig) == iCos );
 }
+void Gia_ManSimulateRound( Gia_ManSim_t * p )
+{
+    assert( p->pAig->nFront > 0 );
+    assert( Gia_ManConst0(p->pAig)->Value == 0 );
+    Gia_ManSimInfoZero( p, Gia_SimData(p, 0) );
+    // the words are split into blocks of whole cache lines simulated by separate threads
+    Gia_ManSimBlocksRun( p->nWords, 16, Abc_MaxInt(p->pPars->nThreads, 1), Gia_ManSimulateBlock, p );
+}
 
 /**Function*************************************************************
 
@@ -601,7 +618,8 @@ int Gia_ManSimSimulate( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
     extern int Gia_ManSimSimulateEquiv( Gia_Man_t * pAig, Gia_ParSim_t * pPars );
     Gia_ManSim_t * p;
     abctime clkTotal = Abc_Clock();
-    int i, iOut, iPat, RetValue = 0;
+    abctime clkWall = Abc_ClockWall();
+    int i, iOut, iPat, nRounds = 0, RetValue = 0;
     abctime nTimeToStop = pPars->TimeLimit ? pPars->TimeLimit * CLOCKS_PER_SEC + Abc_Clock(): 0;
     if ( pAig->pReprs && pAig->pNexts )
         return Gia_ManSimSimulateEquiv( pAig, pPars );
@@ -612,6 +630,7 @@ int Gia_ManSimSimulate( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
     for ( i = 0; i < pPars->nIters; i++ )
     {
         Gia_ManSimulateRound( p );
+        nRounds++;
         if ( pPars->fVerbose )
         {
             Abc_Print( 1, "Frame %4d out of %4d and timeout %3d sec. ", i+1, pPars->nIters, pPars->TimeLimit );
@@ -651,6 +670,14 @@ int Gia_ManSimSimulate( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
     if ( pAig->pCexSeq == NULL )
         Abc_Print( 1, "No bug detected after simulating %d frames with %d words.  ", i, pPars->nWords );
     Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
+    if ( pPars->fVerbose )
+    {
+        double Time = 1.0*(Abc_ClockWall() - clkWall)/CLOCKS_PER_SEC;
+        double nPats = 32.0 * pPars->nWords * nRounds;
+        Abc_Print( 1, "Simulated %.0f patterns (%d words x %d frames) using %s kernels: %.2f M patterns/sec, %.2f G node-patterns/sec.\n", 
+            nPats, pPars->nWords, nRounds, Gia_ManSimdName(), 
+            Time > 0 ? nPats / Time / 1000000 : 0.0, Time > 0 ? nPats * Gia_ManAndNum(pAig) / Time / 1000000000 : 0.0 );
+    }
     return RetValue;
 }
 
@@ -21,8 +21,17 @@
 #include "gia.h"
 #include "misc/util/utilTruth.h"
 #include "misc/extra/extra.h"
-//#include <immintrin.h>
 #include "aig/miniaig/miniaig.h"
+#include "misc/util/utilPool.h"
+
+// SIMD kernels are compiled with function-level target attributes and
+// selected at runtime, so the rest of the code base needs no special flags
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__)) && !defined(ABC_NO_SIMD)
+#define GIA_SIMD_X86
+#include <immintrin.h>
+#define GIA_SIMD_AVX2    __attribute__((target("avx2")))
+#define GIA_SIMD_AVX512  __attribute__((target("avx512f")))
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -67,10 +76,264 @@ struct Gia_SimAbsMan_t_
     Vec_Int_t *    vTtMints;      // truth table minterms
 };
 
+// SIMD kernel in use (-1 = not detected yet, 0 = scalar, 1 = AVX2, 2 = AVX-512)
+static int s_GiaSimdLevel = -1;
+
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/**Function*************************************************************
+
+  Synopsis    [Selects the SIMD kernels supported by this CPU.]
+
+  Description [Level 0 is scalar code, level 1 is AVX2, level 2 is
+  AVX-512. Setting a level higher than supported has no effect.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_ManSimdDetect()
+{
+    int Level = 0;
+#ifdef GIA_SIMD_X86
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports("avx512f") )
+        Level = 2;
+    else if ( __builtin_cpu_supports("avx2") )
+        Level = 1;
+#endif
+    return Level;
+}
+int Gia_ManSimdLevel()
+{
+    if ( s_GiaSimdLevel < 0 )
+        s_GiaSimdLevel = Gia_ManSimdDetect();
+    return s_GiaSimdLevel;
+}
+void Gia_ManSimdSetLevel( int Level )
+{
+    s_GiaSimdLevel = Abc_MaxInt( 0, Abc_MinInt(Level, Gia_ManSimdDetect()) );
+}
+char * Gia_ManSimdName()
+{
+    char * pNames[3] = { "scalar", "AVX2", "AVX-512" };
+    return pNames[Gia_ManSimdLevel()];
+}
+
+/**Function*************************************************************
+
+  Synopsis    [AVX2 and AVX-512 kernels.]
+
+  Description [Complemented inputs are represented by masks (0 or ~0)
+  XOR-ed with the data. The leftover words are processed by scalar code.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef GIA_SIMD_X86
+
+#define GIA_LD256(p)       _mm256_loadu_si256( (__m256i const *)(p) )
+#define GIA_ST256(p, v)    _mm256_storeu_si256( (__m256i *)(p), v )
+#define GIA_LD512(p)       _mm512_loadu_si512( (void const *)(p) )
+#define GIA_ST512(p, v)    _mm512_storeu_si512( (void *)(p), v )
+
+GIA_SIMD_AVX2 static void Gia_ManSimdAnd256( word * pOut, word * p0, word * p1, word Diff0, word Diff1, int nWords )
+{
+    __m256i M0 = _mm256_set1_epi64x( (long long)Diff0 );
+    __m256i M1 = _mm256_set1_epi64x( (long long)Diff1 );
+    int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+        GIA_ST256( pOut + w, _mm256_and_si256( _mm256_xor_si256(GIA_LD256(p0 + w), M0), _mm256_xor_si256(GIA_LD256(p1 + w), M1) ) );
+    for ( ; w < nWords; w++ )
+        pOut[w] = (p0[w] ^ Diff0) & (p1[w] ^ Diff1);
+}
+GIA_SIMD_AVX2 static void Gia_ManSimdXor256( word * pOut, word * p0, word * p1, word Diff, int nWords )
+{
+    __m256i M = _mm256_set1_epi64x( (long long)Diff );
+    int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+        GIA_ST256( pOut + w, _mm256_xor_si256( _mm256_xor_si256(GIA_LD256(p0 + w), GIA_LD256(p1 + w)), M ) );
+    for ( ; w < nWords; w++ )
+        pOut[w] = p0[w] ^ p1[w] ^ Diff;
+}
+GIA_SIMD_AVX2 static void Gia_ManSimdMux256( word * pOut, word * pC, word * p1, word * p0, word DiffC, word Diff1, word Diff0, int nWords )
+{
+    __m256i MC = _mm256_set1_epi64x( (long long)DiffC );
+    __m256i M1 = _mm256_set1_epi64x( (long long)Diff1 );
+    __m256i M0 = _mm256_set1_epi64x( (long long)Diff0 );
+    __m256i C;
+    int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+    {
+        C = _mm256_xor_si256( GIA_LD256(pC + w), MC );
+        GIA_ST256( pOut + w, _mm256_or_si256( _mm256_and_si256(C, _mm256_xor_si256(GIA_LD256(p1 + w), M1)), 
+                                              _mm256_andnot_si256(C, _mm256_xor_si256(GIA_LD256(p0 + w), M0)) ) );
+    }
+    for ( ; w < nWords; w++ )
+        pOut[w] = ((pC[w] ^ DiffC) & (p1[w] ^ Diff1)) | (~(pC[w] ^ DiffC) & (p0[w] ^ Diff0));
+}
+GIA_SIMD_AVX2 static void Gia_ManSimdCopy256( word * pOut, word * p0, word Diff0, int nWords )
+{
+    __m256i M0 = _mm256_set1_epi64x( (long long)Diff0 );
+    int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+        GIA_ST256( pOut + w, _mm256_xor_si256(GIA_LD256(p0 + w), M0) );
+    for ( ; w < nWords; w++ )
+        pOut[w] = p0[w] ^ Diff0;
+}
+GIA_SIMD_AVX2 static int Gia_ManSimdEqual256( word * p0, word * p1, int nWords )
+{
+    __m256i X;
+    int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+    {
+        X = _mm256_xor_si256( GIA_LD256(p0 + w), GIA_LD256(p1 + w) );
+        if ( !_mm256_testz_si256(X, X) )
+            return 0;
+    }
+    for ( ; w < nWords; w++ )
+        if ( p0[w] != p1[w] )
+            return 0;
+    return 1;
+}
+
+GIA_SIMD_AVX512 static void Gia_ManSimdAnd512( word * pOut, word * p0, word * p1, word Diff0, word Diff1, int nWords )
+{
+    __m512i M0 = _mm512_set1_epi64( (long long)Diff0 );
+    __m512i M1 = _mm512_set1_epi64( (long long)Diff1 );
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+        GIA_ST512( pOut + w, _mm512_and_si512( _mm512_xor_si512(GIA_LD512(p0 + w), M0), _mm512_xor_si512(GIA_LD512(p1 + w), M1) ) );
+    for ( ; w < nWords; w++ )
+        pOut[w] = (p0[w] ^ Diff0) & (p1[w] ^ Diff1);
+}
+GIA_SIMD_AVX512 static void Gia_ManSimdXor512( word * pOut, word * p0, word * p1, word Diff, int nWords )
+{
+    __m512i M = _mm512_set1_epi64( (long long)Diff );
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+        GIA_ST512( pOut + w, _mm512_ternarylogic_epi64( GIA_LD512(p0 + w), GIA_LD512(p1 + w), M, 0x96 ) ); // A ^ B ^ C
+    for ( ; w < nWords; w++ )
+        pOut[w] = p0[w] ^ p1[w] ^ Diff;
+}
+GIA_SIMD_AVX512 static void Gia_ManSimdMux512( word * pOut, word * pC, word * p1, word * p0, word DiffC, word Diff1, word Diff0, int nWords )
+{
+    __m512i MC = _mm512_set1_epi64( (long long)DiffC );
+    __m512i M1 = _mm512_set1_epi64( (long long)Diff1 );
+    __m512i M0 = _mm512_set1_epi64( (long long)Diff0 );
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+        GIA_ST512( pOut + w, _mm512_ternarylogic_epi64( _mm512_xor_si512(GIA_LD512(pC + w), MC), 
+                                                        _mm512_xor_si512(GIA_LD512(p1 + w), M1), 
+                                                        _mm512_xor_si512(GIA_LD512(p0 + w), M0), 0xCA ) ); // A ? B : C
+    for ( ; w < nWords; w++ )
+        pOut[w] = ((pC[w] ^ DiffC) & (p1[w] ^ Diff1)) | (~(pC[w] ^ DiffC) & (p0[w] ^ Diff0));
+}
+GIA_SIMD_AVX512 static void Gia_ManSimdCopy512( word * pOut, word * p0, word Diff0, int nWords )
+{
+    __m512i M0 = _mm512_set1_epi64( (long long)Diff0 );
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+        GIA_ST512( pOut + w, _mm512_xor_si512(GIA_LD512(p0 + w), M0) );
+    for ( ; w < nWords; w++ )
+        pOut[w] = p0[w] ^ Diff0;
+}
+GIA_SIMD_AVX512 static int Gia_ManSimdEqual512( word * p0, word * p1, int nWords )
+{
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+        if ( _mm512_cmpneq_epi64_mask( GIA_LD512(p0 + w), GIA_LD512(p1 + w) ) )
+            return 0;
+    for ( ; w < nWords; w++ )
+        if ( p0[w] != p1[w] )
+            return 0;
+    return 1;
+}
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Word-parallel simulation kernels.]
+
+  Description [Compute AND, XOR, MUX and (complemented) copy of the
+  simulation info. Input complementation is given by masks Diff (0 or ~0).
+  Short vectors are processed by scalar code.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSimdAnd( word * pOut, word * p0, word * p1, word Diff0, word Diff1, int nWords )
+{
+    int w;
+#ifdef GIA_SIMD_X86
+    if ( nWords >= 8 && Gia_ManSimdLevel() == 2 )
+        { Gia_ManSimdAnd512( pOut, p0, p1, Diff0, Diff1, nWords ); return; }
+    if ( nWords >= 4 && Gia_ManSimdLevel() >= 1 )
+        { Gia_ManSimdAnd256( pOut, p0, p1, Diff0, Diff1, nWords ); return; }
+#endif
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = (p0[w] ^ Diff0) & (p1[w] ^ Diff1);
+}
+void Gia_ManSimdXor( word * pOut, word * p0, word * p1, word Diff, int nWords )
+{
+    int w;
+#ifdef GIA_SIMD_X86
+    if ( nWords >= 8 && Gia_ManSimdLevel() == 2 )
+        { Gia_ManSimdXor512( pOut, p0, p1, Diff, nWords ); return; }
+    if ( nWords >= 4 && Gia_ManSimdLevel() >= 1 )
+        { Gia_ManSimdXor256( pOut, p0, p1, Diff, nWords ); return; }
+#endif
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = p0[w] ^ p1[w] ^ Diff;
+}
+void Gia_ManSimdMux( word * pOut, word * pC, word * p1, word * p0, word DiffC, word Diff1, word Diff0, int nWords )
+{
+    int w;
+#ifdef GIA_SIMD_X86
+    if ( nWords >= 8 && Gia_ManSimdLevel() == 2 )
+        { Gia_ManSimdMux512( pOut, pC, p1, p0, DiffC, Diff1, Diff0, nWords ); return; }
+    if ( nWords >= 4 && Gia_ManSimdLevel() >= 1 )
+        { Gia_ManSimdMux256( pOut, pC, p1, p0, DiffC, Diff1, Diff0, nWords ); return; }
+#endif
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = ((pC[w] ^ DiffC) & (p1[w] ^ Diff1)) | (~(pC[w] ^ DiffC) & (p0[w] ^ Diff0));
+}
+void Gia_ManSimdCopy( word * pOut, word * p0, word Diff0, int nWords )
+{
+    int w;
+#ifdef GIA_SIMD_X86
+    if ( nWords >= 8 && Gia_ManSimdLevel() == 2 )
+        { Gia_ManSimdCopy512( pOut, p0, Diff0, nWords ); return; }
+    if ( nWords >= 4 && Gia_ManSimdLevel() >= 1 )
+        { Gia_ManSimdCopy256( pOut, p0, Diff0, nWords ); return; }
+#endif
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = p0[w] ^ Diff0;
+}
+int Gia_ManSimdEqual( word * p0, word * p1, int nWords )
+{
+    int w;
+#ifdef GIA_SIMD_X86
+    if ( nWords >= 8 && Gia_ManSimdLevel() == 2 )
+        return Gia_ManSimdEqual512( p0, p1, nWords );
+    if ( nWords >= 4 && Gia_ManSimdLevel() >= 1 )
+        return Gia_ManSimdEqual256( p0, p1, nWords );
+#endif
+    for ( w = 0; w < nWords; w++ )
+        if ( p0[w] != p1[w] )
+            return 0;
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -90,37 +353,42 @@ void Gia_ManSimPatAssignInputs( Gia_Man_t * p, int nWords, Vec_Wrd_t * vSims, Ve
     Gia_ManForEachCiId( p, Id, i )
         memcpy( Vec_WrdEntryP(vSims, Id*nWords), Vec_WrdEntryP(vSimsIn, i*nWords), sizeof(word)*nWords );
 }
-static inline void Gia_ManSimPatSimAnd( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims )
+// simulates nBlock words of each object starting at pSims, where consecutive objects are nWords apart
+static inline void Gia_ManSimPatSimAndBlock( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, word * pSims, int nBlock )
 {
     word pComps[2] = { 0, ~(word)0 };
     word Diff0 = pComps[Gia_ObjFaninC0(pObj)];
     word Diff1 = pComps[Gia_ObjFaninC1(pObj)];
-    word * pSims  = Vec_WrdArray(vSims);
     word * pSims0 = pSims + nWords*Gia_ObjFaninId0(pObj, i);
     word * pSims1 = pSims + nWords*Gia_ObjFaninId1(pObj, i);
-    word * pSims2 = pSims + nWords*i; int w;
-    if ( Gia_ObjIsXor(pObj) )
-        for ( w = 0; w < nWords; w++ )
-            pSims2[w] = (pSims0[w] ^ Diff0) ^ (pSims1[w] ^ Diff1);
+    word * pSims2 = pSims + nWords*i;
+    if ( Gia_ObjIsMux(p, pObj) )
+        Gia_ManSimdMux( pSims2, pSims + nWords*Gia_ObjFaninId2(p, i), pSims1, pSims0, pComps[Gia_ObjFaninC2(p, pObj)], Diff1, Diff0, nBlock );
+    else if ( Gia_ObjIsXor(pObj) )
+        Gia_ManSimdXor( pSims2, pSims0, pSims1, Diff0 ^ Diff1, nBlock );
     else
-        for ( w = 0; w < nWords; w++ )
-            pSims2[w] = (pSims0[w] ^ Diff0) & (pSims1[w] ^ Diff1);
+        Gia_ManSimdAnd( pSims2, pSims0, pSims1, Diff0, Diff1, nBlock );
 }
-static inline void Gia_ManSimPatSimPo( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims )
+static inline void Gia_ManSimPatSimPoBlock( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, word * pSims, int nBlock )
 {
     word pComps[2] = { 0, ~(word)0 };
     word Diff0     = pComps[Gia_ObjFaninC0(pObj)];
-    word * pSims   = Vec_WrdArray(vSims);
     word * pSims0  = pSims + nWords*Gia_ObjFaninId0(pObj, i);
-    word * pSims2  = pSims + nWords*i; int w;
-    for ( w = 0; w < nWords; w++ )
-        pSims2[w]  = (pSims0[w] ^ Diff0);
+    word * pSims2  = pSims + nWords*i;
+    Gia_ManSimdCopy( pSims2, pSims0, Diff0, nBlock );
+}
+static inline void Gia_ManSimPatSimAnd( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims )
+{
+    Gia_ManSimPatSimAndBlock( p, i, pObj, nWords, Vec_WrdArray(vSims), nWords );
+}
+static inline void Gia_ManSimPatSimPo( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims )
+{
+    Gia_ManSimPatSimPoBlock( p, i, pObj, nWords, Vec_WrdArray(vSims), nWords );
 }
 static inline void Gia_ManSimPatSimNot( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims )
 {
-    word * pSims   = Vec_WrdArray(vSims) + nWords*i; int w;
-    for ( w = 0; w < nWords; w++ )
-        pSims[w]   = ~pSims[w];
+    word * pSims   = Vec_WrdArray(vSims) + nWords*i;
+    Gia_ManSimdCopy( pSims, pSims, ~(word)0, nWords );
 }
 Vec_Wrd_t * Gia_ManSimPatSim( Gia_Man_t * pGia )
 {
@@ -154,6 +422,110 @@ Vec_Wrd_t * Gia_ManSimPatSimOut( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi, int fOut
     Vec_WrdFree( vSims );
     return vSimsCo;
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Runs a simulation callback on blocks of pattern words.]
+
+  Description [Splits the words 0..nWords-1 into at most nThreads contiguous
+  blocks whose boundaries are multiples of nAlign and calls pFunc on each
+  block using the thread pool. The callback may only write the words of its
+  own block, so the blocks need no synchronization and the result does not
+  depend on the number of threads. Returns the number of blocks.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Gia_SimBlock_t_ Gia_SimBlock_t;
+struct Gia_SimBlock_t_
+{
+    Gia_SimBlockFunc_t pFunc;
+    void *             pArg;
+    int                wStart;
+    int                wStop;
+};
+static void * Gia_ManSimBlockTask( void * pArg )
+{
+    Gia_SimBlock_t * pBlock = (Gia_SimBlock_t *)pArg;
+    pBlock->pFunc( pBlock->pArg, pBlock->wStart, pBlock->wStop );
+    return NULL;
+}
+int Gia_ManSimBlocksRun( int nWords, int nAlign, int nThreads, Gia_SimBlockFunc_t pFunc, void * pArg )
+{
+    Gia_SimBlock_t pBlocks[ABC_POOL_THR_MAX];
+    Abc_Task_t * pTasks[ABC_POOL_THR_MAX];
+    int nUnits  = (nWords + nAlign - 1) / nAlign;
+    int b, nBlocks = Abc_MinInt( Abc_MinInt(nThreads, nUnits), ABC_POOL_THR_MAX );
+    if ( nBlocks <= 1 )
+    {
+        pFunc( pArg, 0, nWords );
+        return 1;
+    }
+    for ( b = 0; b < nBlocks; b++ )
+    {
+        pBlocks[b].pFunc  = pFunc;
+        pBlocks[b].pArg   = pArg;
+        pBlocks[b].wStart = Abc_MinInt( nWords, nAlign * (int)((word)nUnits * b / nBlocks) );
+        pBlocks[b].wStop  = Abc_MinInt( nWords, nAlign * (int)((word)nUnits * (b+1) / nBlocks) );
+    }
+    for ( b = 1; b < nBlocks; b++ )
+        pTasks[b] = Abc_TaskStart( Abc_PoolGlobal(), Gia_ManSimBlockTask, pBlocks + b );
+    Gia_ManSimBlockTask( pBlocks );
+    for ( b = 1; b < nBlocks; b++ )
+    {
+        Abc_TaskWait( pTasks[b] );
+        Abc_TaskFree( pTasks[b] );
+    }
+    return nBlocks;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Multi-threaded version of Gia_ManSimPatSimOut().]
+
+  Description [Each thread simulates all objects in the topological order
+  for its own block of pattern words. Returns the same simulation info
+  as the single-threaded version.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Gia_SimPatMt_t_ Gia_SimPatMt_t;
+struct Gia_SimPatMt_t_
+{
+    Gia_Man_t *    pGia;
+    Vec_Wrd_t *    vSimsPi;
+    Vec_Wrd_t *    vSims;
+    int            nWords;
+};
+static void Gia_ManSimPatSimBlock( void * pArg, int wStart, int wStop )
+{
+    Gia_SimPatMt_t * p = (Gia_SimPatMt_t *)pArg;
+    word * pSims = Vec_WrdArray(p->vSims) + wStart;
+    int i, Id, nBlock = wStop - wStart;
+    Gia_Obj_t * pObj;
+    Gia_ManForEachCiId( p->pGia, Id, i )
+        memcpy( pSims + p->nWords*Id, Vec_WrdEntryP(p->vSimsPi, i*p->nWords + wStart), sizeof(word)*nBlock );
+    Gia_ManForEachAnd( p->pGia, pObj, i )
+        Gia_ManSimPatSimAndBlock( p->pGia, i, pObj, p->nWords, pSims, nBlock );
+    Gia_ManForEachCo( p->pGia, pObj, i )
+        Gia_ManSimPatSimPoBlock( p->pGia, Gia_ObjId(p->pGia, pObj), pObj, p->nWords, pSims, nBlock );
+}
+Vec_Wrd_t * Gia_ManSimPatSimMt( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi, int nThreads )
+{
+    Gia_SimPatMt_t Data, * p = &Data;
+    assert( Vec_WrdSize(vSimsPi) % Gia_ManCiNum(pGia) == 0 );
+    p->pGia    = pGia;
+    p->vSimsPi = vSimsPi;
+    p->nWords  = Vec_WrdSize(vSimsPi) / Gia_ManCiNum(pGia);
+    p->vSims   = Vec_WrdStart( Gia_ManObjNum(pGia) * p->nWords );
+    Gia_ManSimBlocksRun( p->nWords, 8, nThreads, Gia_ManSimPatSimBlock, p );
+    return p->vSims;
+}
 static inline void Gia_ManSimPatSimAnd3( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims, Vec_Wrd_t * vSimsC )
 {
     word pComps[2] = { ~(word)0, 0 };
@@ -432,7 +804,7 @@ int Gia_ManComparePair( Gia_Man_t * p, Vec_Wrd_t * vSims, int iOut, int nWords2
     word * pSim1 = Vec_WrdEntryP( vSims, nWords2*Gia_ObjId(p, pObj1) );
     Gia_ManSimPatSimPo( p, Gia_ObjId(p, pObj0), pObj0, nWords2, vSims );
     Gia_ManSimPatSimPo( p, Gia_ObjId(p, pObj1), pObj1, nWords2, vSims );
-    return Abc_TtEqual( pSim0, pSim1, nWords2 );
+    return Gia_ManSimdEqual( pSim0, pSim1, nWords2 );
 }
 int Gia_ManCheckSimEquiv( Gia_Man_t * p, int fVerbose )
 {
@@ -522,18 +894,10 @@ static inline void Gia_ManSimPatSimAnd2( Gia_Man_t * p, int i, Gia_Obj_t * pObj,
     word * pSims0 = pSims + nWords*Gia_ObjFaninLit0(pObj, i);
     word * pSims1 = pSims + nWords*Gia_ObjFaninLit1(pObj, i);
     word * pSims2 = pSims + nWords*(2*i+0); 
-    word * pSims3 = pSims + nWords*(2*i+1); int w;
+    word * pSims3 = pSims + nWords*(2*i+1);
     assert( !Gia_ObjIsXor(pObj) );
-//    if ( Gia_ObjIsXor(pObj) )
-//        for ( w = 0; w < nWords; w++ )
-//            pSims2[w] = pSims0[w] ^ pSims1[w];
-//    else
-    for ( w = 0; w < nWords; w++ )
-    {
-        pSims2[w] = pSims0[w] & pSims1[w];
-        pSims3[w] = ~pSims2[w];
-    }
-    //_mm256_storeu_ps( (float *)pSims2, _mm256_and_ps(_mm256_loadu_ps((float *)pSims0), _mm256_loadu_ps((float *)pSims1)) );
+    Gia_ManSimdAnd( pSims2, pSims0, pSims1, 0, 0, nWords );
+    Gia_ManSimdCopy( pSims3, pSims2, ~(word)0, nWords );
 }
 static inline void Gia_ManSimPatSimPo2( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims )
 {
@@ -803,7 +1167,7 @@ void Gia_ManPatSatImprove( Gia_Man_t * p, int nWords0, int fVerbose )
   SeeAlso     []
 
 ***********************************************************************/
-Gia_SimRsbMan_t * Gia_SimRsbAlloc( Gia_Man_t * pGia )
+Gia_SimRsbMan_t * Gia_SimRsbAlloc( Gia_Man_t * pGia, int nThreads )
 {
     Gia_SimRsbMan_t * p = ABC_CALLOC( Gia_SimRsbMan_t, 1 );
     p->pGia      = pGia;
@@ -815,7 +1179,7 @@ Gia_SimRsbMan_t * Gia_SimRsbAlloc( Gia_Man_t * pGia )
     p->vCands    = Vec_IntAlloc( 1000 );
     p->vFanins   = Vec_IntAlloc( 10 );
     p->vFanins2  = Vec_IntAlloc( 10 );
-    p->vSimsObj  = Gia_ManSimPatSim( pGia );
+    p->vSimsObj  = Gia_ManSimPatSimMt( pGia, pGia->vSimsPi, nThreads );
     p->vSimsObj2 = Vec_WrdStart( Vec_WrdSize(p->vSimsObj) );
     assert( p->nWords == Vec_WrdSize(p->vSimsObj) / Gia_ManObjNum(pGia) );
     Gia_ManStaticFanoutStart( pGia );
@@ -933,13 +1297,11 @@ static inline void Gia_SimRsbSimAndCareSet( Gia_Man_t * p, int i, Gia_Obj_t * pO
     Vec_Wrd_t * vSims1 = Gia_ObjIsTravIdCurrentId(p, Gia_ObjFaninId1(pObj, i)) ? vSims2 : vSims;
     word * pSims0 = Vec_WrdEntryP( vSims0, nWords*Gia_ObjFaninId0(pObj, i) );
     word * pSims1 = Vec_WrdEntryP( vSims1, nWords*Gia_ObjFaninId1(pObj, i) );
-    word * pSims2 = Vec_WrdEntryP( vSims2, nWords*i ); int w;
+    word * pSims2 = Vec_WrdEntryP( vSims2, nWords*i );
     if ( Gia_ObjIsXor(pObj) )
-        for ( w = 0; w < nWords; w++ )
-            pSims2[w] = (pSims0[w] ^ Diff0) ^ (pSims1[w] ^ Diff1);
+        Gia_ManSimdXor( pSims2, pSims0, pSims1, Diff0 ^ Diff1, nWords );
     else
-        for ( w = 0; w < nWords; w++ )
-            pSims2[w] = (pSims0[w] ^ Diff0) & (pSims1[w] ^ Diff1);
+        Gia_ManSimdAnd( pSims2, pSims0, pSims1, Diff0, Diff1, nWords );
 }
 word * Gia_SimRsbCareSet( Gia_SimRsbMan_t * p, int iObj, Vec_Int_t * vTfo )
 {
@@ -1056,11 +1418,11 @@ Extra_PrintBinary( stdout, (unsigned *)p->pFunc[1], 64 );  printf( "\n" );
     return RetValue;
 }
 
-int Gia_ManSimRsb( Gia_Man_t * pGia, int nCands, int fVerbose )
+int Gia_ManSimRsb( Gia_Man_t * pGia, int nCands, int nThreads, int fVerbose )
 {
     abctime clk = Abc_Clock();
     Gia_Obj_t * pObj; int iObj, nCount = 0, nBufs = 0, nInvs = 0;
-    Gia_SimRsbMan_t * p = Gia_SimRsbAlloc( pGia );
+    Gia_SimRsbMan_t * p = Gia_SimRsbAlloc( pGia, nThreads );
     assert( pGia->vSimsPi != NULL );
     Gia_ManLevelNum( pGia );
     Gia_ManForEachAnd( pGia, pObj, iObj )
@@ -244,6 +244,16 @@ float Gia_ManDelayTraceLut( Gia_Man_t * p )
         return -TIM_ETERNITY;
     }
 
+    // without boxes, use the timing engine
+    if ( p->pManTime == NULL )
+    {
+        Gia_Sta_t * pSta = Gia_StaStartLut( p );
+        tArrival = Gia_StaUpdate( pSta );
+        Gia_StaTransferTiming( pSta );
+        Gia_StaStop( pSta );
+        return tArrival;
+    }
+
     // initialize the arrival times
     Gia_ManTimeStart( p );
     Gia_ManLevelNum( p );
@@ -444,7 +454,8 @@ int Gia_LutVerifyTiming(  Gia_Man_t * p )
 float Gia_ManDelayTraceLutPrint( Gia_Man_t * p, int fVerbose )
 {
     If_LibLut_t * pLutLib = (If_LibLut_t *)p->pLutLib;
-    int i, Nodes, * pCounters;
+    Vec_Int_t * vCounters;
+    int i, Nodes;
     float tArrival, tDelta, nSteps, Num;
     // get the library
     if ( pLutLib && pLutLib->LutMax < Gia_ManLutSizeMax(p) )
@@ -455,21 +466,32 @@ float Gia_ManDelayTraceLutPrint( Gia_Man_t * p, int fVerbose )
     }
     // decide how many steps
     nSteps = pLutLib ? 20 : Gia_ManLutLevel(p, NULL);
-    pCounters = ABC_ALLOC( int, nSteps + 1 );
-    memset( pCounters, 0, sizeof(int)*(nSteps + 1) );
-    // perform delay trace
-    tArrival = Gia_ManDelayTraceLut( p );
-    tDelta   = tArrival / nSteps;
-    // count how many nodes have slack in the corresponding intervals
-    Gia_ManForEachLut( p, i )
+    if ( p->pManTime == NULL )
     {
-        if ( Gia_ObjLutSize(p, i) == 0 )
-            continue;
-        Num = Gia_ObjTimeSlack(p, i) / tDelta;
-        if ( Num > nSteps )
-            continue;
-        assert( Num >=0 && Num <= nSteps );
-        pCounters[(int)Num]++;
+        // without boxes, use the slack histogram of the timing engine
+        Gia_Sta_t * pSta = Gia_StaStartLut( p );
+        tArrival  = Gia_StaUpdate( pSta );
+        vCounters = Gia_StaSlackHistogram( pSta, (int)nSteps );
+        Gia_StaStop( pSta );
+    }
+    else
+    {
+        vCounters = Vec_IntStart( (int)nSteps + 1 );
+        // perform delay trace
+        tArrival = Gia_ManDelayTraceLut( p );
+        tDelta   = tArrival / nSteps;
+        // count how many nodes have slack in the corresponding intervals
+        Gia_ManForEachLut( p, i )
+        {
+            if ( Gia_ObjLutSize(p, i) == 0 )
+                continue;
+            Num = Gia_ObjTimeSlack(p, i) / tDelta;
+            if ( Num > nSteps )
+                continue;
+            assert( Num >=0 && Num <= nSteps );
+            Vec_IntAddToEntry( vCounters, (int)Num, 1 );
+        }
+        Gia_ManTimeStop( p );
     }
     // print the results    
     if ( fVerbose )
@@ -478,13 +500,12 @@ float Gia_ManDelayTraceLutPrint( Gia_Man_t * p, int fVerbose )
         Nodes = 0;
         for ( i = 0; i < nSteps; i++ )
         {
-            Nodes += pCounters[i];
+            Nodes += Vec_IntEntry( vCounters, i );
             printf( "%3d %s : %5d  (%6.2f %%)\n", pLutLib? 5*(i+1) : i+1, 
                 pLutLib? "%":"lev", Nodes, 100.0*Nodes/Gia_ManLutNum(p) );
         }
     }
-    ABC_FREE( pCounters );
-    Gia_ManTimeStop( p );
+    Vec_IntFree( vCounters );
     return tArrival;
 }
 
@@ -0,0 +1,792 @@
+/**CFile****************************************************************
+
+  FileName    [giaSta.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Incremental static timing analysis.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: giaSta.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+#include "map/if/if.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The timing graph contains the CIs, the COs, and the LUTs of the mapping.
+// For each object, the engine keeps the arrival time and the tail, which is
+// the longest delay from the object to a CO. The required time is the max
+// delay minus the tail, so a change of the max delay does not require any
+// backward propagation. After a LUT is changed or its delay is updated, the
+// arrival times are propagated forward through the changed fanout cone,
+// level by level, and the tails are propagated backward through the changed
+// fanin cone. The objects are visited only if their timing may change.
+// The fanouts are kept in the static fanout of the mapping, which is patched
+// in place when the fanins of a LUT change. The engine owns this fanout and
+// swaps it into the AIG while it works, so that the AIG may have its own
+// static fanout at the same time (for example, in the SAT-based remapping).
+
+#define GIA_STA_NONE  (-TIM_ETERNITY)   // the tail of an object not reaching a CO
+
+struct Gia_Sta_t_
+{
+    Gia_Man_t *      pGia;        // the mapped AIG
+    Gia_StaDelay_f   pFuncDelay;  // the delay model
+    void *           pUser;       // the data of the delay model
+    int              fSortPins;   // the latest arriving fanin uses the first pin
+    Vec_Wec_t *      vFanins;     // the fanins of the objects
+    Vec_Int_t *      vFanoutOffs; // the static fanout of the mapping (offsets and counts)
+    Vec_Int_t *      vFanout;     // the static fanout of the mapping (fanout IDs)
+    int              nFanoutFree; // the static fanout of the mapping (unused entries)
+    Vec_Int_t *      vLevels;     // the levels (fanins have smaller levels)
+    Vec_Flt_t *      vArrs;       // the arrival times
+    Vec_Flt_t *      vTails;      // the longest delays to the COs
+    Vec_Str_t *      vDirty;      // the dirty bits (1 = arrival, 2 = tail)
+    Vec_Wec_t *      vQueueA;     // the arrival queue (by level)
+    Vec_Wec_t *      vQueueR;     // the tail queue (by level)
+    Vec_Int_t *      vSeeds;      // the objects whose tails may change
+    int              iLevelA;     // the smallest level in the arrival queue
+    float            tMax;        // the max delay
+    int              fMaxDirty;   // the max delay should be recomputed
+    int              nVisitsA;    // the arrival times computed
+    int              nVisitsR;    // the tails computed
+};
+
+static inline float  Gia_StaArr( Gia_Sta_t * p, int iObj )     { return Vec_FltEntry(p->vArrs, iObj);   }
+static inline float  Gia_StaTail( Gia_Sta_t * p, int iObj )    { return Vec_FltEntry(p->vTails, iObj);  }
+static inline int    Gia_StaLevel( Gia_Sta_t * p, int iObj )   { return Vec_IntEntry(p->vLevels, iObj); }
+static inline int    Gia_StaIsCo( Gia_Sta_t * p, int iObj )    { return Gia_ObjIsCo(Gia_ManObj(p->pGia, iObj)); }
+
+static inline void   Gia_StaSwapFanout( Gia_Sta_t * p )
+{
+    ABC_SWAP( Vec_Int_t *, p->vFanoutOffs, p->pGia->vFanoutOffs );
+    ABC_SWAP( Vec_Int_t *, p->vFanout,     p->pGia->vFanout );
+    ABC_SWAP( int,         p->nFanoutFree, p->pGia->nFanoutFree );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [The delay model of the LUT library.]
+
+  Description [Uses the unit-delay model if the library is not given.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static float Gia_StaDelayLut( void * pUser, int iObj, int iPin, int nPins )
+{
+    If_LibLut_t * pLutLib = (If_LibLut_t *)pUser;
+    if ( pLutLib == NULL )
+        return 1.0;
+    return pLutLib->pLutDelays[nPins][pLutLib->fVarPinDelays ? iPin : 0];
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the pin used by the given fanin.]
+
+  Description [When the pins are sorted, the fanins are assigned to the
+  pins in the decreasing order of their arrival times.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_StaPin( Gia_Sta_t * p, Vec_Int_t * vFanins, int k )
+{
+    int i, j, best_i, temp, pPinPerm[32];
+    if ( !p->fSortPins )
+        return k;
+    assert( Vec_IntSize(vFanins) <= 32 );
+    for ( i = 0; i < Vec_IntSize(vFanins); i++ )
+        pPinPerm[i] = i;
+    // the same selection sort as in Gia_LutDelayTraceSortPins()
+    for ( i = 0; i < Vec_IntSize(vFanins)-1; i++ )
+    {
+        best_i = i;
+        for ( j = i+1; j < Vec_IntSize(vFanins); j++ )
+            if ( Gia_StaArr(p, Vec_IntEntry(vFanins, pPinPerm[j])) > Gia_StaArr(p, Vec_IntEntry(vFanins, pPinPerm[best_i])) )
+                best_i = j;
+        temp = pPinPerm[i];
+        pPinPerm[i] = pPinPerm[best_i];
+        pPinPerm[best_i] = temp;
+        if ( pPinPerm[i] == k )
+            return i;
+    }
+    assert( pPinPerm[i] == k );
+    return i;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the arrival time and the tail of the object.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static float Gia_StaComputeArrival( Gia_Sta_t * p, int iObj )
+{
+    Vec_Int_t * vFanins = Vec_WecEntry( p->vFanins, iObj );
+    float tArr, tRes = -TIM_ETERNITY;
+    int k, iFanin;
+    if ( Vec_IntSize(vFanins) == 0 )
+        return Gia_ObjIsCi(Gia_ManObj(p->pGia, iObj)) ? Gia_StaArr(p, iObj) : 0.0;
+    if ( Gia_StaIsCo(p, iObj) )
+        return Gia_StaArr( p, Vec_IntEntry(vFanins, 0) );
+    Vec_IntForEachEntry( vFanins, iFanin, k )
+    {
+        tArr = Gia_StaArr(p, iFanin) + p->pFuncDelay( p->pUser, iObj, Gia_StaPin(p, vFanins, k), Vec_IntSize(vFanins) );
+        if ( tRes < tArr )
+            tRes = tArr;
+    }
+    return tRes;
+}
+static float Gia_StaComputeTail( Gia_Sta_t * p, int iObj )
+{
+    Vec_Int_t * vFanins;
+    float tTail, tRes = GIA_STA_NONE;
+    int k, iFanout;
+    if ( Gia_StaIsCo(p, iObj) )
+        return 0.0;
+    Gia_ObjForEachFanoutStaticId( p->pGia, iObj, iFanout, k )
+    {
+        if ( Gia_StaIsCo(p, iFanout) )
+            tTail = 0.0;
+        else if ( Gia_StaTail(p, iFanout) == GIA_STA_NONE )
+            continue;
+        else
+        {
+            vFanins = Vec_WecEntry( p->vFanins, iFanout );
+            tTail = Gia_StaTail(p, iFanout) + p->pFuncDelay( p->pUser, iFanout, Gia_StaPin(p, vFanins, Vec_IntFind(vFanins, iObj)), Vec_IntSize(vFanins) );
+        }
+        if ( tRes < tTail )
+            tRes = tTail;
+    }
+    return tRes;
+}
+static int Gia_StaComputeLevel( Gia_Sta_t * p, int iObj )
+{
+    int k, iFanin, Level = 0;
+    Vec_IntForEachEntry( Vec_WecEntry(p->vFanins, iObj), iFanin, k )
+        Level = Abc_MaxInt( Level, Gia_StaLevel(p, iFanin) + 1 );
+    return Level;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the objects to the update queues.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_StaPushArrival( Gia_Sta_t * p, int iObj, int fForce )
+{
+    int Level = Gia_StaLevel( p, iObj );
+    if ( !fForce && (Vec_StrEntry(p->vDirty, iObj) & 1) )
+        return;
+    Vec_StrWriteEntry( p->vDirty, iObj, (char)(Vec_StrEntry(p->vDirty, iObj) | 1) );
+    Vec_WecPush( p->vQueueA, Level, iObj );
+    p->iLevelA = Abc_MinInt( p->iLevelA, Level );
+}
+static inline void Gia_StaPushTail( Gia_Sta_t * p, int iObj )
+{
+    if ( Vec_StrEntry(p->vDirty, iObj) & 2 )
+        return;
+    Vec_StrWriteEntry( p->vDirty, iObj, (char)(Vec_StrEntry(p->vDirty, iObj) | 2) );
+    Vec_IntPush( p->vSeeds, iObj );
+}
+static inline void Gia_StaPushFaninTails( Gia_Sta_t * p, int iObj )
+{
+    int k, iFanin;
+    Vec_IntForEachEntry( Vec_WecEntry(p->vFanins, iObj), iFanin, k )
+        Gia_StaPushTail( p, iFanin );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the timing engine.]
+
+  Description [The delay model returns the delay from the given pin of
+  the object with the given number of pins to its output. If the delay
+  model is not given, the unit-delay model is used. If fSortPins is set,
+  the latest arriving fanin is assigned to pin 0, and so on. The mapping
+  is taken from pGia->vMapping if present, or else from pGia->vMapping2.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Sta_t * Gia_StaStart( Gia_Man_t * pGia, Gia_StaDelay_f pFuncDelay, void * pUser, int fSortPins )
+{
+    Gia_Sta_t * p;
+    Gia_Obj_t * pObj;
+    Vec_Int_t * vFanins;
+    int i, k, iFanin;
+    assert( Gia_ManHasMapping(pGia) || Gia_ManHasMapping2(pGia) );
+    p = ABC_CALLOC( Gia_Sta_t, 1 );
+    p->pGia       = pGia;
+    p->pFuncDelay = pFuncDelay ? pFuncDelay : Gia_StaDelayLut;
+    p->pUser      = pUser;
+    p->fSortPins  = fSortPins;
+    p->vFanins    = Vec_WecStart( Gia_ManObjNum(pGia) );
+    p->vLevels    = Vec_IntStart( Gia_ManObjNum(pGia) );
+    p->vArrs      = Vec_FltStart( Gia_ManObjNum(pGia) );
+    p->vTails     = Vec_FltAlloc( Gia_ManObjNum(pGia) );
+    p->vDirty     = Vec_StrStart( Gia_ManObjNum(pGia) );
+    p->vQueueA    = Vec_WecAlloc( 100 );
+    p->vQueueR    = Vec_WecAlloc( 100 );
+    p->vSeeds     = Vec_IntAlloc( 100 );
+    p->iLevelA    = ABC_INFINITY;
+    Vec_FltFill( p->vTails, Gia_ManObjNum(pGia), GIA_STA_NONE );
+    // create the timing graph
+    if ( Gia_ManHasMapping(pGia) )
+    {
+        Gia_ManForEachLut( pGia, i )
+        {
+            vFanins = Vec_WecEntry( p->vFanins, i );
+            Gia_LutForEachFanin( pGia, i, iFanin, k )
+                Vec_IntPush( vFanins, iFanin );
+        }
+    }
+    else
+    {
+        Gia_ManForEachLut2( pGia, i )
+            Vec_IntAppend( Vec_WecEntry(p->vFanins, i), Gia_ObjLutFanins2(pGia, i) );
+    }
+    Gia_ManForEachCo( pGia, pObj, i )
+        Vec_WecPush( p->vFanins, Gia_ObjId(pGia, pObj), Gia_ObjFaninId0p(pGia, pObj) );
+    Gia_StaSwapFanout( p );
+    Gia_ManStaticMappingFanoutStart( pGia, NULL );
+    // compute the timing from scratch
+    Gia_ManForEachObj( pGia, pObj, i )
+    {
+        if ( Vec_IntSize(Vec_WecEntry(p->vFanins, i)) == 0 )
+            continue;
+        Vec_IntWriteEntry( p->vLevels, i, Gia_StaComputeLevel(p, i) );
+        Vec_FltWriteEntry( p->vArrs, i, Gia_StaComputeArrival(p, i) );
+    }
+    Gia_ManForEachObjReverse( pGia, pObj, i )
+        if ( Gia_ObjIsCo(pObj) || Gia_ObjFanoutNumId(pGia, i) > 0 )
+            Vec_FltWriteEntry( p->vTails, i, Gia_StaComputeTail(p, i) );
+    Gia_StaSwapFanout( p );
+    p->fMaxDirty = 1;
+    return p;
+}
+Gia_Sta_t * Gia_StaStartLut( Gia_Man_t * pGia )
+{
+    If_LibLut_t * pLutLib = (If_LibLut_t *)pGia->pLutLib;
+    return Gia_StaStart( pGia, Gia_StaDelayLut, pLutLib, pLutLib && pLutLib->fVarPinDelays );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the timing engine.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_StaStop( Gia_Sta_t * p )
+{
+    Vec_WecFree( p->vFanins );
+    Vec_IntFreeP( &p->vFanoutOffs );
+    Vec_IntFreeP( &p->vFanout );
+    Vec_IntFree( p->vLevels );
+    Vec_FltFree( p->vArrs );
+    Vec_FltFree( p->vTails );
+    Vec_StrFree( p->vDirty );
+    Vec_WecFree( p->vQueueA );
+    Vec_WecFree( p->vQueueR );
+    Vec_IntFree( p->vSeeds );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the changes of the network.]
+
+  Description [Gia_StaSetFanins() is called after the LUT rooted in iObj
+  has been replaced by a LUT with the given fanins (the empty array
+  removes the LUT). Gia_StaUpdateDelay() is called after the delay model
+  of the object has changed, for example, after a cell swap. The changes
+  are propagated by the next call to Gia_StaUpdate().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_StaSetFanins( Gia_Sta_t * p, int iObj, Vec_Int_t * vFaninsNew )
+{
+    Vec_Int_t * vFanins = Vec_WecEntry( p->vFanins, iObj );
+    int k, iFanin;
+    assert( !Gia_StaIsCo(p, iObj) && !Gia_ObjIsCi(Gia_ManObj(p->pGia, iObj)) );
+    Gia_StaSwapFanout( p );
+    Vec_IntForEachEntry( vFanins, iFanin, k )
+    {
+        Gia_ObjRemoveFanoutStatic( p->pGia, iFanin, iObj );
+        Gia_StaPushTail( p, iFanin );
+    }
+    Vec_IntClear( vFanins );
+    Vec_IntForEachEntry( vFaninsNew, iFanin, k )
+    {
+        assert( iFanin != iObj );
+        Vec_IntPush( vFanins, iFanin );
+        Gia_ObjAddFanoutStatic( p->pGia, iFanin, iObj );
+        Gia_StaPushTail( p, iFanin );
+    }
+    Gia_StaSwapFanout( p );
+    Gia_StaPushArrival( p, iObj, 1 );
+}
+void Gia_StaUpdateDelay( Gia_Sta_t * p, int iObj )
+{
+    Gia_StaPushFaninTails( p, iObj );
+    Gia_StaPushArrival( p, iObj, 0 );
+}
+void Gia_StaSetCiArrival( Gia_Sta_t * p, int iObj, float tArr )
+{
+    int k, iFanout;
+    assert( Gia_ObjIsCi(Gia_ManObj(p->pGia, iObj)) );
+    if ( Gia_StaArr(p, iObj) == tArr )
+        return;
+    Vec_FltWriteEntry( p->vArrs, iObj, tArr );
+    Gia_StaSwapFanout( p );
+    Gia_ObjForEachFanoutStaticId( p->pGia, iObj, iFanout, k )
+    {
+        Gia_StaPushArrival( p, iFanout, 0 );
+        if ( p->fSortPins && !Gia_StaIsCo(p, iFanout) )
+            Gia_StaPushFaninTails( p, iFanout );
+    }
+    Gia_StaSwapFanout( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Propagates the arrival times through the changed cone.]
+
+  Description [The levels are updated on the fly. They never decrease,
+  so the fanouts are always added to the queue above the current level.
+  When the level of an object grows, it is added to the queue again at
+  the new level and its earlier entry is skipped.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_StaPropagateArrivals( Gia_Sta_t * p )
+{
+    float tOld, tNew;
+    int Level, LevelNew, i, k, iObj, iFanout;
+    for ( Level = p->iLevelA; Level < Vec_WecSize(p->vQueueA); Level++ )
+    {
+        // the queue may be reallocated while the level is processed
+        for ( i = 0; i < Vec_IntSize(Vec_WecEntry(p->vQueueA, Level)); i++ )
+        {
+            iObj = Vec_IntEntry( Vec_WecEntry(p->vQueueA, Level), i );
+            if ( Gia_StaLevel(p, iObj) != Level || !(Vec_StrEntry(p->vDirty, iObj) & 1) )
+                continue;
+            Vec_StrWriteEntry( p->vDirty, iObj, (char)(Vec_StrEntry(p->vDirty, iObj) & ~1) );
+            p->nVisitsA++;
+            LevelNew = Abc_MaxInt( Level, Gia_StaComputeLevel(p, iObj) );
+            Vec_IntWriteEntry( p->vLevels, iObj, LevelNew );
+            tOld = Gia_StaArr( p, iObj );
+            tNew = Gia_StaComputeArrival( p, iObj );
+            Vec_FltWriteEntry( p->vArrs, iObj, tNew );
+            Gia_ObjForEachFanoutStaticId( p->pGia, iObj, iFanout, k )
+            {
+                if ( Gia_StaLevel(p, iFanout) <= LevelNew )
+                {
+                    Vec_IntWriteEntry( p->vLevels, iFanout, LevelNew + 1 );
+                    Gia_StaPushArrival( p, iFanout, 1 );
+                }
+                else if ( tOld != tNew )
+                    Gia_StaPushArrival( p, iFanout, 0 );
+                // the pin assignment of the fanout may change
+                if ( tOld != tNew && p->fSortPins && !Gia_StaIsCo(p, iFanout) )
+                    Gia_StaPushFaninTails( p, iFanout );
+            }
+            if ( tOld == tNew || !Gia_StaIsCo(p, iObj) || p->fMaxDirty )
+                continue;
+            if ( p->tMax <= tNew )
+                p->tMax = tNew;
+            else if ( p->tMax == tOld )
+                p->fMaxDirty = 1;
+        }
+        Vec_IntClear( Vec_WecEntry(p->vQueueA, Level) );
+    }
+    p->iLevelA = ABC_INFINITY;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Propagates the tails through the changed cone.]
+
+  Description [Should be called after the arrival times are propagated,
+  so that the levels do not change.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_StaPropagateTails( Gia_Sta_t * p )
+{
+    float tNew;
+    int Level, i, k, iObj, iFanin;
+    Vec_IntForEachEntry( p->vSeeds, iObj, i )
+        Vec_WecPush( p->vQueueR, Gia_StaLevel(p, iObj), iObj );
+    Vec_IntClear( p->vSeeds );
+    for ( Level = Vec_WecSize(p->vQueueR) - 1; Level >= 0; Level-- )
+    {
+        Vec_IntForEachEntry( Vec_WecEntry(p->vQueueR, Level), iObj, i )
+        {
+            assert( Gia_StaLevel(p, iObj) == Level );
+            Vec_StrWriteEntry( p->vDirty, iObj, (char)(Vec_StrEntry(p->vDirty, iObj) & ~2) );
+            p->nVisitsR++;
+            tNew = Gia_StaComputeTail( p, iObj );
+            if ( tNew == Gia_StaTail(p, iObj) )
+                continue;
+            Vec_FltWriteEntry( p->vTails, iObj, tNew );
+            Vec_IntForEachEntry( Vec_WecEntry(p->vFanins, iObj), iFanin, k )
+            {
+                assert( Gia_StaLevel(p, iFanin) < Level );
+                if ( Vec_StrEntry(p->vDirty, iFanin) & 2 )
+                    continue;
+                Vec_StrWriteEntry( p->vDirty, iFanin, (char)(Vec_StrEntry(p->vDirty, iFanin) | 2) );
+                Vec_WecPush( p->vQueueR, Gia_StaLevel(p, iFanin), iFanin );
+            }
+        }
+        Vec_IntClear( Vec_WecEntry(p->vQueueR, Level) );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Propagates the changes and returns the max delay.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+float Gia_StaUpdate( Gia_Sta_t * p )
+{
+    Gia_Obj_t * pObj;
+    int i;
+    Gia_StaSwapFanout( p );
+    if ( p->iLevelA < ABC_INFINITY )
+        Gia_StaPropagateArrivals( p );
+    if ( Vec_IntSize(p->vSeeds) > 0 )
+        Gia_StaPropagateTails( p );
+    Gia_StaSwapFanout( p );
+    if ( p->fMaxDirty )
+    {
+        p->tMax = -TIM_ETERNITY;
+        Gia_ManForEachCo( p->pGia, pObj, i )
+            p->tMax = Abc_MaxFloat( p->tMax, Gia_StaArr(p, Gia_ObjId(p->pGia, pObj)) );
+        p->fMaxDirty = 0;
+    }
+    return p->tMax;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the timing of the object.]
+
+  Description [The changes should be propagated by Gia_StaUpdate().
+  The required time is infinite if the object does not reach a CO.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+float Gia_StaArrival( Gia_Sta_t * p, int iObj )
+{
+    return Gia_StaArr( p, iObj );
+}
+float Gia_StaRequired( Gia_Sta_t * p, int iObj )
+{
+    if ( Gia_StaTail(p, iObj) == GIA_STA_NONE )
+        return ABC_INFINITY;
+    return p->tMax - Gia_StaTail(p, iObj);
+}
+float Gia_StaSlack( Gia_Sta_t * p, int iObj )
+{
+    float tSlack = Gia_StaRequired(p, iObj) - Gia_StaArr(p, iObj);
+    assert( tSlack + 0.01 > 0.0 );
+    return tSlack < 0.0 ? 0.0 : tSlack;
+}
+void Gia_StaVisitNum( Gia_Sta_t * p, int * pnVisitsA, int * pnVisitsR )
+{
+    *pnVisitsA = p->nVisitsA;
+    *pnVisitsR = p->nVisitsR;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the slack histogram of the LUTs.]
+
+  Description [Entry i is the number of LUTs whose slack is in
+  [i*Step, (i+1)*Step), where Step is the max delay divided by nSteps.
+  The LUTs whose slack is larger than the max delay are not counted.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Gia_StaSlackHistogram( Gia_Sta_t * p, int nSteps )
+{
+    Vec_Int_t * vCounts = Vec_IntStart( nSteps + 1 );
+    float tDelta = Gia_StaUpdate(p) / nSteps, Num;
+    int i;
+    assert( Gia_ManHasMapping(p->pGia) );
+    Gia_ManForEachLut( p->pGia, i )
+    {
+        if ( Gia_ObjLutSize(p->pGia, i) == 0 )
+            continue;
+        Num = Gia_StaSlack(p, i) / tDelta;
+        if ( Num > nSteps )
+            continue;
+        assert( Num >= 0 && Num <= nSteps );
+        Vec_IntAddToEntry( vCounts, (int)Num, 1 );
+    }
+    return vCounts;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Saves the timing of the mapping in the AIG.]
+
+  Description [Fills in the arrival/required/slack array of the AIG
+  used by the delay-oriented procedures, such as Gia_ManSpeedup().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_StaTransferTiming( Gia_Sta_t * p )
+{
+    Gia_Man_t * pGia = p->pGia;
+    Gia_Obj_t * pObj;
+    int i;
+    assert( Gia_ManHasMapping(pGia) );
+    Gia_StaUpdate( p );
+    if ( pGia->vTiming == NULL )
+        Gia_ManTimeStart( pGia );
+    else
+        Gia_ManTimeClean( pGia );
+    Gia_ManForEachObj( pGia, pObj, i )
+    {
+        if ( !Gia_ObjIsCi(pObj) && !Gia_ObjIsCo(pObj) && !Gia_ObjIsLut(pGia, i) )
+            continue;
+        Gia_ObjSetTimeArrival( pGia, i, Gia_StaArr(p, i) );
+        if ( Gia_StaTail(p, i) == GIA_STA_NONE )
+            continue;
+        Gia_ObjSetTimeRequired( pGia, i, Gia_StaRequired(p, i) );
+        Gia_ObjSetTimeSlack( pGia, i, Gia_StaSlack(p, i) );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Compares the incremental timing with the timing from scratch.]
+
+  Description [Also checks that the patched static fanout lists each
+  fanin edge of the timing graph exactly once. Returns 1 if the timing
+  and the fanout are the same.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_StaVerify( Gia_Sta_t * p )
+{
+    Vec_Flt_t * vArrs  = Vec_FltDup( p->vArrs );
+    Vec_Flt_t * vTails = Vec_FltDup( p->vTails );
+    float tMax = Gia_StaUpdate( p ), tMaxNew = -TIM_ETERNITY;
+    Gia_Obj_t * pObj;
+    int i, k, iFanin, Level, nEdges = 0, nErrors = 0;
+    Gia_StaSwapFanout( p );
+    // check the fanout
+    Gia_ManForEachObj( p->pGia, pObj, i )
+        Vec_IntForEachEntry( Vec_WecEntry(p->vFanins, i), iFanin, k )
+        {
+            int j, iFanout, nFound = 0;
+            Gia_ObjForEachFanoutStaticId( p->pGia, iFanin, iFanout, j )
+                nFound += (iFanout == i);
+            if ( nFound != 1 && nErrors++ < 5 )
+                printf( "Object %d is listed %d times as a fanout of object %d.\n", i, nFound, iFanin );
+            nEdges++;
+        }
+    if ( Vec_IntSize(p->pGia->vFanout) - p->pGia->nFanoutFree != nEdges && nErrors++ < 5 )
+        printf( "The fanout has %d edges instead of %d.\n", Vec_IntSize(p->pGia->vFanout) - p->pGia->nFanoutFree, nEdges );
+    // recompute the timing from scratch in the topological order
+    ABC_SWAP( Vec_Flt_t *, vArrs, p->vArrs );
+    ABC_SWAP( Vec_Flt_t *, vTails, p->vTails );
+    Gia_ManForEachObj( p->pGia, pObj, i )
+    {
+        if ( Vec_IntSize(Vec_WecEntry(p->vFanins, i)) == 0 )
+            continue;
+        Level = Gia_StaComputeLevel( p, i );
+        if ( Level > Gia_StaLevel(p, i) && nErrors++ < 5 )
+            printf( "Object %d has level %d instead of %d.\n", i, Gia_StaLevel(p, i), Level );
+        Vec_FltWriteEntry( p->vArrs, i, Gia_StaComputeArrival(p, i) );
+    }
+    Gia_ManForEachObjReverse( p->pGia, pObj, i )
+        if ( Gia_ObjIsCo(pObj) || Gia_ObjFanoutNumId(p->pGia, i) > 0 )
+            Vec_FltWriteEntry( p->vTails, i, Gia_StaComputeTail(p, i) );
+        else
+            Vec_FltWriteEntry( p->vTails, i, GIA_STA_NONE );
+    Gia_ManForEachCo( p->pGia, pObj, i )
+        tMaxNew = Abc_MaxFloat( tMaxNew, Gia_StaArr(p, Gia_ObjId(p->pGia, pObj)) );
+    ABC_SWAP( Vec_Flt_t *, vArrs, p->vArrs );
+    ABC_SWAP( Vec_Flt_t *, vTails, p->vTails );
+    Gia_StaSwapFanout( p );
+    // compare with the incremental timing
+    for ( i = 0; i < Gia_ManObjNum(p->pGia); i++ )
+    {
+        if ( Vec_FltEntry(vArrs, i) != Vec_FltEntry(p->vArrs, i) && nErrors++ < 5 )
+            printf( "Object %d has arrival %.3f instead of %.3f.\n", i, Vec_FltEntry(vArrs, i), Vec_FltEntry(p->vArrs, i) );
+        if ( Vec_FltEntry(vTails, i) != Vec_FltEntry(p->vTails, i) && nErrors++ < 5 )
+            printf( "Object %d has tail %.3f instead of %.3f.\n", i, Vec_FltEntry(p->vTails, i), Vec_FltEntry(vTails, i) );
+    }
+    if ( tMax != tMaxNew && nErrors++ < 5 )
+        printf( "The max delay is %.3f instead of %.3f.\n", tMax, tMaxNew );
+    Vec_FltFree( vArrs );
+    Vec_FltFree( vTails );
+    return nErrors == 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Testing procedure for the incremental update (&test -C).]
+
+  Description [Performs the given number of random changes of the timing
+  graph: LUTs get new fanins, LUT delays are scaled (as in a cell swap),
+  and CI arrival times are changed. After each change, the incremental
+  timing is compared with the timing from scratch. The mapping of the AIG
+  is not modified. Returns 1 if all comparisons succeeded.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Gia_StaCheck_t_ Gia_StaCheck_t;
+struct Gia_StaCheck_t_
+{
+    If_LibLut_t *    pLutLib;     // the LUT library
+    Vec_Flt_t *      vScales;     // the delay scaling factors of the objects
+};
+static float Gia_StaDelayCheck( void * pUser, int iObj, int iPin, int nPins )
+{
+    Gia_StaCheck_t * pCheck = (Gia_StaCheck_t *)pUser;
+    return Vec_FltEntry(pCheck->vScales, iObj) * Gia_StaDelayLut( pCheck->pLutLib, iObj, iPin, nPins );
+}
+int Gia_StaRandomCheck( Gia_Man_t * pGia, int nChanges )
+{
+    abctime clk = Abc_Clock();
+    Gia_StaCheck_t Check, * pCheck = &Check;
+    Gia_Sta_t * p;
+    Gia_Obj_t * pObj;
+    Vec_Int_t * vObjs   = Vec_IntAlloc( Gia_ManCiNum(pGia) + Gia_ManLutNum(pGia) );
+    Vec_Int_t * vFanins = Vec_IntAlloc( 16 );
+    int nLutSize = Abc_MaxInt( 1, Gia_ManLutSizeMax(pGia) );
+    int i, k, n, iObj, nVisitsA, nVisitsR, RetValue = 1;
+    assert( Gia_ManHasMapping(pGia) );
+    pCheck->pLutLib = (If_LibLut_t *)pGia->pLutLib;
+    pCheck->vScales = Vec_FltAlloc( Gia_ManObjNum(pGia) );
+    Vec_FltFill( pCheck->vScales, Gia_ManObjNum(pGia), 1.0 );
+    p = Gia_StaStart( pGia, Gia_StaDelayCheck, pCheck, 1 );
+    // collect the CIs and the LUTs in the topological order
+    Gia_ManForEachObj( pGia, pObj, i )
+        if ( Gia_ObjIsCi(pObj) || Gia_ObjIsLut(pGia, i) )
+            Vec_IntPush( vObjs, i );
+    Abc_Random( 1 );
+    for ( n = 0; n < nChanges && Vec_IntSize(vObjs) > 0; n++ )
+    {
+        // select an object
+        k = Abc_Random(0) % Vec_IntSize(vObjs);
+        iObj = Vec_IntEntry( vObjs, k );
+        pObj = Gia_ManObj( pGia, iObj );
+        if ( Gia_ObjIsCi(pObj) )
+            Gia_StaSetCiArrival( p, iObj, (float)(Abc_Random(0) % 100) / 20 );
+        else if ( k == 0 || Abc_Random(0) % 2 )
+        {
+            Vec_FltWriteEntry( pCheck->vScales, iObj, (float)(25 + Abc_Random(0) % 100) / 50 );
+            Gia_StaUpdateDelay( p, iObj );
+        }
+        else
+        {
+            // the new fanins precede the LUT in the topological order
+            Vec_IntClear( vFanins );
+            for ( i = 1 + Abc_Random(0) % nLutSize; i > 0; i-- )
+                Vec_IntPushUnique( vFanins, Vec_IntEntry(vObjs, Abc_Random(0) % k) );
+            Gia_StaSetFanins( p, iObj, vFanins );
+        }
+        if ( !Gia_StaVerify( p ) )
+        {
+            printf( "Incremental timing update failed after change %d.\n", n + 1 );
+            RetValue = 0;
+            break;
+        }
+    }
+    Gia_StaVisitNum( p, &nVisitsA, &nVisitsR );
+    printf( "Checked %d random changes. Max delay = %.2f. Visited objects per change: arrival = %.1f  tail = %.1f  (out of %d).  ",
+        n, Gia_StaUpdate(p), n ? 1.0*nVisitsA/n : 0.0, n ? 1.0*nVisitsR/n : 0.0, Vec_IntSize(vObjs) );
+    Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    Gia_StaStop( p );
+    Vec_FltFree( pCheck->vScales );
+    Vec_IntFree( vFanins );
+    Vec_IntFree( vObjs );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -2450,7 +2450,7 @@ Vec_Int_t * Gia_ManComputeDistanceInt( Gia_Man_t * p, int iTarg, Vec_Int_t * vOb
 Vec_Int_t * Gia_ManComputeDistance( Gia_Man_t * p, int iObj, Vec_Int_t * vObjs, int fVerbose )
 {
     Vec_Int_t * vDists;
-    if ( p->vFanoutNums )
+    if ( p->vFanoutOffs )
         vDists = Gia_ManComputeDistanceInt( p, iObj, vObjs, fVerbose );
     else
     {
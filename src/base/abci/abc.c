@@ -422,6 +422,7 @@ static int Abc_CommandAbc9Dfs                ( Abc_Frame_t * pAbc, int argc, cha
 static int Abc_CommandAbc9Sim                ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Sim2               ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Sim3               ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int Abc_CommandAbc9TSim               ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9MLGen              ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9MLTest             ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Iwls21Test         ( Abc_Frame_t * pAbc, int argc, char ** argv );
@@ -541,6 +542,7 @@ static int Abc_CommandAbc9MultiProve         ( Abc_Frame_t * pAbc, int argc, cha
 static int Abc_CommandAbc9SplitProve         ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Bmc                ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9SBmc               ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int Abc_CommandAbc9Portfolio          ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9ChainBmc           ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9BCore              ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9ICheck             ( Abc_Frame_t * pAbc, int argc, char ** argv );
@@ -1181,6 +1183,7 @@ void Abc_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "ABC9",         "&sim",          Abc_CommandAbc9Sim,          0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&sim2",         Abc_CommandAbc9Sim2,         0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&sim3",         Abc_CommandAbc9Sim3,         0 );
+    Cmd_CommandAdd( pAbc, "ABC9",         "&tsim",         Abc_CommandAbc9TSim,         0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&mlgen",        Abc_CommandAbc9MLGen,        0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&mltest",       Abc_CommandAbc9MLTest,       0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&iwls21test",   Abc_CommandAbc9Iwls21Test,   0 );
@@ -1300,6 +1303,7 @@ void Abc_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "ABC9",         "&splitprove",   Abc_CommandAbc9SplitProve,   0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&bmc",          Abc_CommandAbc9Bmc,          0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&bmcs",         Abc_CommandAbc9SBmc,         0 );
+    Cmd_CommandAdd( pAbc, "ABC9",         "&portfolio",    Abc_CommandAbc9Portfolio,    0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&chainbmc",     Abc_CommandAbc9ChainBmc,     0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&bcore",        Abc_CommandAbc9BCore,        0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&icheck",       Abc_CommandAbc9ICheck,       0 );
@@ -24535,7 +24539,7 @@ int Abc_CommandDCec( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fPartition;
     int fMiter;
 
-    extern int Abc_NtkDSat( Abc_Ntk_t * pNtk, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, int nLearnedStart, int nLearnedDelta, int nLearnedPerce, int fAlignPol, int fAndOuts, int fNewSolver, int fVerbose );
+    extern int Abc_NtkDSat( Abc_Ntk_t * pNtk, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, int nLearnedStart, int nLearnedDelta, int nLearnedPerce, int fAlignPol, int fAndOuts, int fNewSolver, int fPreproc, int fVerbose );
     extern int Abc_NtkDarCec( Abc_Ntk_t * pNtk1, Abc_Ntk_t * pNtk2, int nConfLimit, int fPartition, int fVerbose );
 
     pNtk = Abc_FrameReadNtk(pAbc);
@@ -24640,7 +24644,7 @@ int Abc_CommandDCec( Abc_Frame_t * pAbc, int argc, char ** argv )
 
     // perform equivalence checking
     if ( fSat && fMiter )
-        Abc_NtkDSat( pNtk1, nConfLimit, nInsLimit, 0, 0, 0, 0, 0, 0, fVerbose );
+        Abc_NtkDSat( pNtk1, nConfLimit, nInsLimit, 0, 0, 0, 0, 0, 0, 0, fVerbose );
     else
         Abc_NtkDarCec( pNtk1, pNtk2, nConfLimit, fPartition, fVerbose );
 
@@ -25560,6 +25564,7 @@ int Abc_CommandDSat( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fAlignPol;
     int fAndOuts;
     int fNewSolver;
+    int fPreproc;
     int fSilent;
     int fShowPattern;
     int fVerbose;
@@ -25570,11 +25575,12 @@ int Abc_CommandDSat( Abc_Frame_t * pAbc, int argc, char ** argv )
     int nInsLimit;
     abctime clk;
 
-    extern int Abc_NtkDSat( Abc_Ntk_t * pNtk, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, int nLearnedStart, int nLearnedDelta, int nLearnedPerce, int fAlignPol, int fAndOuts, int fNewSolver, int fVerbose );
+    extern int Abc_NtkDSat( Abc_Ntk_t * pNtk, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, int nLearnedStart, int nLearnedDelta, int nLearnedPerce, int fAlignPol, int fAndOuts, int fNewSolver, int fPreproc, int fVerbose );
     // set defaults
     fAlignPol  = 0;
     fAndOuts   = 0;
     fNewSolver = 0;
+    fPreproc   = 0;
     fSilent    = 0;
     fShowPattern = 0;
     fVerbose   = 0;
@@ -25584,7 +25590,7 @@ int Abc_CommandDSat( Abc_Frame_t * pAbc, int argc, char ** argv )
     nLearnedDelta = 0;
     nLearnedPerce = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "CILDEpansvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "CILDEpanesvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -25652,6 +25658,9 @@ int Abc_CommandDSat( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 'n':
             fNewSolver ^= 1;
             break;
+        case 'e':
+            fPreproc ^= 1;
+            break;
         case 's':
             fSilent ^= 1;
             break;
@@ -25716,7 +25725,7 @@ int Abc_CommandDSat( Abc_Frame_t * pAbc, int argc, char ** argv )
         return 0;
     }
     clk = Abc_Clock();
-    RetValue = Abc_NtkDSat( pNtk, (ABC_INT64_T)nConfLimit, (ABC_INT64_T)nInsLimit, nLearnedStart, nLearnedDelta, nLearnedPerce, fAlignPol, fAndOuts, fNewSolver, fVerbose );
+    RetValue = Abc_NtkDSat( pNtk, (ABC_INT64_T)nConfLimit, (ABC_INT64_T)nInsLimit, nLearnedStart, nLearnedDelta, nLearnedPerce, fAlignPol, fAndOuts, fNewSolver, fPreproc, fVerbose );
     // verify that the pattern is correct
     if ( RetValue == 0 && Abc_NtkPoNum(pNtk) == 1 )
     {
@@ -25740,7 +25749,7 @@ int Abc_CommandDSat( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: dsat [-CILDE num] [-pansvh]\n" );
+    Abc_Print( -2, "usage: dsat [-CILDE num] [-panesvh]\n" );
     Abc_Print( -2, "\t         solves the combinational miter using SAT solver MiniSat-1.14\n" );
     Abc_Print( -2, "\t         derives CNF from the current network and leaves it unchanged\n" );
     Abc_Print( -2, "\t-C num : limit on the number of conflicts [default = %d]\n",    nConfLimit );
@@ -25751,6 +25760,7 @@ usage:
     Abc_Print( -2, "\t-p     : align polarity of SAT variables [default = %s]\n", fAlignPol? "yes": "no" );
     Abc_Print( -2, "\t-a     : toggle ANDing/ORing of miter outputs [default = %s]\n", fAndOuts? "ANDing": "ORing" );
     Abc_Print( -2, "\t-n     : toggle using new solver [default = %s]\n", fNewSolver? "yes": "no" );
+    Abc_Print( -2, "\t-e     : toggle preprocessing the CNF (elimination, equivalences, subsumption) [default = %s]\n", fPreproc? "yes": "no" );
     Abc_Print( -2, "\t-s     : enable silent computation (no reporting) [default = %s]\n", fSilent? "yes": "no" );
     Abc_Print( -2, "\t-v     : prints verbose information [default = %s]\n", fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
@@ -25998,14 +26008,17 @@ usage:
 ***********************************************************************/
 int Abc_CommandAbc9Satoko( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
-    extern void Gia_ManSatokoDimacs( char * pFileName, satoko_opts_t * opts );
+    extern void Gia_ManSatokoDimacs( char * pFileName, satoko_opts_t * opts, char * pProof, int fBinary, int fCheck );
     extern void Gia_ManSatokoCall( Gia_Man_t * p, satoko_opts_t * opts, int fSplit, int fIncrem );
-    int c, fSplit = 0, fIncrem = 0;
+    extern void Gia_ManSatokoCallProof( Gia_Man_t * p, satoko_opts_t * opts, char * pProof, int fBinary, int fCheck );
+    extern void Gia_ManSatokoCheck( char * pFileCnf, char * pProof, int fVerbose );
+    int c, fSplit = 0, fIncrem = 0, fText = 0, fCheck = 0;
+    char * pProof = NULL;
 
     satoko_opts_t opts;
     satoko_default_opts(&opts);
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "Csivh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "CDtksivh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -26020,6 +26033,21 @@ int Abc_CommandAbc9Satoko( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( opts.conf_limit < 0 )
                 goto usage;
             break;
+        case 'D':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-D\" should be followed by a file name.\n" );
+                goto usage;
+            }
+            pProof = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
+        case 't':
+            fText ^= 1;
+            break;
+        case 'k':
+            fCheck ^= 1;
+            break;
         case 's':
             fSplit ^= 1;
             break;
@@ -26036,9 +26064,14 @@ int Abc_CommandAbc9Satoko( Abc_Frame_t * pAbc, int argc, char ** argv )
             goto usage;
         }
     }
+    if ( fCheck && pProof == NULL && argc == globalUtilOptind + 2 )
+    {
+        Gia_ManSatokoCheck( argv[globalUtilOptind], argv[globalUtilOptind+1], 1 );
+        return 0;
+    }
     if ( argc == globalUtilOptind + 1 )
     {
-        Gia_ManSatokoDimacs( argv[globalUtilOptind], &opts );
+        Gia_ManSatokoDimacs( argv[globalUtilOptind], &opts, pProof, !fText, fCheck );
         return 0;
     }
     if ( pAbc->pGia == NULL )
@@ -26046,17 +26079,31 @@ int Abc_CommandAbc9Satoko( Abc_Frame_t * pAbc, int argc, char ** argv )
         Abc_Print( -1, "Abc_CommandAbc9Satoko(): There is no AIG.\n" );
         return 1;
     }
-    Gia_ManSatokoCall( pAbc->pGia, &opts, fSplit, fIncrem );
+    if ( pProof && (fSplit || fIncrem) )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9Satoko(): The proof cannot be written when the miter is split.\n" );
+        return 1;
+    }
+    if ( pProof )
+        Gia_ManSatokoCallProof( pAbc->pGia, &opts, pProof, !fText, fCheck );
+    else
+        Gia_ManSatokoCall( pAbc->pGia, &opts, fSplit, fIncrem );
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &satoko [-C num] [-sivh] <file.cnf>\n" );
+    Abc_Print( -2, "usage: &satoko [-C num] [-D file] [-tksivh] <file.cnf> <file.drat>\n" );
     Abc_Print( -2, "\t             run Satoko by Bruno Schmitt\n" );
     Abc_Print( -2, "\t-C num     : limit on the number of conflicts [default = %d]\n", opts.conf_limit );
+    Abc_Print( -2, "\t-D file    : write the DRAT proof of unsatisfiability into this file [default = %s]\n", pProof ? pProof : "none" );
+    Abc_Print( -2, "\t             (for an AIG, the CNF is written into file \"<file>.cnf\")\n" );
+    Abc_Print( -2, "\t-t         : toggle writing the proof in text format instead of binary [default = %s]\n", fText? "yes": "no" );
+    Abc_Print( -2, "\t-k         : toggle checking the proof after solving [default = %s]\n", fCheck? "yes": "no" );
+    Abc_Print( -2, "\t             (without -D, checks the proof <file.drat> for <file.cnf>)\n" );
     Abc_Print( -2, "\t-s         : split multi-output miter into individual outputs [default = %s]\n", fSplit? "yes": "no" );
     Abc_Print( -2, "\t-i         : split multi-output miter and solve incrementally [default = %s]\n", fIncrem? "yes": "no" );
     Abc_Print( -2, "\t-v         : prints verbose information [default = %s]\n", opts.verbose? "yes": "no" );
     Abc_Print( -2, "\t<file.cnf> : (optional) CNF file to solve\n");
+    Abc_Print( -2, "\t<file.drat>: (optional) DRAT proof to check (with -k)\n");
     Abc_Print( -2, "\t-h         : print the command usage\n");
     return 1;
 }
@@ -27077,7 +27124,7 @@ int Abc_CommandBmc3( Abc_Frame_t * pAbc, int argc, char ** argv )
     int c;
     Saig_ParBmcSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "SFTHGCDJIPQRLWaxdursgvzh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "SFTHGCDJIPQRNLWKaxdursgvzh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -27231,6 +27278,26 @@ int Abc_CommandBmc3( Abc_Frame_t * pAbc, int argc, char ** argv )
             pPars->pLogFileName = argv[globalUtilOptind];
             globalUtilOptind++;
             break;
+        case 'K':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-K\" should be followed by a file name.\n" );
+                goto usage;
+            }
+            pPars->pCacheFileName = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
+        case 'N':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-N\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nThreads < 1 )
+                goto usage;
+            break;
         case 'a':
             pPars->fSolveAll ^= 1;
             break;
@@ -27289,6 +27356,11 @@ int Abc_CommandBmc3( Abc_Frame_t * pAbc, int argc, char ** argv )
         Abc_Print( 1, "The miters is already solved; skipping the command.\n" ); 
         return 0;
     }
+    if ( pPars->fUseSatoko && pPars->nThreads > 1 )
+    {
+        Abc_Print( -1, "Solving with several Glucose solvers (switch \"-N\") cannot be combined with Satoko (switch \"-s\").\n" );
+        return 1;
+    }
     pPars->fUseBridge = pAbc->fBridgeMode;
     pAbc->Status = Abc_NtkDarBmc3( pNtk, pPars, fOrDecomp );
     pAbc->nFrames = pNtk->vSeqModelVec ? -1 : pPars->iFrame;
@@ -27323,7 +27395,7 @@ int Abc_CommandBmc3( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: bmc3 [-SFTHGCDJIPQR num] [-LW file] [-axdursgvzh]\n" );
+    Abc_Print( -2, "usage: bmc3 [-SFTHGCDJIPQRN num] [-LWK file] [-axdursgvzh]\n" );
     Abc_Print( -2, "\t         performs bounded model checking with dynamic unrolling\n" );
     Abc_Print( -2, "\t-S num : the starting time frame [default = %d]\n", pPars->nStart );
     Abc_Print( -2, "\t-F num : the max number of time frames (0 = unused) [default = %d]\n",      pPars->nFramesMax );
@@ -27337,8 +27409,10 @@ usage:
     Abc_Print( -2, "\t-P num : the max number of learned clauses to keep (0=unused) [default = %d]\n", pPars->nLearnedStart );
     Abc_Print( -2, "\t-Q num : delta value for learned clause removal [default = %d]\n",          pPars->nLearnedDelta );
     Abc_Print( -2, "\t-R num : percentage to keep for learned clause removal [default = %d]\n",   pPars->nLearnedPerce );
+    Abc_Print( -2, "\t-N num : the number of Glucose solvers sharing learned clauses (not with -s) [default = %d]\n", pPars->nThreads );
     Abc_Print( -2, "\t-L file: the log file name [default = %s]\n",                               pLogFileName ? pLogFileName : "no logging" );
     Abc_Print( -2, "\t-W file: the log file name with per-output details [default = %s]\n",       pPars->pLogFileName ? pPars->pLogFileName : "no logging" );
+    Abc_Print( -2, "\t-K file: the cache file to resume from the depth proved by earlier runs [default = %s]\n", pPars->pCacheFileName ? pPars->pCacheFileName : "no caching" );
     Abc_Print( -2, "\t-a     : solve all outputs (do not stop when one is SAT) [default = %s]\n", pPars->fSolveAll? "yes": "no" );
     Abc_Print( -2, "\t-x     : toggle storing CEXes when solving all outputs [default = %s]\n",   pPars->fStoreCex? "yes": "no" );
     Abc_Print( -2, "\t-d     : toggle dropping (replacing by 0) SAT outputs [default = %s]\n",    pPars->fDropSatOuts? "yes": "no" );
@@ -29038,7 +29112,7 @@ int Abc_CommandPdr( Abc_Frame_t * pAbc, int argc, char ** argv )
     int c;
     Pdr_ManSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "MFCDQTHGSLIaxrmuyfqipdegjonctkvwzh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "MFCDQTHGSPWLIaxrmuyfqipdegjonctkvwzh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -29141,6 +29215,34 @@ int Abc_CommandPdr( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nRandomSeed < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nThreads < 1 )
+                goto usage;
+            break;
+        case 'W':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-W\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            {
+                int nTerWords = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if ( nTerWords < 0 || nTerWords > 64 )
+                {
+                    Abc_Print( -1, "The number of ternary simulation words (%d) should be between 0 and 64.\n", nTerWords );
+                    goto usage;
+                }
+                pPars->nTerWords = nTerWords;
+            }
+            break;
         case 'L':
             if ( globalUtilOptind >= argc )
             {
@@ -29266,7 +29368,7 @@ int Abc_CommandPdr( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: pdr [-MFCDQTHGS <num>] [-LI <file>] [-axrmuyfqipdegjonctkvwzh]\n" );
+    Abc_Print( -2, "usage: pdr [-MFCDQTHGSPW <num>] [-LI <file>] [-axrmuyfqipdegjonctkvwzh]\n" );
     Abc_Print( -2, "\t         model checking using property directed reachability (aka IC3)\n" );
     Abc_Print( -2, "\t         pioneered by Aaron R. Bradley (http://theory.stanford.edu/~arbrad/)\n" );
     Abc_Print( -2, "\t         with improvements by Niklas Een (http://een.se/niklas/)\n" );
@@ -29279,6 +29381,8 @@ usage:
     Abc_Print( -2, "\t-H num : runtime limit per output, in miliseconds (with \"-a\") [default = %d]\n",     pPars->nTimeOutOne );
     Abc_Print( -2, "\t-G num : runtime gap since the last CEX (0 = no limit) [default = %d]\n",              pPars->nTimeOutGap );
     Abc_Print( -2, "\t-S num : * value to seed the SAT solver with [default = %d]\n",                          pPars->nRandomSeed );
+    Abc_Print( -2, "\t-P num : the number of threads generalizing proof obligations [default = %d]\n",     pPars->nThreads );
+    Abc_Print( -2, "\t-W num : the number of words in bit-parallel ternary simulation (0 = scalar) [default = %d]\n", pPars->nTerWords );
     Abc_Print( -2, "\t-L file: the log file name [default = %s]\n",                                          pLogFileName ? pLogFileName : "no logging" );
     Abc_Print( -2, "\t-I file: the invariant file name [default = %s]\n",                                    pPars->pInvFileName ? pPars->pInvFileName : "default name" );
     Abc_Print( -2, "\t-a     : toggle solving all outputs even if one of them is SAT [default = %s]\n",      pPars->fSolveAll? "yes": "no" );
@@ -30403,8 +30507,10 @@ int Abc_CommandAbc9Read( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fSkipStrash = 0;
     int fNewReader = 0;
     int fDetectXors = 0;
+    int fMmap = 0;
+    abctime clk = Abc_Clock();
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "csxmnlpvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "csxmnlpMvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -30429,6 +30535,9 @@ int Abc_CommandAbc9Read( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 'p':
             fNewReader ^= 1;
             break;
+        case 'M':
+            fMmap ^= 1;
+            break;
         case 'v':
             fVerbose ^= 1;
             break;
@@ -30472,7 +30581,12 @@ int Abc_CommandAbc9Read( Abc_Frame_t * pAbc, int argc, char ** argv )
 //        Abc3_ReadShowHie( FileName, fSkipStrash );
     else
     {
-        pAig = Gia_AigerRead( FileName, fGiaSimple, fSkipStrash, 0 );
+        if ( fMmap )
+            pAig = Gia_AigerReadMmap( FileName, fGiaSimple, fSkipStrash, 0, fVerbose );
+        else
+            pAig = Gia_AigerRead( FileName, fGiaSimple, fSkipStrash, 0 );
+        if ( fVerbose && !fMmap )
+            Abc_PrintTime( 1, "Reading time", Abc_Clock() - clk );
         if ( fDetectXors )
         {
             Gia_Man_t * pTemp;
@@ -30485,7 +30599,7 @@ int Abc_CommandAbc9Read( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &r [-csxmnlvh] <file>\n" );
+    Abc_Print( -2, "usage: &r [-csxmnlMvh] <file>\n" );
     Abc_Print( -2, "\t         reads the current AIG from the AIGER file\n" );
     Abc_Print( -2, "\t-c     : toggles reading simple AIG [default = %s]\n", fGiaSimple? "yes": "no" );
     Abc_Print( -2, "\t-s     : toggles structural hashing while reading [default = %s]\n", !fSkipStrash? "yes": "no" );
@@ -30493,6 +30607,7 @@ usage:
     Abc_Print( -2, "\t-m     : toggles reading MiniAIG rather than AIGER file [default = %s]\n", fMiniAig? "yes": "no" );
     Abc_Print( -2, "\t-n     : toggles reading MiniAIG as a set of supergates [default = %s]\n", fMiniAig2? "yes": "no" );
     Abc_Print( -2, "\t-l     : toggles reading MiniLUT rather than AIGER file [default = %s]\n", fMiniLut? "yes": "no" );
+    Abc_Print( -2, "\t-M     : toggles mapping the AIGER file into memory instead of reading it [default = %s]\n", fMmap? "yes": "no" );
     Abc_Print( -2, "\t-v     : toggles additional verbose output [default = %s]\n", fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
     Abc_Print( -2, "\t<file> : the file name\n");
@@ -32589,8 +32704,10 @@ int Abc_CommandAbc9Strash( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fAddMuxes  = 0;
     int fStrMuxes  = 0;
     int fRehashMap = 0;
+    int nProcs     = 0;
+    int fVerbose   = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "LMbacmrsh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "LMPbacmrsvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -32616,6 +32733,17 @@ int Abc_CommandAbc9Strash( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( Multi <= 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nProcs < 0 )
+                goto usage;
+            break;
         case 'b':
             fAddBuffs ^= 1;
             break;
@@ -32634,6 +32762,9 @@ int Abc_CommandAbc9Strash( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 's':
             fStrMuxes ^= 1;
             break;
+        case 'v':
+            fVerbose ^= 1;
+            break;
         case 'h':
             goto usage;
         default:
@@ -32710,6 +32841,12 @@ int Abc_CommandAbc9Strash( Abc_Frame_t * pAbc, int argc, char ** argv )
         if ( !Abc_FrameReadFlag("silentmode") )
             printf( "Generated AIG from AND/XOR/MUX graph.\n" );
     }
+    else if ( nProcs > 1 && !fAddStrash )
+    {
+        if ( fVerbose )
+            Gia_ManHashMtBench( pAbc->pGia, nProcs );
+        pTemp = Gia_ManRehashMt( pAbc->pGia, nProcs );
+    }
     else
     {
         pTemp = Gia_ManRehash( pAbc->pGia, fAddStrash );
@@ -32726,7 +32863,7 @@ int Abc_CommandAbc9Strash( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &st [-LM num] [-bacmrsh]\n" );
+    Abc_Print( -2, "usage: &st [-LMP num] [-bacmrsvh]\n" );
     Abc_Print( -2, "\t         performs structural hashing\n" );
     Abc_Print( -2, "\t-b     : toggle adding buffers at the inputs and outputs [default = %s]\n", fAddBuffs? "yes": "no" );
     Abc_Print( -2, "\t-a     : toggle additional hashing [default = %s]\n", fAddStrash? "yes": "no" );
@@ -32737,6 +32874,8 @@ usage:
     Abc_Print( -2, "\t-M num : create an AIG with additional primary inputs [default = %d]\n", Multi );
     Abc_Print( -2, "\t-r     : toggle rehashing AIG while preserving mapping [default = %s]\n", fRehashMap? "yes": "no" );
     Abc_Print( -2, "\t-s     : toggle using MUX restructuring [default = %s]\n", fStrMuxes? "yes": "no" );
+    Abc_Print( -2, "\t-P num : the number of threads for concurrent rehashing [default = %d]\n", nProcs );
+    Abc_Print( -2, "\t-v     : toggle comparing sequential and concurrent rehashing [default = %s]\n", fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
     return 1;
 }
@@ -33125,7 +33264,7 @@ int Abc_CommandAbc9Sim( Abc_Frame_t * pAbc, int argc, char ** argv )
     int c;
     Gia_ManSimSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "FWNTImvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "FWNTPImvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -33173,6 +33312,17 @@ int Abc_CommandAbc9Sim( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->TimeLimit < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nThreads < 1 )
+                goto usage;
+            break;
         case 'I':
             if ( globalUtilOptind >= argc )
             {
@@ -33229,13 +33379,14 @@ int Abc_CommandAbc9Sim( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &sim [-FWNT num] [-mvh] -I <file>\n" );
+    Abc_Print( -2, "usage: &sim [-FWNTP num] [-mvh] -I <file>\n" );
     Abc_Print( -2, "\t         performs random simulation of the sequential miter\n" );
     Abc_Print( -2, "\t         (if candidate equivalences are defined, performs refinement)\n" );
     Abc_Print( -2, "\t-F num : the number of frames to simulate [default = %d]\n", pPars->nIters );
     Abc_Print( -2, "\t-W num : the number of words to simulate [default = %d]\n", pPars->nWords );
     Abc_Print( -2, "\t-N num : random number seed (1 <= num <= 1000) [default = %d]\n", pPars->RandSeed );
     Abc_Print( -2, "\t-T num : approximate runtime limit in seconds [default = %d]\n", pPars->TimeLimit );
+    Abc_Print( -2, "\t-P num : the number of threads simulating blocks of words [default = %d]\n", pPars->nThreads );
     Abc_Print( -2, "\t-m     : toggle miter vs. any circuit [default = %s]\n", pPars->fCheckMiter? "miter": "circuit" );
     Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n", pPars->fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
@@ -33440,7 +33591,7 @@ int Abc_CommandAbc9Sim3( Abc_Frame_t * pAbc, int argc, char ** argv )
     Ssw_RarSetDefaultParams( pPars );
     // parse command line
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "FWBRSNTGgvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "FWBRSNTGPgvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -33532,6 +33683,17 @@ int Abc_CommandAbc9Sim3( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->TimeOutGap < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nThreads < 1 )
+                goto usage;
+            break;
         case 'g':
             pPars->fUseFfGrouping ^= 1;
             break;
@@ -33559,7 +33721,7 @@ int Abc_CommandAbc9Sim3( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &sim3 [-FWBRNT num] [-gvh]\n" );
+    Abc_Print( -2, "usage: &sim3 [-FWBRNTP num] [-gvh]\n" );
     Abc_Print( -2, "\t         performs random simulation of the sequential miter\n" );
     Abc_Print( -2, "\t-F num : the number of frames to simulate [default = %d]\n",       pPars->nFrames );
     Abc_Print( -2, "\t-W num : the number of words to simulate [default = %d]\n",        pPars->nWords );
@@ -33568,12 +33730,85 @@ usage:
     Abc_Print( -2, "\t-S num : the number of rounds before a restart [default = %d]\n",  pPars->nRestart );
     Abc_Print( -2, "\t-N num : random number seed (1 <= num <= 1000) [default = %d]\n",  pPars->nRandSeed );
     Abc_Print( -2, "\t-T num : approximate runtime limit in seconds [default = %d]\n",   pPars->TimeOut );
+    Abc_Print( -2, "\t-P num : the number of threads simulating blocks of words [default = %d]\n", pPars->nThreads );
     Abc_Print( -2, "\t-g     : toggle heuristic flop grouping [default = %s]\n",    pPars->fUseFfGrouping? "yes": "no" );
     Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n",    pPars->fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_CommandAbc9TSim( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    extern int Pdr_ManTernaryBench( Aig_Man_t * pAig, int nWords, int nRounds, int fVerbose );
+    Aig_Man_t * pAig;
+    int c, nWords = 4, nRounds = 1000, fVerbose = 0;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "WRvh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'W':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-W\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nWords = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nWords < 1 || nWords > 64 )
+                goto usage;
+            break;
+        case 'R':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-R\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nRounds = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nRounds < 1 )
+                goto usage;
+            break;
+        case 'v':
+            fVerbose ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    if ( pAbc->pGia == NULL )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9TSim(): There is no AIG.\n" );
+        return 1;
+    }
+    pAig = Gia_ManToAigSimple( pAbc->pGia );
+    Pdr_ManTernaryBench( pAig, nWords, nRounds, fVerbose );
+    Aig_ManStop( pAig );
+    return 0;
+
+usage:
+    Abc_Print( -2, "usage: &tsim [-WR num] [-vh]\n" );
+    Abc_Print( -2, "\t         compares the speed of scalar and bit-parallel ternary simulation\n" );
+    Abc_Print( -2, "\t-W num : the number of words to simulate [default = %d]\n",          nWords );
+    Abc_Print( -2, "\t-R num : the number of simulation rounds [default = %d]\n",          nRounds );
+    Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n",    fVerbose? "yes": "no" );
+    Abc_Print( -2, "\t-h     : print the command usage\n");
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -34277,10 +34512,10 @@ usage:
 ***********************************************************************/
 int Abc_CommandAbc9SimRsb( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
-    extern void Gia_ManSimRsb( Gia_Man_t * p, int nCands, int fVerbose );
-    int c, nCands = 32, fVerbose = 0;
+    extern void Gia_ManSimRsb( Gia_Man_t * p, int nCands, int nThreads, int fVerbose );
+    int c, nCands = 32, nThreads = 1, fVerbose = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "Nvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "NPvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -34295,6 +34530,17 @@ int Abc_CommandAbc9SimRsb( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( nCands < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nThreads < 1 )
+                goto usage;
+            break;
         case 'v':
             fVerbose ^= 1;
             break;
@@ -34319,13 +34565,14 @@ int Abc_CommandAbc9SimRsb( Abc_Frame_t * pAbc, int argc, char ** argv )
         Abc_Print( -1, "Abc_CommandAbc9SimRsb(): Does not have simulation information available.\n" );
         return 0;
     }
-    Gia_ManSimRsb( pAbc->pGia, nCands, fVerbose );
+    Gia_ManSimRsb( pAbc->pGia, nCands, nThreads, fVerbose );
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &simrsb [-N num] [-vh]\n" );
+    Abc_Print( -2, "usage: &simrsb [-NP num] [-vh]\n" );
     Abc_Print( -2, "\t         performs resubstitution\n" );
     Abc_Print( -2, "\t-C num : the number of candidates to try [default = %d]\n", nCands );
+    Abc_Print( -2, "\t-P num : the number of threads simulating blocks of words [default = %d]\n", nThreads );
     Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
     return 1;
@@ -37487,7 +37734,7 @@ int Abc_CommandAbc9Fraig( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fCbs = 1, approxLim = 600, subBatchSz = 1, adaRecycle = 500, nMaxNodes = 0;
     Cec4_ManSetParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "JWRILDCNPMrmdckngxysopwvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "JWRILDCNPMQrmdckngxyesopwvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -37601,6 +37848,17 @@ int Abc_CommandAbc9Fraig( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( nMaxNodes < 0 )
                 goto usage;
             break;
+        case 'Q':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-Q\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nThreads < 1 )
+                goto usage;
+            break;
         case 'r':
             pPars->fRewriting ^= 1;
             break;
@@ -37628,6 +37886,9 @@ int Abc_CommandAbc9Fraig( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 'y':
             fUseAlgoY ^= 1;
             break;
+        case 'e':
+            pPars->fIncremental ^= 1;
+            break;
         case 's':
             fUseSave ^= 1;
             break;
@@ -37679,7 +37940,7 @@ int Abc_CommandAbc9Fraig( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &fraig [-JWRILDCNPM <num>] [-rmdckngxysopwvh]\n" );
+    Abc_Print( -2, "usage: &fraig [-JWRILDCNPMQ <num>] [-rmdckngxyesopwvh]\n" );
     Abc_Print( -2, "\t         performs combinational SAT sweeping\n" );
     Abc_Print( -2, "\t-J num : the solver type [default = %d]\n", pPars->jType );
     Abc_Print( -2, "\t-W num : the number of simulation words [default = %d]\n", pPars->nWords );
@@ -37691,6 +37952,7 @@ usage:
     Abc_Print( -2, "\t-N num : the min number of calls to recycle the solver [default = %d]\n", pPars->nCallsRecycle );
     Abc_Print( -2, "\t-P num : the number of pattern generation iterations [default = %d]\n", pPars->nGenIters );
     Abc_Print( -2, "\t-M num : the node count limit to call the old sweeper [default = %d]\n", nMaxNodes );
+    Abc_Print( -2, "\t-Q num : the number of threads solving candidate pairs (with -x) [default = %d]\n", pPars->nThreads );
     Abc_Print( -2, "\t-r     : toggle the use of AIG rewriting [default = %s]\n", pPars->fRewriting? "yes": "no" );
     Abc_Print( -2, "\t-m     : toggle miter vs. any circuit [default = %s]\n", pPars->fCheckMiter? "miter": "circuit" );
     Abc_Print( -2, "\t-d     : toggle using double output miters [default = %s]\n", pPars->fDualOut? "yes": "no" );
@@ -37700,6 +37962,7 @@ usage:
     Abc_Print( -2, "\t-g     : toggle using another new implementation [default = %s]\n", fUseAlgoG? "yes": "no" );
     Abc_Print( -2, "\t-x     : toggle using another new implementation [default = %s]\n", fUseAlgoX? "yes": "no" );
     Abc_Print( -2, "\t-y     : toggle using another new implementation [default = %s]\n", fUseAlgoY? "yes": "no" );
+    Abc_Print( -2, "\t-e     : toggle reusing the sweeping session across calls (with -x) [default = %s]\n", pPars->fIncremental? "yes": "no" );
     Abc_Print( -2, "\t-s     : toggle dumping equivalences into a file [default = %s]\n", fUseSave? "yes": "no" );
     Abc_Print( -2, "\t-o     : toggle using the old SAT sweeper [default = %s]\n", fUseIvy? "yes": "no" );
     Abc_Print( -2, "\t-p     : toggle trying to prove when running the old SAT sweeper [default = %s]\n", fUseProve? "yes": "no" );
@@ -38280,10 +38543,10 @@ int Abc_CommandAbc9Cec( Abc_Frame_t * pAbc, int argc, char ** argv )
     FILE * pFile;
     Gia_Man_t * pGias[2] = {NULL, NULL}, * pMiter;
     char ** pArgvNew;
-    int c, nArgcNew, fUseSim = 0, fUseNewX = 0, fUseNewY = 0, fMiter = 0, fDualOutput = 0, fDumpMiter = 0;
+    int c, nArgcNew, fUseSim = 0, fUseNewX = 0, fUseNewY = 0, fMiter = 0, fDualOutput = 0, fDumpMiter = 0, nThreads = 1;
     Cec_ManCecSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "CTnmdasxytvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "CTPnmdasxytvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -38309,6 +38572,18 @@ int Abc_CommandAbc9Cec( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->TimeLimit < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nThreads < 1 )
+                goto usage;
+            pPars->nThreads = nThreads;
+            break;
         case 'n':
             pPars->fNaive ^= 1;
             break;
@@ -38533,9 +38808,16 @@ int Abc_CommandAbc9Cec( Abc_Frame_t * pAbc, int argc, char ** argv )
         }
         else if ( fUseNewX )
         {
+            extern void        Cec4_ManSetParams( Cec_ParFra_t * pPars );
+            extern Gia_Man_t * Cec4_ManSimulateTest( Gia_Man_t * p, Cec_ParFra_t * pPars );
             abctime clk = Abc_Clock();
-            extern Gia_Man_t * Cec4_ManSimulateTest3( Gia_Man_t * p, int nBTLimit, int fVerbose );
-            Gia_Man_t * pNew = Cec4_ManSimulateTest3( pMiter, pPars->nBTLimit, pPars->fVerbose );
+            Cec_ParFra_t ParsFra, * pParsFra = &ParsFra;
+            Gia_Man_t * pNew;
+            Cec4_ManSetParams( pParsFra );
+            pParsFra->nBTLimit = pPars->nBTLimit;
+            pParsFra->nThreads = nThreads;
+            pParsFra->fVerbose = pPars->fVerbose;
+            pNew = Cec4_ManSimulateTest( pMiter, pParsFra );
             if ( Gia_ManAndNum(pNew) == 0 )
                 Abc_Print( 1, "Networks are equivalent.  " );
             else
@@ -38568,10 +38850,11 @@ int Abc_CommandAbc9Cec( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &cec [-CT num] [-nmdasxytvwh]\n" );
+    Abc_Print( -2, "usage: &cec [-CTP num] [-nmdasxytvwh]\n" );
     Abc_Print( -2, "\t         new combinational equivalence checker\n" );
     Abc_Print( -2, "\t-C num : the max number of conflicts at a node [default = %d]\n", pPars->nBTLimit );
     Abc_Print( -2, "\t-T num : approximate runtime limit in seconds [default = %d]\n", pPars->TimeLimit );
+    Abc_Print( -2, "\t-P num : the number of threads solving candidate pairs (with -x) or Glucose solvers (with -n) [default = %d]\n", nThreads );
     Abc_Print( -2, "\t-n     : toggle using naive SAT-based checking [default = %s]\n", pPars->fNaive? "yes":"no");
     Abc_Print( -2, "\t-m     : toggle miter vs. two circuits [default = %s]\n", fMiter? "miter":"two circuits");
     Abc_Print( -2, "\t-d     : toggle using dual output miter [default = %s]\n", fDualOutput? "yes":"no");
@@ -41188,7 +41471,7 @@ int Abc_CommandAbc9Mf( Abc_Frame_t * pAbc, int argc, char ** argv )
     Gia_Man_t * pNew; int c;
     Mf_ManSetDefaultPars( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFARLEDWaekmclgvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFARLEDWPaekmclgvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -41297,6 +41580,20 @@ int Abc_CommandAbc9Mf( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nVerbLimit < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by a positive integer.\n" );
+                goto usage;
+            }
+            pPars->nProcNum = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcNum < 0 || pPars->nProcNum > pPars->nProcNumMax )
+            {
+                Abc_Print( -1, "The number of threads (%d) is not supported.\n", pPars->nProcNum );
+                goto usage;
+            }
+            break;
         case 'a':
             pPars->fAreaOnly ^= 1;
             break;
@@ -41352,7 +41649,7 @@ usage:
         sprintf(Buffer, "best possible" );
     else
         sprintf(Buffer, "%d", pPars->DelayTarget );
-    Abc_Print( -2, "usage: &mf [-KCFARLED num] [-akmcgvwh]\n" );
+    Abc_Print( -2, "usage: &mf [-KCFARLEDP num] [-akmcgvwh]\n" );
     Abc_Print( -2, "\t           performs technology mapping of the network\n" );
     Abc_Print( -2, "\t-K num   : LUT size for the mapping (2 <= K <= %d) [default = %d]\n", pPars->nLutSizeMax, pPars->nLutSize );
     Abc_Print( -2, "\t-C num   : the max number of priority cuts (1 <= C <= %d) [default = %d]\n", pPars->nCutNumMax, pPars->nCutNum );
@@ -41362,6 +41659,7 @@ usage:
     Abc_Print( -2, "\t-L num   : the fanout limit for coarsening XOR/MUX (num >= 2) [default = %d]\n", pPars->nCoarseLimit );
     Abc_Print( -2, "\t-E num   : the area/edge tradeoff parameter (0 <= num <= 100) [default = %d]\n", pPars->nAreaTuner );
     Abc_Print( -2, "\t-D num   : sets the delay constraint for the mapping [default = %s]\n", Buffer );
+    Abc_Print( -2, "\t-P num   : the number of threads for cut computation and area flow [default = %d]\n", pPars->nProcNum );
     Abc_Print( -2, "\t-a       : toggles area-oriented mapping [default = %s]\n", pPars->fAreaOnly? "yes": "no" );
     Abc_Print( -2, "\t-e       : toggles edge vs node minimization [default = %s]\n", pPars->fOptEdge? "yes": "no" );
     Abc_Print( -2, "\t-k       : toggles coarsening the subject graph [default = %s]\n", pPars->fCoarsen? "yes": "no" );
@@ -45593,8 +45891,11 @@ int Abc_CommandAbc9MultiProve( Abc_Frame_t * pAbc, int argc, char ** argv )
     pPars->TimeOutInc = 100;
     pPars->TimeOutGap =   0;
     pPars->TimePerOut =   0;
+    pPars->nProcs     =   0;
+    pPars->nClustSize =  64;
+    pPars->nEngine    =   2;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "TLMGHsdvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "TLMGHPCEsdvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -45653,6 +45954,39 @@ int Abc_CommandAbc9MultiProve( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->TimePerOut <= 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcs < 0 )
+                goto usage;
+            break;
+        case 'C':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-C\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nClustSize = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nClustSize <= 0 )
+                goto usage;
+            break;
+        case 'E':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-E\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nEngine = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nEngine < 0 || pPars->nEngine > 2 )
+                goto usage;
+            break;
         case 's':
             pPars->fUseSyn ^= 1;
             break;
@@ -45682,19 +46016,25 @@ int Abc_CommandAbc9MultiProve( Abc_Frame_t * pAbc, int argc, char ** argv )
         return 1;
     }
     pAbc->Status = Gia_ManMultiProve( pAbc->pGia, pPars );
-    vStatuses = Abc_FrameDeriveStatusArray( pAbc->pGia->vSeqModelVec );
+    if ( pPars->vOutMap )
+        vStatuses = pPars->vOutMap, pPars->vOutMap = NULL;
+    else
+        vStatuses = Abc_FrameDeriveStatusArray( pAbc->pGia->vSeqModelVec );
     Abc_FrameReplacePoStatuses( pAbc, &vStatuses );
     Abc_FrameReplaceCexVec( pAbc, &pAbc->pGia->vSeqModelVec );
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &mprove [-TLMGH num] [-sdvwh]\n" );
+    Abc_Print( -2, "usage: &mprove [-TLMGHPCE num] [-sdvwh]\n" );
     Abc_Print( -2, "\t         proves multi-output testcase by applying several engines\n" );
     Abc_Print( -2, "\t-T num : approximate global runtime limit in seconds [default = %d]\n",     pPars->TimeOutGlo );
     Abc_Print( -2, "\t-L num : approximate local runtime limit in seconds [default = %d]\n",      pPars->TimeOutLoc );
     Abc_Print( -2, "\t-M num : percentage of local runtime limit increase [default = %d]\n",      pPars->TimeOutInc );
     Abc_Print( -2, "\t-G num : approximate gap runtime limit in seconds [default = %d]\n",        pPars->TimeOutGap );
     Abc_Print( -2, "\t-H num : timeout per output in miliseconds [default = %d]\n",               pPars->TimePerOut );
+    Abc_Print( -2, "\t-P num : the number of threads solving clusters of outputs (0 = sequential) [default = %d]\n", pPars->nProcs );
+    Abc_Print( -2, "\t-C num : the largest number of outputs in a cluster [default = %d]\n",        pPars->nClustSize );
+    Abc_Print( -2, "\t-E num : the engine used on clusters (0 = sim, 1 = bmc3, 2 = pdr) [default = %d]\n", pPars->nEngine );
     Abc_Print( -2, "\t-s     : toggle using combinational synthesis [default = %s]\n",            pPars->fUseSyn?      "yes": "no" );
     Abc_Print( -2, "\t-d     : toggle dumping invariant into a file [default = %s]\n",            pPars->fDumpFinal?   "yes": "no" );
     Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n",             pPars->fVerbose?     "yes": "no" );
@@ -46101,6 +46441,120 @@ usage:
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_CommandAbc9Portfolio( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    Bmc_PortPar_t Pars, * pPars = &Pars;
+    Vec_Ptr_t * vSeqModelVec;
+    int c;
+    Bmc_PortSetDefaultParams( pPars );
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "TMpbisavh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'T':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-T\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nTimeOut = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nTimeOut < 0 )
+                goto usage;
+            break;
+        case 'M':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-M\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nMboxSize = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nMboxSize <= 0 || pPars->nMboxSize >= 2048 )
+                goto usage;
+            break;
+        case 'p':
+            pPars->fUsePdr ^= 1;
+            break;
+        case 'b':
+            pPars->fUseBmc ^= 1;
+            break;
+        case 'i':
+            pPars->fUseInt ^= 1;
+            break;
+        case 's':
+            pPars->fUseShare ^= 1;
+            break;
+        case 'a':
+            pPars->fSolveAll ^= 1;
+            break;
+        case 'v':
+            pPars->fVerbose ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    if ( pAbc->pGia == NULL )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9Portfolio(): There is no AIG.\n" );
+        return 0;
+    }
+    if ( Gia_ManRegNum(pAbc->pGia) == 0 )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9Portfolio(): The AIG is combinational.\n" );
+        return 0;
+    }
+    if ( Gia_ManConstrNum(pAbc->pGia) > 0 )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9Portfolio(): Constraints have to be folded (use \"&fold\").\n" );
+        return 0;
+    }
+    if ( !pPars->fUsePdr && !pPars->fUseBmc && !pPars->fUseInt )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9Portfolio(): At least one engine should be enabled.\n" );
+        return 0;
+    }
+    pAbc->Status  = Bmc_PortPerform( pAbc->pGia, pPars );
+    pAbc->nFrames = pPars->iFrame;
+    Abc_FrameReplacePoStatuses( pAbc, &pPars->vOutMap );
+    vSeqModelVec = pAbc->pGia->vSeqModelVec;  pAbc->pGia->vSeqModelVec = NULL;
+    if ( vSeqModelVec )
+        Abc_FrameReplaceCexVec( pAbc, &vSeqModelVec );
+    else
+        Abc_FrameReplaceCex( pAbc, &pAbc->pGia->pCexSeq );
+    return 0;
+
+usage:
+    Abc_Print( -2, "usage: &portfolio [-TM num] [-pbisavh]\n" );
+    Abc_Print( -2, "\t         proves the outputs by running several engines concurrently;\n" );
+    Abc_Print( -2, "\t         BMC uses the clauses and the proved frames found by PDR\n" );
+    Abc_Print( -2, "\t-T num : approximate timeout in seconds for each output [default = %d]\n", pPars->nTimeOut );
+    Abc_Print( -2, "\t-M num : the size of the mailbox for exchanging clauses, in MB [default = %d]\n", pPars->nMboxSize );
+    Abc_Print( -2, "\t-p     : toggle running property directed reachability [default = %s]\n", pPars->fUsePdr?   "yes": "no" );
+    Abc_Print( -2, "\t-b     : toggle running bounded model checking [default = %s]\n",         pPars->fUseBmc?   "yes": "no" );
+    Abc_Print( -2, "\t-i     : toggle running interpolation [default = %s]\n",                  pPars->fUseInt?   "yes": "no" );
+    Abc_Print( -2, "\t-s     : toggle exchanging clauses and bounds between engines [default = %s]\n", pPars->fUseShare? "yes": "no" );
+    Abc_Print( -2, "\t-a     : toggle solving all outputs after one of them fails [default = %s]\n", pPars->fSolveAll? "yes": "no" );
+    Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n",           pPars->fVerbose?  "yes": "no" );
+    Abc_Print( -2, "\t-h     : print the command usage\n");
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -48616,7 +49070,7 @@ int Abc_CommandAbc9Mfs( Abc_Frame_t * pAbc, int argc, char ** argv )
     pPars->nDepthMax   =  100;
     pPars->nWinSizeMax = 2000;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "WFDMLCNdaeblvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "WFDMLCNPdaeblvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -48697,6 +49151,17 @@ int Abc_CommandAbc9Mfs( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nNodesMax < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nThreads < 1 )
+                goto usage;
+            break;
         case 'd':
             pPars->fRrOnly ^= 1;
             break;
@@ -48765,7 +49230,7 @@ int Abc_CommandAbc9Mfs( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &mfs [-WFDMLCN <num>] [-daeblvwh]\n" );
+    Abc_Print( -2, "usage: &mfs [-WFDMLCNP <num>] [-daeblvwh]\n" );
     Abc_Print( -2, "\t           performs don't-care-based optimization of logic networks\n" );
     Abc_Print( -2, "\t-W <num> : the number of levels in the TFO cone (0 <= num) [default = %d]\n",             pPars->nTfoLevMax );
     Abc_Print( -2, "\t-F <num> : the max number of fanouts to skip (1 <= num) [default = %d]\n",                pPars->nFanoutMax );
@@ -48774,6 +49239,7 @@ usage:
     Abc_Print( -2, "\t-L <num> : the max increase in node level after resynthesis (0 <= num) [default = %d]\n", pPars->nGrowthLevel );
     Abc_Print( -2, "\t-C <num> : the max number of conflicts in one SAT run (0 = no limit) [default = %d]\n",   pPars->nBTLimit );
     Abc_Print( -2, "\t-N <num> : the max number of nodes to try (0 = all) [default = %d]\n",                    pPars->nNodesMax );
+    Abc_Print( -2, "\t-P <num> : the number of threads evaluating windows (1 <= num) [default = %d]\n",         pPars->nThreads );
     Abc_Print( -2, "\t-d       : toggle performing redundancy removal [default = %s]\n",                        pPars->fRrOnly? "yes": "no" );
     Abc_Print( -2, "\t-a       : toggle minimizing area or area+edges [default = %s]\n",                        pPars->fArea? "area": "area+edges" );
     Abc_Print( -2, "\t-e       : toggle high-effort resubstitution [default = %s]\n",                           pPars->fMoreEffort? "yes": "no" );
@@ -51022,8 +51488,9 @@ int Abc_CommandAbc9Test( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fSwitch = 0;
     int nWords = 1000;
     int nProcs = 2;
+    int nChanges = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "WPFsvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "WPFCsvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -51060,6 +51527,17 @@ int Abc_CommandAbc9Test( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( nFrames < 0 )
                 goto usage;
             break;
+        case 'C':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-C\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nChanges = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nChanges < 0 )
+                goto usage;
+            break;
         case 's':
             fSwitch ^= 1;
             break;
@@ -51077,6 +51555,22 @@ int Abc_CommandAbc9Test( Abc_Frame_t * pAbc, int argc, char ** argv )
         Abc_Print( -1, "Abc_CommandAbc9Test(): There is no AIG.\n" );
         return 1;
     }
+    if ( nChanges > 0 )
+    {
+        if ( !Gia_ManHasMapping(pAbc->pGia) )
+        {
+            Abc_Print( -1, "Abc_CommandAbc9Test(): Mapping of the AIG is not defined.\n" );
+            return 1;
+        }
+        if ( pAbc->pGia->pLutLib && ((If_LibLut_t *)pAbc->pGia->pLutLib)->LutMax < Gia_ManLutSizeMax(pAbc->pGia) )
+        {
+            Abc_Print( -1, "Abc_CommandAbc9Test(): The max LUT size of the library is less than the max fanin count.\n" );
+            return 1;
+        }
+        if ( !Gia_StaRandomCheck( pAbc->pGia, nChanges ) )
+            Abc_Print( 1, "The incremental timing update is incorrect.\n" );
+        return 0;
+    }
     if ( argc == globalUtilOptind + 1 )
     {
         extern void Gia_ManUpdateCoPhase( Gia_Man_t * pNew, Gia_Man_t * pOld );
@@ -51089,10 +51583,11 @@ int Abc_CommandAbc9Test( Abc_Frame_t * pAbc, int argc, char ** argv )
 //    printf( "AIG in \"%s\" has the sum of output support sizes equal to %d.\n", pAbc->pGia->pSpec, Gia_ManSumTotalOfSupportSizes(pAbc->pGia) );
     return 0;
 usage:
-    Abc_Print( -2, "usage: &test [-FW num] [-svh]\n" );
+    Abc_Print( -2, "usage: &test [-FWC num] [-svh]\n" );
     Abc_Print( -2, "\t        testing various procedures\n" );
     Abc_Print( -2, "\t-F num: the number of timeframes [default = %d]\n", nFrames );
     Abc_Print( -2, "\t-W num: the number of machine words [default = %d]\n", nWords );
+    Abc_Print( -2, "\t-C num: the number of random changes to check the incremental timing of the mapping [default = %d]\n", nChanges );
     Abc_Print( -2, "\t-s    : toggle enable (yes) vs. disable (no) [default = %s]\n", fSwitch? "yes": "no" );
     Abc_Print( -2, "\t-v    : toggle printing verbose information [default = %s]\n", fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h    : print the command usage\n");
@@ -131,7 +131,10 @@ int Abc_NtkMiterSat( Abc_Ntk_t * pNtk, ABC_INT64_T nConfLimit, ABC_INT64_T nInsL
     }
     // free the sat_solver
     if ( fVerbose )
+    {
         Sat_SolverPrintStats( stdout, pSat );
+        Sat_SolverPrintMemory( stdout, pSat );
+    }
 
     if ( pNumConfs )
         *pNumConfs = (int)pSat->stats.conflicts;
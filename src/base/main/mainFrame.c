@@ -204,11 +204,13 @@ Abc_Frame_t * Abc_FrameAllocate()
 void Abc_FrameDeallocate( Abc_Frame_t * p )
 {
     extern void Rwt_ManGlobalStop();
+    extern void Cec4_ManSessionStop();
     extern void undefine_cube_size();
 //    extern void Ivy_TruthManStop();
 //    Abc_HManStop();
 //    undefine_cube_size();
     Rwt_ManGlobalStop();
+    Cec4_ManSessionStop();
 //    Ivy_TruthManStop();
     if ( p->vAbcObjIds)  Vec_IntFree( p->vAbcObjIds );
     if ( p->vCexVec   )  Vec_PtrFreeFree( p->vCexVec );
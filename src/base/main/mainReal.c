@@ -56,6 +56,7 @@ SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
 #include "base/abc/abc.h"
 #include "mainInt.h"
 #include "base/wlc/wlc.h"
+#include "misc/util/utilPool.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -124,7 +125,7 @@ int Abc_RealMain( int argc, char * argv[] )
     sprintf( sWriteCmd, "write" );
 
     Extra_UtilGetoptReset();
-    while ((c = Extra_UtilGetopt(argc, argv, "dm:l:c:q:C:Q:S:hf:F:o:st:T:xb")) != EOF) {
+    while ((c = Extra_UtilGetopt(argc, argv, "dm:l:c:q:C:Q:S:hf:F:o:st:T:xbP:")) != EOF) {
         switch(c) {
 
             case 'd':                                          
@@ -271,6 +272,10 @@ int Abc_RealMain( int argc, char * argv[] )
                 Abc_FrameSetBridgeMode();
                 break;
 
+            case 'P':
+                Abc_PoolSetThreadNum( atoi(globalUtilOptarg) );
+                break;
+
             default:
                 goto usage;
         }
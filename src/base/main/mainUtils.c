@@ -128,7 +128,7 @@ void Abc_UtilsPrintUsage( Abc_Frame_t * pAbc, char * ProgName )
 {
     fprintf( pAbc->Err, "\n" );
     fprintf( pAbc->Err,
-             "usage: %s [-c cmd] [-q cmd] [-C cmd] [-Q cmd] [-f script] [-h] [-o file] [-s] [-t type] [-T type] [-x] [-b] [file]\n",
+             "usage: %s [-c cmd] [-q cmd] [-C cmd] [-Q cmd] [-f script] [-h] [-o file] [-s] [-t type] [-T type] [-x] [-b] [-P num] [file]\n",
              ProgName);
     fprintf( pAbc->Err, "    -c cmd\texecute commands `cmd'\n");
     fprintf( pAbc->Err, "    -q cmd\texecute commands `cmd' quietly\n");
@@ -143,6 +143,7 @@ void Abc_UtilsPrintUsage( Abc_Frame_t * pAbc, char * ProgName )
     fprintf( pAbc->Err, "    -T type\tspecify output type (blif_mv (default), blif_mvs, blif, or none)\n");
     fprintf( pAbc->Err, "    -x\t\tequivalent to '-t none -T none'\n");
     fprintf( pAbc->Err, "    -b\t\trunning in bridge mode\n");
+    fprintf( pAbc->Err, "    -P num\tthe number of threads shared by all multi-threaded commands (0 = all CPUs)\n");
     fprintf( pAbc->Err, "\n" );
 }
 
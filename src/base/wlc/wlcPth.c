@@ -20,6 +20,7 @@
 
 #include "wlc.h"
 #include "sat/bmc/bmc.h"
+#include "misc/util/utilPool.h"
 
 #ifdef ABC_USE_PTHREADS
 
@@ -66,6 +67,9 @@ typedef struct Bmc3_ThData_t_
 // mutext to control access to shared variables
 extern pthread_mutex_t g_mutex;
 
+// the private pool running the concurrent BMC
+static Abc_Pool_t * g_pBmc3Pool = NULL;
+
 void Wla_ManJoinThread( Wla_Man_t * pWla, int RunId )
 {
     int status;
@@ -76,10 +80,11 @@ void Wla_ManJoinThread( Wla_Man_t * pWla, int RunId )
         status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
     }
 
-    status = pthread_join( *(pthread_t *)(pWla->pThread), NULL );
-    assert( status == 0 );
-    ABC_FREE( pWla->pThread );
+    Abc_TaskWait( (Abc_Task_t *)pWla->pThread );
+    Abc_TaskFree( (Abc_Task_t *)pWla->pThread );
     pWla->pThread = NULL;
+    Abc_PoolStop( g_pBmc3Pool );
+    g_pBmc3Pool = NULL;
 }
     
 void * Wla_Bmc3Thread ( void * pArg )
@@ -136,20 +141,15 @@ void * Wla_Bmc3Thread ( void * pArg )
     Abc_NtkDelete( pAbcNtk );
     Aig_ManStop( pData->pAig );
     ABC_FREE( pData );
-
-    // quit this thread
-    pthread_exit( NULL );
-    assert(0);
     return NULL;
 }
 
 void Wla_ManConcurrentBmc3( Wla_Man_t * pWla, Aig_Man_t * pAig, Abc_Cex_t ** ppCex )
 {
-    int status;
     Bmc3_ThData_t * pData;
 
     assert( pWla->pThread == NULL );
-    pWla->pThread = (void *)ABC_CALLOC( pthread_t, 1 );
+    assert( g_pBmc3Pool == NULL );
 
     pData = ABC_CALLOC( Bmc3_ThData_t, 1 );
     pData->pWla = pWla;
@@ -158,8 +158,9 @@ void Wla_ManConcurrentBmc3( Wla_Man_t * pWla, Aig_Man_t * pAig, Abc_Cex_t ** ppC
     pData->RunId = g_nRunIds;
     pData->fVerbose = pWla->pPars->fVerbose;
 
-    status = pthread_create( (pthread_t *)pWla->pThread, NULL, Wla_Bmc3Thread, pData );
-    assert( status == 0 );
+    // BMC runs next to PDR for the whole iteration, so it gets its own worker
+    g_pBmc3Pool = Abc_PoolStart( 1 );
+    pWla->pThread = (void *)Abc_TaskStartBackground( g_pBmc3Pool, Wla_Bmc3Thread, pData );
 }
 
 #endif // pthreads are used
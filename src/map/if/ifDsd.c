@@ -30,16 +30,7 @@
 #include "bdd/extrab/extraBdd.h"
 #endif
 
-#ifdef ABC_USE_PTHREADS
-
-#ifdef _WIN32
-#include "../lib/pthread.h"
-#else
-#include <pthread.h>
-#include <unistd.h>
-#endif
-
-#endif
+#include "misc/util/utilPool.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -2578,26 +2569,11 @@ typedef struct Ifn_ThData_t_
 void * Ifn_WorkerThread( void * pArg )
 {
     Ifn_ThData_t * pThData = (Ifn_ThData_t *)pArg;
-    volatile int * pPlace = &pThData->Status;
-    abctime clk;
-    while ( 1 )
-    {
-        while ( *pPlace == 0 );
-        assert( pThData->Status == 1 );
-        if ( pThData->Id == -1 )
-        {
-            pthread_exit( NULL );
-            assert( 0 );
-            return NULL;
-        }
-        clk = Abc_Clock();
-        memset( pThData->pConfig, 0, sizeof(word) * pThData->nConfigWords );
-        pThData->Result = Ifn_NtkMatch( pThData->pNtk, pThData->pTruth, pThData->nVars, pThData->nConfls, 0, 0, pThData->pConfig );
-        pThData->clkUsed += Abc_Clock() - clk;
-        pThData->Status = 0;
-//        printf( "Finished object %d\n", pThData->Id );
-    }
-    assert( 0 );
+    abctime clk = Abc_Clock();
+    memset( pThData->pConfig, 0, sizeof(word) * pThData->nConfigWords );
+    pThData->Result = Ifn_NtkMatch( pThData->pNtk, pThData->pTruth, pThData->nVars, pThData->nConfls, 0, 0, pThData->pConfig );
+    pThData->clkUsed += Abc_Clock() - clk;
+//    printf( "Finished object %d\n", pThData->Id );
     return NULL;
 }
 void Id_DsdManTuneStr( If_DsdMan_t * p, char * pStruct, int nConfls, int nProcs, int nInputs, int fVerbose )
@@ -2658,11 +2634,12 @@ void Id_DsdManTuneStr( If_DsdMan_t * p, char * pStruct, int nConfls, int nProcs,
 
     // perform concurrent solving
     {
-        pthread_t WorkerThread[PAR_THR_MAX];
+        Abc_Task_t * pTasks[PAR_THR_MAX];
+        Abc_Pool_t * pPool = Abc_PoolGlobal();
         Ifn_ThData_t ThData[PAR_THR_MAX];
         abctime clk, clkUsed = 0;
-        int status, fRunning = 1, iCurrentObj = p->nObjsPrev;
-        // start the threads
+        int iCurrentObj = p->nObjsPrev;
+        // prepare the task slots
         for ( i = 0; i < nProcs; i++ )
         {
             ThData[i].pNtk     = Ifn_NtkParse( pStruct );
@@ -2673,30 +2650,16 @@ void Id_DsdManTuneStr( If_DsdMan_t * p, char * pStruct, int nConfls, int nProcs,
             ThData[i].Status   =  0;      // state
             ThData[i].clkUsed  =  0;      // total runtime
             ThData[i].nConfigWords = p->nConfigWords;
-            status = pthread_create( WorkerThread + i, NULL, Ifn_WorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+            pTasks[i] = NULL;
         }
-        // run the threads
-        while ( fRunning || iCurrentObj < Vec_PtrSize(&p->vObjs) )
+        // run the tasks
+        while ( 1 )
         {
+            // schedule the next objects into the free slots
             for ( i = 0; i < nProcs; i++ )
             {
-                if ( ThData[i].Status )
+                if ( pTasks[i] )
                     continue;
-                assert( ThData[i].Status == 0 );
-                if ( ThData[i].Id >= 0 )
-                {
-                    //printf( "Closing obj %d with Thread %d:\n", ThData[i].Id, i );
-                    assert( ThData[i].Result == 0 || ThData[i].Result == 1 );
-                    if ( ThData[i].Result == 0 )
-                        If_DsdVecObjSetMark( &p->vObjs, ThData[i].Id );
-                    else
-                    {
-                        word * pTtWords = Vec_WrdEntryP( p->vConfigs, p->nConfigWords * ThData[i].Id );
-                        memcpy( pTtWords, ThData[i].pConfig, sizeof(word) * p->nConfigWords );
-                    }
-                    ThData[i].Id     = -1;
-                    ThData[i].Result = -1;
-                }
                 for ( k = iCurrentObj; k < Vec_PtrSize(&p->vObjs); k++ )
                 {
                     if ( (k & 0xFF) == 0 )
@@ -2712,25 +2675,33 @@ void Id_DsdManTuneStr( If_DsdMan_t * p, char * pStruct, int nConfls, int nProcs,
                     ThData[i].Id     =  k;
                     ThData[i].Result = -1;
                     ThData[i].Status =  1;
+                    pTasks[i] = Abc_TaskStart( pPool, Ifn_WorkerThread, (void *)(ThData + i) );
                     //printf( "Scheduling %d for Thread %d\n", ThData[i].Id, i );
                     iCurrentObj = k+1;
                     break;
                 }
             }
-            fRunning = 0;
-            for ( i = 0; i < nProcs; i++ )
-                if ( ThData[i].Status == 1 || (ThData[i].Status == 0 && ThData[i].Id >= 0) )
-                    fRunning = 1;
-            //printf( "fRunning %d\n", fRunning );
+            // wait for one of the objects to be matched
+            i = Abc_TaskWaitAny( pTasks, nProcs );
+            if ( i == -1 )
+                break;
+            Abc_TaskFree( pTasks[i] );
+            pTasks[i] = NULL;
+            ThData[i].Status = 0;
+            //printf( "Closing obj %d with Thread %d:\n", ThData[i].Id, i );
+            assert( ThData[i].Result == 0 || ThData[i].Result == 1 );
+            if ( ThData[i].Result == 0 )
+                If_DsdVecObjSetMark( &p->vObjs, ThData[i].Id );
+            else
+            {
+                word * pTtWords = Vec_WrdEntryP( p->vConfigs, p->nConfigWords * ThData[i].Id );
+                memcpy( pTtWords, ThData[i].pConfig, sizeof(word) * p->nConfigWords );
+            }
+            ThData[i].Id     = -1;
+            ThData[i].Result = -1;
         }
-        // stop the threads
         for ( i = 0; i < nProcs; i++ )
-        {
-            assert( ThData[i].Status == 0 );
-            ThData[i].Id = -1;
-            ThData[i].Status = 1;
             ABC_FREE( ThData[i].pNtk );
-        }
         if ( fVerbose )
         {
             printf( "Main     : " );
@@ -152,13 +152,15 @@ int Scl_CommandReadLib( Abc_Frame_t * pAbc, int argc, char ** argv )
     float Slew = 0;
     float Gain = 0;
     int nGatesMin = 0;
+    int nThreads = 0;
     int fShortNames = 0;
+    int fUseCache = 0;
     int fUnit = 0;
     int fVerbose = 1;
     int fVeryVerbose = 0;
 
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "SGMdnuvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "SGMPcdnuvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -195,6 +197,20 @@ int Scl_CommandReadLib( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( nGatesMin < 0 ) 
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by a positive integer.\n" );
+                goto usage;
+            }
+            nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nThreads < 0 ) 
+                goto usage;
+            break;
+        case 'c':
+            fUseCache ^= 1;
+            break;
         case 'd':
             fDump ^= 1;
             break;
@@ -227,7 +243,7 @@ int Scl_CommandReadLib( Abc_Frame_t * pAbc, int argc, char ** argv )
     }
     fclose( pFile );
     // read new library
-    pLib = Abc_SclReadLiberty( pFileName, fVerbose, fVeryVerbose );
+    pLib = Abc_SclReadLiberty( pFileName, fUseCache, nThreads, fVerbose, fVeryVerbose );
     if ( pLib == NULL )
     {
         fprintf( pAbc->Err, "Reading SCL library from file \"%s\" has failed. \n", pFileName );
@@ -261,11 +277,13 @@ int Scl_CommandReadLib( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: read_lib [-SG float] [-M num] [-dnuvwh] <file>\n" );
+    fprintf( pAbc->Err, "usage: read_lib [-SG float] [-MP num] [-cdnuvwh] <file>\n" );
     fprintf( pAbc->Err, "\t           reads Liberty library from file\n" );
     fprintf( pAbc->Err, "\t-S float : the slew parameter used to generate the library [default = %.2f]\n", Slew );
     fprintf( pAbc->Err, "\t-G float : the gain parameter used to generate the library [default = %.2f]\n", Gain );
     fprintf( pAbc->Err, "\t-M num   : skip gate classes whose size is less than this [default = %d]\n", nGatesMin );
+    fprintf( pAbc->Err, "\t-P num   : the number of threads reading the cells [default = %d]\n", nThreads );
+    fprintf( pAbc->Err, "\t-c       : toggle using the binary library cache \"<file>.sclc\" [default = %s]\n", fUseCache? "yes": "no" );
     fprintf( pAbc->Err, "\t-d       : toggle dumping the parsed library into file \"*_temp.lib\" [default = %s]\n", fDump? "yes": "no" );
     fprintf( pAbc->Err, "\t-n       : toggle replacing gate/pin names by short strings [default = %s]\n", fShortNames? "yes": "no" );
     fprintf( pAbc->Err, "\t-u       : toggle setting unit area for all cells [default = %s]\n", fUnit? "yes": "no" );
@@ -1394,13 +1412,14 @@ int Scl_CommandUpsize( Abc_Frame_t * pAbc, int argc, char **argv )
     pPars->TimeOut       =    0;
     pPars->BuffTreeEst   =    0;
     pPars->BypassFreq    =    0;
+    pPars->nThreads      =    0;
     pPars->fUseDept      =    1;
     pPars->fUseWireLoads =    0;
     pPars->fDumpStats    =    0;
     pPars->fVerbose      =    0;
     pPars->fVeryVerbose  =    0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "IJWRNDGTXBcsdvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "IJWRNDGTXBPcsdvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -1512,6 +1531,17 @@ int Scl_CommandUpsize( Abc_Frame_t * pAbc, int argc, char **argv )
             if ( pPars->BypassFreq < 0 ) 
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by a positive integer.\n" );
+                goto usage;
+            }
+            pPars->nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nThreads < 0 ) 
+                goto usage;
+            break;
         case 'c':
             pPars->fUseWireLoads ^= 1;
             break;
@@ -1559,7 +1589,7 @@ int Scl_CommandUpsize( Abc_Frame_t * pAbc, int argc, char **argv )
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: upsize [-IJWRNDGTXB num] [-csdvwh]\n" );
+    fprintf( pAbc->Err, "usage: upsize [-IJWRNDGTXBP num] [-csdvwh]\n" );
     fprintf( pAbc->Err, "\t           selectively increases gate sizes on the critical path\n" );
     fprintf( pAbc->Err, "\t-I <num> : the number of upsizing iterations to perform [default = %d]\n", pPars->nIters );
     fprintf( pAbc->Err, "\t-J <num> : the number of iterations without improvement to stop [default = %d]\n", pPars->nIterNoChange );
@@ -1571,6 +1601,7 @@ usage:
     fprintf( pAbc->Err, "\t-T <num> : approximate timeout in seconds [default = %d]\n", pPars->TimeOut );
     fprintf( pAbc->Err, "\t-X <num> : ratio for buffer tree estimation [default = %d]\n", pPars->BuffTreeEst );
     fprintf( pAbc->Err, "\t-B <num> : frequency of bypass transforms [default = %d]\n", pPars->BypassFreq );
+    fprintf( pAbc->Err, "\t-P <num> : the number of threads evaluating gate swaps [default = %d]\n", pPars->nThreads );
     fprintf( pAbc->Err, "\t-c       : toggle using wire-loads if specified [default = %s]\n", pPars->fUseWireLoads? "yes": "no" );
     fprintf( pAbc->Err, "\t-s       : toggle using slack based on departure times [default = %s]\n", pPars->fUseDept? "yes": "no" );
     fprintf( pAbc->Err, "\t-d       : toggle dumping statistics into a file [default = %s]\n", pPars->fDumpStats? "yes": "no" );
@@ -1604,13 +1635,14 @@ int Scl_CommandDnsize( Abc_Frame_t * pAbc, int argc, char **argv )
     pPars->DelayGap      = 1000;
     pPars->TimeOut       =    0;
     pPars->BuffTreeEst   =    0;
+    pPars->nThreads      =    0;
     pPars->fUseDept      =    1;
     pPars->fUseWireLoads =    0;
     pPars->fDumpStats    =    0;
     pPars->fVerbose      =    0;
     pPars->fVeryVerbose  =    0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "IJNDGTXcsdvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "IJNDGTXPcsdvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -1689,6 +1721,17 @@ int Scl_CommandDnsize( Abc_Frame_t * pAbc, int argc, char **argv )
             if ( pPars->BuffTreeEst < 0 ) 
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by a positive integer.\n" );
+                goto usage;
+            }
+            pPars->nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nThreads < 0 ) 
+                goto usage;
+            break;
         case 'c':
             pPars->fUseWireLoads ^= 1;
             break;
@@ -1736,7 +1779,7 @@ int Scl_CommandDnsize( Abc_Frame_t * pAbc, int argc, char **argv )
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: dnsize [-IJNDGTX num] [-csdvwh]\n" );
+    fprintf( pAbc->Err, "usage: dnsize [-IJNDGTXP num] [-csdvwh]\n" );
     fprintf( pAbc->Err, "\t           selectively decreases gate sizes while maintaining delay\n" );
     fprintf( pAbc->Err, "\t-I <num> : the number of upsizing iterations to perform [default = %d]\n", pPars->nIters );
     fprintf( pAbc->Err, "\t-J <num> : the number of iterations without improvement to stop [default = %d]\n", pPars->nIterNoChange );
@@ -1745,6 +1788,7 @@ usage:
     fprintf( pAbc->Err, "\t-G <num> : delay gap during updating, in picoseconds [default = %d]\n", pPars->DelayGap );
     fprintf( pAbc->Err, "\t-T <num> : approximate timeout in seconds [default = %d]\n", pPars->TimeOut );
     fprintf( pAbc->Err, "\t-X <num> : ratio for buffer tree estimation [default = %d]\n", pPars->BuffTreeEst );
+    fprintf( pAbc->Err, "\t-P <num> : the number of threads evaluating gate swaps [default = %d]\n", pPars->nThreads );
     fprintf( pAbc->Err, "\t-c       : toggle using wire-loads if specified [default = %s]\n", pPars->fUseWireLoads? "yes": "no" );
     fprintf( pAbc->Err, "\t-s       : toggle using slack based on departure times [default = %s]\n", pPars->fUseDept? "yes": "no" );
     fprintf( pAbc->Err, "\t-d       : toggle dumping statistics into a file [default = %s]\n", pPars->fDumpStats? "yes": "no" );
@@ -90,23 +90,22 @@ void Abc_SclFindWindow( Abc_Obj_t * pPivot, Vec_Int_t ** pvNodes, Vec_Int_t ** p
 
 /**Function*************************************************************
 
-  Synopsis    [Returns 1 if the node can be improved.]
+  Synopsis    [Finds the best smaller gate for the node.]
 
-  Description [Updated the node to have a new gate.]
+  Description [Returns the best gate or -1 if the node cannot be improved.
+  Gates are tried without changing the network, so several nodes can be
+  evaluated at the same time using different managers.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-int Abc_SclCheckImprovement( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vNodes, Vec_Int_t * vEvals, int Notches, int DelayGap )
+int Abc_SclFindBestCellDn( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vNodes, Vec_Int_t * vEvals, int Notches, int DelayGap, float * pGainBest )
 {
-    Abc_Obj_t * pTemp;
     SC_Cell * pCellOld, * pCellNew;
     float dGain, dGainBest;
-    int i, k, gateBest;
-    abctime clk;
-clk = Abc_Clock();
+    int i, gateBest;
 //    printf( "%d -> %d\n", Vec_IntSize(vNodes), Vec_IntSize(vEvals) );
     // save old gate, timing, fanin load
     pCellOld = Abc_SclObjCell( pObj );
@@ -122,13 +121,14 @@ clk = Abc_Clock();
             continue;
         if ( i > Notches )
             break;
-        // set new cell
-        Abc_SclObjSetCell( pObj, pCellNew );
+        // try new cell
+        p->pTrialObj  = pObj;
+        p->pTrialCell = pCellNew;
         Abc_SclUpdateLoad( p, pObj, pCellOld, pCellNew );
         // recompute timing
         Abc_SclTimeCone( p, vNodes );
-        // set old cell
-        Abc_SclObjSetCell( pObj, pCellOld );
+        // return to old cell
+        p->pTrialObj  = NULL;
         Abc_SclLoadRestore( p, pObj );
         // evaluate gain
         dGain = Abc_SclEvalPerformLegal( p, vEvals, p->MaxDelay0 );
@@ -141,23 +141,64 @@ clk = Abc_Clock();
             gateBest = pCellNew->Id;
         }
     } 
-    // put back old cell and timing
-    Abc_SclObjSetCell( pObj, pCellOld );
+    // put back old timing
     Abc_SclConeRestore( p, vNodes );
+    *pGainBest = dGainBest;
+    return gateBest;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Updates the node to have a new gate.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclApplyImprovement( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vNodes, int gateBest )
+{
+    Abc_Obj_t * pTemp;
+    SC_Cell * pCellOld = Abc_SclObjCell( pObj );
+    SC_Cell * pCellNew = SC_LibCell( p->pLib, gateBest );
+    int k;
+    Abc_SclObjSetCell( pObj, pCellNew );
+    p->SumArea += pCellNew->area - pCellOld->area;
+//    printf( "%f   %f -> %f\n", pCellNew->area - pCellOld->area, p->SumArea - (pCellNew->area - pCellOld->area), p->SumArea );
+//    printf( "%6d  %20s -> %20s  %f -> %f\n", Abc_ObjId(pObj), pCellOld->pName, pCellNew->pName, pCellOld->area, pCellNew->area );
+    // mark used nodes with the current trav ID
+    Abc_NtkForEachObjVec( vNodes, p->pNtk, pTemp, k )
+        Abc_NodeSetTravIdCurrent( pTemp );
+    // update load and timing...
+    Abc_SclUpdateLoad( p, pObj, pCellOld, pCellNew );
+    Abc_SclTimeIncInsert( p, pObj );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the node can be improved.]
+
+  Description [Updated the node to have a new gate.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+
+***********************************************************************/
+int Abc_SclCheckImprovement( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vNodes, Vec_Int_t * vEvals, int Notches, int DelayGap )
+{
+    float dGainBest;
+    int gateBest;
+    abctime clk;
+clk = Abc_Clock();
+    gateBest = Abc_SclFindBestCellDn( p, pObj, vNodes, vEvals, Notches, DelayGap, &dGainBest );
 p->timeSize += Abc_Clock() - clk;
     if ( gateBest >= 0 )
     {
-        pCellNew = SC_LibCell( p->pLib, gateBest );
-        Abc_SclObjSetCell( pObj, pCellNew );
-        p->SumArea += pCellNew->area - pCellOld->area;
-//        printf( "%f   %f -> %f\n", pCellNew->area - pCellOld->area, p->SumArea - (pCellNew->area - pCellOld->area), p->SumArea );
-//        printf( "%6d  %20s -> %20s  %f -> %f\n", Abc_ObjId(pObj), pCellOld->pName, pCellNew->pName, pCellOld->area, pCellNew->area );
-        // mark used nodes with the current trav ID
-        Abc_NtkForEachObjVec( vNodes, p->pNtk, pTemp, k )
-            Abc_NodeSetTravIdCurrent( pTemp );
-        // update load and timing...
-        Abc_SclUpdateLoad( p, pObj, pCellOld, pCellNew );
-        Abc_SclTimeIncInsert( p, pObj );
+        Abc_SclApplyImprovement( p, pObj, vNodes, gateBest );
         return 1;
     }
     return 0;
@@ -197,6 +238,83 @@ int Abc_SclCheckOverlap( Abc_Ntk_t * pNtk, Vec_Int_t * vNodes )
     return 0;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Performs one round of downsizing using several threads.]
+
+  Description [Nodes are taken from the queue in batches. The windows of
+  a batch are evaluated concurrently against the current timing, and the
+  improvements are applied in the queue order. A node whose window overlaps
+  a window updated earlier in this round is postponed, exactly as in the
+  sequential round, so the result does not depend on the thread count.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclDnsizeRoundPar( SC_Man * p, SC_SizePars * pPars, Vec_Int_t * vTryLater, int * pnAttempt, int * pnOverlap, int * pnChanges )
+{
+    int nBatch = 16 * pPars->nThreads;
+    Vec_Int_t * vNodes  = Vec_IntAlloc( 100 );
+    Vec_Int_t * vEvals  = Vec_IntAlloc( 100 );
+    Vec_Int_t * vPopped = Vec_IntAlloc( nBatch );
+    Vec_Int_t * vCands  = Vec_IntAlloc( nBatch );
+    Vec_Wec_t * vNodesW = Vec_WecAlloc( nBatch );
+    Vec_Wec_t * vEvalsW = Vec_WecAlloc( nBatch );
+    Vec_Int_t * vGates  = Vec_IntAlloc( nBatch );
+    Vec_Flt_t * vGains  = Vec_FltAlloc( nBatch );
+    Abc_Obj_t * pObj;
+    abctime clk;
+    int i, k;
+    while ( Vec_QueSize(p->vNodeByGain) > 0 )
+    {
+        // collect nodes whose windows do not overlap the updated windows
+        clk = Abc_Clock();
+        Vec_IntClear( vPopped );
+        Vec_IntClear( vCands );
+        Vec_WecClear( vNodesW );
+        Vec_WecClear( vEvalsW );
+        while ( Vec_QueSize(p->vNodeByGain) > 0 && Vec_IntSize(vCands) < nBatch )
+        {
+            pObj = Abc_NtkObj( p->pNtk, Vec_QuePop(p->vNodeByGain) );
+            Vec_IntPush( vPopped, Abc_ObjId(pObj) );
+            Abc_SclFindWindow( pObj, &vNodes, &vEvals );
+            if ( Abc_SclCheckOverlap( p->pNtk, vNodes ) )
+                continue;
+            Vec_IntAppend( Vec_WecPushLevel(vNodesW), vNodes );
+            Vec_IntAppend( Vec_WecPushLevel(vEvalsW), vEvals );
+            Vec_IntPush( vCands, Abc_ObjId(pObj) );
+        }
+        p->timeCone += Abc_Clock() - clk;
+        // evaluate them concurrently
+        clk = Abc_Clock();
+        Abc_SclEvalPar( p, pPars->nThreads, Abc_SclFindBestCellDn, vCands, vNodesW, vEvalsW, pPars->Notches, pPars->DelayGap, vGates, vGains );
+        p->timeSize += Abc_Clock() - clk;
+        // apply improvements in the order of nodes, postponing the overlapping ones
+        for ( i = k = 0; i < Vec_IntSize(vPopped); i++ )
+        {
+            int fCand = k < Vec_IntSize(vCands) && Vec_IntEntry(vCands, k) == Vec_IntEntry(vPopped, i);
+            pObj = Abc_NtkObj( p->pNtk, Vec_IntEntry(vPopped, i) );
+            if ( !fCand || Abc_SclCheckOverlap( p->pNtk, Vec_WecEntry(vNodesW, k) ) )
+                (*pnOverlap)++, Vec_IntPush( vTryLater, Abc_ObjId(pObj) );
+            else if ( Vec_IntEntry(vGates, k) >= 0 )
+                (*pnChanges)++, Abc_SclApplyImprovement( p, pObj, Vec_WecEntry(vNodesW, k), Vec_IntEntry(vGates, k) );
+            (*pnAttempt)++;
+            k += fCand;
+        }
+        assert( k == Vec_IntSize(vCands) );
+    }
+    Vec_IntFree( vNodes );
+    Vec_IntFree( vEvals );
+    Vec_IntFree( vPopped );
+    Vec_IntFree( vCands );
+    Vec_WecFree( vNodesW );
+    Vec_WecFree( vEvalsW );
+    Vec_IntFree( vGates );
+    Vec_FltFree( vGains );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Print cumulative statistics.]
@@ -279,6 +397,9 @@ void Abc_SclDnsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
             int nAttempt = 0, nOverlap = 0, nChanges = 0;
             Vec_IntClear( vTryLater );
             Abc_NtkIncrementTravId( pNtk );
+            if ( pPars->nThreads > 1 )
+                Abc_SclDnsizeRoundPar( p, pPars, vTryLater, &nAttempt, &nOverlap, &nChanges );
+            else
             while ( Vec_QueSize(p->vNodeByGain) > 0 )
             {
                 clk = Abc_Clock();
@@ -342,6 +463,7 @@ void Abc_SclDnsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
 
     // save the result and quit
     Abc_SclSclGates2MioGates( pLib, pNtk ); // updates gate pointers
+    Abc_SclEvalParStop( p );
     Abc_SclManFree( p );
 //    Abc_NtkCleanMarkAB( pNtk );
 }
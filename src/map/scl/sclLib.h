@@ -85,6 +85,7 @@ struct SC_SizePars_
     int        TimeOut;
     int        BuffTreeEst;      // ratio for buffer tree estimation
     int        BypassFreq;       // frequency to try bypassing
+    int        nThreads;         // the number of threads evaluating gate swaps
     int        fUseDept;
     int        fDumpStats;
     int        fUseWireLoads;
@@ -734,7 +735,11 @@ static inline void Scl_LibHandleInputDriver2( SC_Cell * pCell, SC_PairI * pLoadI
 }
 
 /*=== sclLiberty.c ===============================================================*/
-extern SC_Lib *      Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose );
+extern SC_Lib *      Abc_SclReadLiberty( char * pFileName, int fUseCache, int nThreads, int fVerbose, int fVeryVerbose );
+/*=== sclLibCache.c ===============================================================*/
+extern char *        Abc_SclCacheFileName( char * pFileName );
+extern SC_Lib *      Abc_SclCacheRead( char * pFileName, int fVerbose );
+extern int           Abc_SclCacheWrite( char * pFileName, Vec_Str_t * vData, int fVerbose );
 /*=== sclLibScl.c ===============================================================*/
 extern SC_Lib *      Abc_SclReadFromGenlib( void * pLib );
 extern SC_Lib *      Abc_SclReadFromStr( Vec_Str_t * vOut );
@@ -0,0 +1,258 @@
+/**CFile****************************************************************
+
+  FileName    [sclLibCache.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Standard-cell library representation.]
+
+  Synopsis    [Binary cache of the libraries read from Liberty files.]
+
+  Author      [Alan Mishchenko, Niklas Een]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - August 24, 2012.]
+
+  Revision    [$Id: sclLibCache.c,v 1.0 2012/08/24 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "sclLib.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The cache file "<library>.sclc" is written next to the Liberty file.
+// It contains the library in the SCL format produced by the Liberty reader:
+//   - the header (magic string, version, size and hash of the Liberty file,
+//     size and hash of the library data)
+//   - the library data, which is the string read by Abc_SclReadFromStr()
+// When the cache is used, the file is mapped into memory and the library
+// is derived directly from the mapped data, without parsing the Liberty
+// file. The cache is not used if the Liberty file has changed or if the
+// library data does not match its hash.
+
+#define SCL_CACHE_MAGIC   "ABCSCLIB"
+#define SCL_CACHE_VERSION 2
+
+typedef struct Scl_CacheHead_t_ Scl_CacheHead_t;
+struct Scl_CacheHead_t_
+{
+    char            pMagic[8];   // the magic string
+    int             Version;     // the cache version
+    int             SclVersion;  // the version of the SCL format
+    word            FileSize;    // the size of the Liberty file
+    word            FileHash;    // the hash of the Liberty file
+    word            DataSize;    // the size of the library data
+    word            DataHash;    // the hash of the library data
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the name of the cache file.]
+
+  Description [The caller should free the name.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Abc_SclCacheFileName( char * pFileName )
+{
+    char * pCacheName = ABC_ALLOC( char, strlen(pFileName) + 6 );
+    sprintf( pCacheName, "%s.sclc", pFileName );
+    return pCacheName;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the hash of a memory buffer.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+word Abc_SclCacheHash( char * pData, iword nSize )
+{
+    word Hash = ABC_CONST(0xcbf29ce484222325), Word;
+    iword i;
+    for ( i = 0; i + 8 <= nSize; i += 8 )
+    {
+        memcpy( &Word, pData + i, 8 );
+        Hash ^= Word;
+        Hash *= ABC_CONST(0x100000001b3);
+    }
+    for ( ; i < nSize; i++ )
+    {
+        Hash ^= (word)(unsigned char)pData[i];
+        Hash *= ABC_CONST(0x100000001b3);
+    }
+    return Hash;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the hash of the Liberty file.]
+
+  Description [Returns 0 if the file cannot be read. Otherwise, returns
+  1 and sets the size and the hash of the file contents.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_SclCacheHashFile( char * pFileName, word * pSize, word * pHash )
+{
+    iword nSize;
+    char * pContents = Abc_FileMap( pFileName, &nSize );
+    if ( pContents == NULL )
+        return 0;
+    *pSize = (word)nSize;
+    *pHash = Abc_SclCacheHash( pContents, nSize );
+    Abc_FileUnmap( pContents, nSize );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the library from the cache.]
+
+  Description [Returns NULL if there is no cache for this Liberty file,
+  if the Liberty file has changed after the cache was written, or if the
+  cached library data is corrupted.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+SC_Lib * Abc_SclCacheRead( char * pFileName, int fVerbose )
+{
+    abctime clk = Abc_Clock();
+    char * pCacheName = Abc_SclCacheFileName( pFileName );
+    Scl_CacheHead_t Head;
+    Vec_Str_t Data, * vData = &Data;
+    SC_Lib * pLib = NULL;
+    word FileSize, FileHash;
+    iword nSize;
+    char * pContents = Abc_FileMap( pCacheName, &nSize );
+    if ( pContents == NULL )
+    {
+        ABC_FREE( pCacheName );
+        return NULL;
+    }
+    if ( nSize < (iword)sizeof(Scl_CacheHead_t) )
+        goto finish;
+    memcpy( &Head, pContents, sizeof(Scl_CacheHead_t) );
+    if ( memcmp(Head.pMagic, SCL_CACHE_MAGIC, 8) || Head.Version != SCL_CACHE_VERSION || Head.SclVersion != ABC_SCL_CUR_VERSION )
+        goto finish;
+    if ( Head.DataSize != (word)(nSize - sizeof(Scl_CacheHead_t)) || Head.DataSize >= (word)ABC_INFINITY )
+        goto finish;
+    if ( !Abc_SclCacheHashFile(pFileName, &FileSize, &FileHash) || FileSize != Head.FileSize || FileHash != Head.FileHash )
+        goto finish;
+    if ( Abc_SclCacheHash(pContents + sizeof(Scl_CacheHead_t), (iword)Head.DataSize) != Head.DataHash )
+    {
+        if ( fVerbose )
+            printf( "The library cache \"%s\" is corrupted and will be ignored.\n", pCacheName );
+        goto finish;
+    }
+    // derive the library from the mapped data
+    vData->nCap    = (int)Head.DataSize;
+    vData->nSize   = (int)Head.DataSize;
+    vData->pArray  = pContents + sizeof(Scl_CacheHead_t);
+    pLib = Abc_SclReadFromStr( vData );
+    if ( pLib == NULL )
+        goto finish;
+    pLib->pFileName = Abc_UtilStrsav( pFileName );
+    Abc_SclLibNormalize( pLib );
+    if ( fVerbose )
+    {
+        printf( "Library \"%s\" from \"%s\" has %d cells (loaded from binary cache \"%s\").  ",
+            pLib->pName, pFileName, SC_LibCellNum(pLib), pCacheName );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+finish:
+    Abc_FileUnmap( pContents, nSize );
+    ABC_FREE( pCacheName );
+    return pLib;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the library into the cache.]
+
+  Description [The data is written into a temporary file, which then
+  replaces the cache, so that an interrupted run does not leave behind
+  a partially written cache. On POSIX systems, rename() replaces the
+  cache atomically. On Windows, rename() fails if the target exists,
+  so the old cache is removed first.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_SclCacheWrite( char * pFileName, Vec_Str_t * vData, int fVerbose )
+{
+    char * pCacheName = Abc_SclCacheFileName( pFileName );
+    char * pFileTemp = ABC_ALLOC( char, strlen(pCacheName) + 5 );
+    Scl_CacheHead_t Head;
+    int RetValue = 1;
+    FILE * pFile;
+    memset( &Head, 0, sizeof(Scl_CacheHead_t) );
+    memcpy( Head.pMagic, SCL_CACHE_MAGIC, 8 );
+    Head.Version    = SCL_CACHE_VERSION;
+    Head.SclVersion = ABC_SCL_CUR_VERSION;
+    Head.DataSize   = (word)Vec_StrSize(vData);
+    Head.DataHash   = Abc_SclCacheHash( Vec_StrArray(vData), (iword)Vec_StrSize(vData) );
+    sprintf( pFileTemp, "%s.tmp", pCacheName );
+    pFile = Abc_SclCacheHashFile(pFileName, &Head.FileSize, &Head.FileHash) ? fopen( pFileTemp, "wb" ) : NULL;
+    if ( pFile == NULL )
+    {
+        if ( fVerbose )
+            printf( "Cannot open file \"%s\" for writing.\n", pFileTemp );
+        ABC_FREE( pFileTemp );
+        ABC_FREE( pCacheName );
+        return 0;
+    }
+    RetValue &= fwrite( &Head, sizeof(Scl_CacheHead_t), 1, pFile ) == 1;
+    RetValue &= (int)fwrite( Vec_StrArray(vData), 1, (size_t)Vec_StrSize(vData), pFile ) == Vec_StrSize(vData);
+    RetValue &= fclose( pFile ) == 0;
+    if ( RetValue )
+    {
+#ifdef _WIN32
+        remove( pCacheName );
+#endif
+        RetValue = rename( pFileTemp, pCacheName ) == 0;
+    }
+    if ( !RetValue )
+    {
+        if ( fVerbose )
+            printf( "Cannot write the library cache into file \"%s\".\n", pCacheName );
+        remove( pFileTemp );
+    }
+    ABC_FREE( pFileTemp );
+    ABC_FREE( pCacheName );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
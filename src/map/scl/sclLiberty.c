@@ -21,6 +21,7 @@
 #include "sclLib.h"
 #include "misc/st/st.h"
 #include "map/mio/mio.h"
+#include "misc/util/utilPool.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -1004,12 +1005,25 @@ int Scl_LibertyReadTimingSense( Scl_Tree_t * p, Scl_Item_t * pPin )
     }
     return sc_ts_Non;
 }
+static inline int Scl_LibertyCharIsDelim( char c )
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\\' || c == '\"' || c == ',';
+}
 Vec_Flt_t * Scl_LibertyReadFloatVec( char * pName )
 {
-    char * pToken;
+    // same as tokenizing with strtok(), which cannot be used by several threads
     Vec_Flt_t * vValues = Vec_FltAlloc( 100 );
-    for ( pToken = strtok(pName, " \t\n\r\\\","); pToken; pToken = strtok(NULL, " \t\n\r\\\",") )
-        Vec_FltPush( vValues, atof(pToken) );
+    char * pCur = pName;
+    while ( 1 )
+    {
+        while ( *pCur && Scl_LibertyCharIsDelim(*pCur) )
+            pCur++;
+        if ( *pCur == 0 )
+            break;
+        Vec_FltPush( vValues, atof(pCur) );
+        while ( *pCur && !Scl_LibertyCharIsDelim(*pCur) )
+            pCur++;
+    }
     return vValues;
 }
 
@@ -1429,15 +1443,256 @@ Vec_Ptr_t * Scl_LibertyReadTemplates( Scl_Tree_t * p )
 //    Scl_LibertyPrintTemplates( vRes );
     return vRes;
 }
-Vec_Str_t * Scl_LibertyReadSclStr( Scl_Tree_t * p, int fVerbose, int fVeryVerbose )
+/**Function*************************************************************
+
+  Synopsis    [Reads one cell into the SCL string.]
+
+  Description [Returns 0 if the cell cannot be read. This procedure changes
+  only the string buffer of the parse tree, so several cells can be read
+  at the same time using parse trees with different string buffers.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Scl_LibertyReadCellStr( Scl_Tree_t * p, Scl_Item_t * pCell, Vec_Ptr_t * vTemples, Vec_Str_t * vOut )
 {
     int fUseFirstTable = 0;
-    Vec_Str_t * vOut;
-    Vec_Ptr_t * vNameIns, * vTemples = NULL;
-    Scl_Item_t * pCell, * pPin, * pTiming;
+    Vec_Ptr_t * vNameIns;
+    Scl_Item_t * pPin, * pTiming;
     Vec_Wrd_t * vTruth;
     char * pFormula, * pName;
-    int i, k, Counter, nOutputs, nCells;
+    int i, k, nOutputs;
+    // top level information
+    Vec_StrPutS_( vOut, Scl_LibertyReadString(p, pCell->Head) );
+    pName = Scl_LibertyReadCellArea(p, pCell);
+    Vec_StrPutF_( vOut, pName ? atof(pName) : 1 );
+    pName = Scl_LibertyReadCellLeakage(p, pCell);
+    Vec_StrPutF_( vOut, pName ? atof(pName) : 0 );
+    Vec_StrPutI_( vOut, Scl_LibertyReadDeriveStrength(p, pCell) );
+    // pin count
+    nOutputs = Scl_LibertyReadCellOutputNum( p, pCell );
+    Vec_StrPutI_( vOut, Scl_LibertyItemNum(p, pCell, "pin") - nOutputs );
+    Vec_StrPutI_( vOut, nOutputs );
+    Vec_StrPut_( vOut );
+    Vec_StrPut_( vOut );
+
+    // input pins
+    vNameIns = Vec_PtrAlloc( 16 );
+    Scl_ItemForEachChildName( p, pCell, pPin, "pin" )
+    {
+        float CapOne, CapRise, CapFall;
+        if ( Scl_LibertyReadPinFormula(p, pPin) != NULL ) // skip output pin
+            continue;
+        assert( Scl_LibertyReadPinDirection(p, pPin) == 0 || Scl_LibertyReadPinDirection(p, pPin) == 2);
+        pName = Scl_LibertyReadString(p, pPin->Head);
+        Vec_PtrPush( vNameIns, Abc_UtilStrsav(pName) );
+        Vec_StrPutS_( vOut, pName );
+        CapOne  = Scl_LibertyReadPinCap( p, pPin, "capacitance" );
+        CapRise = Scl_LibertyReadPinCap( p, pPin, "rise_capacitance" );
+        CapFall = Scl_LibertyReadPinCap( p, pPin, "fall_capacitance" );
+        if ( CapRise == 0 )
+            CapRise = CapOne;
+        if ( CapFall == 0 )
+            CapFall = CapOne;
+        Vec_StrPutF_( vOut, CapRise );
+        Vec_StrPutF_( vOut, CapFall );
+        Vec_StrPut_( vOut );
+    }
+    Vec_StrPut_( vOut );
+    // output pins
+    Scl_ItemForEachChildName( p, pCell, pPin, "pin" )
+    {
+        if ( !Scl_LibertyReadPinFormula(p, pPin) ) // skip input pin
+            continue;
+        if (Scl_LibertyReadPinDirection(p, pPin) == 2) // skip internal pin
+            continue;
+        assert( Scl_LibertyReadPinDirection(p, pPin) == 1 );
+        pName = Scl_LibertyReadString(p, pPin->Head);
+        Vec_StrPutS_( vOut, pName );
+        Vec_StrPutF_( vOut, Scl_LibertyReadPinCap( p, pPin, "max_capacitance" ) );
+        Vec_StrPutF_( vOut, Scl_LibertyReadPinCap( p, pPin, "max_transition" ) );
+        Vec_StrPutI_( vOut, Vec_PtrSize(vNameIns) );
+        pFormula = Scl_LibertyReadPinFormula(p, pPin);
+        Vec_StrPutS_( vOut, pFormula );
+        // write truth table
+        vTruth = Mio_ParseFormulaTruth( pFormula, (char **)Vec_PtrArray(vNameIns), Vec_PtrSize(vNameIns) );
+        if ( vTruth == NULL )
+            return 0;
+        for ( i = 0; i < Abc_Truth6WordNum(Vec_PtrSize(vNameIns)); i++ )
+            Vec_StrPutW_( vOut, Vec_WrdEntry(vTruth, i) );
+        Vec_WrdFree( vTruth );
+        Vec_StrPut_( vOut );
+        Vec_StrPut_( vOut );
+
+        // write the delay tables
+        if ( fUseFirstTable )
+        {
+            Vec_PtrForEachEntry( char *, vNameIns, pName, i )
+            {
+                pTiming = Scl_LibertyReadPinTiming( p, pPin, pName );
+                Vec_StrPutS_( vOut, pName );
+                Vec_StrPutI_( vOut, (int)(pTiming != NULL) );
+                if ( pTiming == NULL ) // output does not depend on input
+                    continue;
+                Vec_StrPutI_( vOut, Scl_LibertyReadTimingSense(p, pTiming) );
+                Vec_StrPut_( vOut );
+                Vec_StrPut_( vOut );
+                // some cells only have 'rise' or 'fall' but not both - here we work around this
+                if ( !Scl_LibertyReadTable( p, vOut, pTiming, "cell_rise",           vTemples ) )
+                    if ( !Scl_LibertyReadTable( p, vOut, pTiming, "cell_fall",       vTemples ) )
+                            { printf( "Table cannot be found\n" ); return 0; }                              
+                if ( !Scl_LibertyReadTable( p, vOut, pTiming, "cell_fall",           vTemples ) )
+                    if ( !Scl_LibertyReadTable( p, vOut, pTiming, "cell_rise",       vTemples ) )
+                            { printf( "Table cannot be found\n" ); return 0; }                              
+                if ( !Scl_LibertyReadTable( p, vOut, pTiming, "rise_transition",     vTemples ) )
+                    if ( !Scl_LibertyReadTable( p, vOut, pTiming, "fall_transition", vTemples ) )
+                            { printf( "Table cannot be found\n" ); return 0; }                              
+                if ( !Scl_LibertyReadTable( p, vOut, pTiming, "fall_transition",     vTemples ) )
+                    if ( !Scl_LibertyReadTable( p, vOut, pTiming, "rise_transition", vTemples ) )
+                            { printf( "Table cannot be found\n" ); return 0; }  
+            }
+            continue;
+        }
+
+        // write the timing tables
+        Vec_PtrForEachEntry( char *, vNameIns, pName, i )
+        {
+            Vec_Ptr_t * vTables[4];
+            Vec_Ptr_t * vTimings;
+            vTimings = Scl_LibertyReadPinTimingAll( p, pPin, pName );
+            Vec_StrPutS_( vOut, pName );
+            Vec_StrPutI_( vOut, (int)(Vec_PtrSize(vTimings) != 0) );
+            if ( Vec_PtrSize(vTimings) == 0 ) // output does not depend on input
+            {
+                Vec_PtrFree( vTimings );
+                continue;
+            }
+            Vec_StrPutI_( vOut, Scl_LibertyReadTimingSense(p, (Scl_Item_t *)Vec_PtrEntry(vTimings, 0)) );
+            Vec_StrPut_( vOut );
+            Vec_StrPut_( vOut );
+            // collect the timing tables
+            for ( k = 0; k < 4; k++ )
+                vTables[k] = Vec_PtrAlloc( 16 );
+            Vec_PtrForEachEntry( Scl_Item_t *, vTimings, pTiming, k )
+            {
+                // some cells only have 'rise' or 'fall' but not both - here we work around this
+                if ( !Scl_LibertyScanTable( p, vTables[0], pTiming, "cell_rise",           vTemples ) )
+                    if ( !Scl_LibertyScanTable( p, vTables[0], pTiming, "cell_fall",       vTemples ) )
+                            { printf( "Table cannot be found\n" ); return 0; }                              
+                if ( !Scl_LibertyScanTable( p, vTables[1], pTiming, "cell_fall",           vTemples ) )
+                    if ( !Scl_LibertyScanTable( p, vTables[1], pTiming, "cell_rise",       vTemples ) )
+                            { printf( "Table cannot be found\n" ); return 0; }                              
+                if ( !Scl_LibertyScanTable( p, vTables[2], pTiming, "rise_transition",     vTemples ) )
+                    if ( !Scl_LibertyScanTable( p, vTables[2], pTiming, "fall_transition", vTemples ) )
+                            { printf( "Table cannot be found\n" ); return 0; }                              
+                if ( !Scl_LibertyScanTable( p, vTables[3], pTiming, "fall_transition",     vTemples ) )
+                    if ( !Scl_LibertyScanTable( p, vTables[3], pTiming, "rise_transition", vTemples ) )
+                            { printf( "Table cannot be found\n" ); return 0; }  
+            }
+            Vec_PtrFree( vTimings );
+            // compute worse case of the tables
+            for ( k = 0; k < 4; k++ )
+            {
+                Vec_Flt_t * vInd0, * vInd1, * vValues;
+                if ( !Scl_LibertyComputeWorstCase( vTables[k], &vInd0, &vInd1, &vValues ) )
+                    { printf( "Table indexes have different values\n" ); return 0; }  
+                Vec_VecFree( (Vec_Vec_t *)vTables[k] );
+                Scl_LibertyDumpTables( vOut, vInd0, vInd1, vValues );
+                Vec_FltFree( vInd0 );
+                Vec_FltFree( vInd1 );
+                Vec_FltFree( vValues );
+            }
+        }
+    }
+    Vec_StrPut_( vOut );
+    Vec_PtrFreeFree( vNameIns );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the cells using several threads.]
+
+  Description [Each thread reads every nThreads-th cell into a separate
+  string, using a copy of the parse tree with its own string buffer.
+  The strings are then concatenated in the original order, so the result
+  does not depend on the number of threads.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Scl_LibertyJob_t_ Scl_LibertyJob_t;
+struct Scl_LibertyJob_t_
+{
+    Scl_Tree_t *    p;           // the parse tree
+    Vec_Ptr_t *     vCells;      // the cells to read
+    Vec_Ptr_t *     vTemples;    // the table templates
+    Vec_Ptr_t *     vStrs;       // the strings of the cells
+    int             iStart;      // the first cell of this job
+    int             nStep;       // the distance between the cells
+    int             RetValue;    // becomes 0 if a cell cannot be read
+};
+static void * Scl_LibertyReadCellsTask( void * pArg )
+{
+    Scl_LibertyJob_t * pJob = (Scl_LibertyJob_t *)pArg;
+    Scl_Tree_t Tree = *pJob->p;
+    int i;
+    Tree.vBuffer = Vec_StrStart( 10 );
+    for ( i = pJob->iStart; i < Vec_PtrSize(pJob->vCells) && pJob->RetValue; i += pJob->nStep )
+        pJob->RetValue = Scl_LibertyReadCellStr( &Tree, (Scl_Item_t *)Vec_PtrEntry(pJob->vCells, i), pJob->vTemples, (Vec_Str_t *)Vec_PtrEntry(pJob->vStrs, i) );
+    Vec_StrFree( Tree.vBuffer );
+    return NULL;
+}
+int Scl_LibertyReadCellsPar( Scl_Tree_t * p, Vec_Ptr_t * vCells, Vec_Ptr_t * vTemples, Vec_Str_t * vOut, int nThreads )
+{
+    Abc_Task_t * pTasks[ABC_POOL_THR_MAX];
+    Scl_LibertyJob_t pJobs[ABC_POOL_THR_MAX];
+    Vec_Ptr_t * vStrs = Vec_PtrAlloc( Vec_PtrSize(vCells) );
+    Vec_Str_t * vStr;
+    int i, t, RetValue = 1;
+    nThreads = Abc_MinInt( nThreads, ABC_POOL_THR_MAX );
+    for ( i = 0; i < Vec_PtrSize(vCells); i++ )
+        Vec_PtrPush( vStrs, Vec_StrAlloc(1000) );
+    for ( t = 0; t < nThreads; t++ )
+    {
+        pJobs[t].p        = p;
+        pJobs[t].vCells   = vCells;
+        pJobs[t].vTemples = vTemples;
+        pJobs[t].vStrs    = vStrs;
+        pJobs[t].iStart   = t;
+        pJobs[t].nStep    = nThreads;
+        pJobs[t].RetValue = 1;
+    }
+    for ( t = 1; t < nThreads; t++ )
+        pTasks[t] = Abc_TaskStart( Abc_PoolGlobal(), Scl_LibertyReadCellsTask, pJobs + t );
+    Scl_LibertyReadCellsTask( pJobs );
+    for ( t = 1; t < nThreads; t++ )
+    {
+        Abc_TaskWait( pTasks[t] );
+        Abc_TaskFree( pTasks[t] );
+    }
+    for ( t = 0; t < nThreads; t++ )
+        RetValue &= pJobs[t].RetValue;
+    Vec_PtrForEachEntry( Vec_Str_t *, vStrs, vStr, i )
+    {
+        if ( RetValue )
+            Vec_StrPushBuffer( vOut, Vec_StrArray(vStr), Vec_StrSize(vStr) );
+        Vec_StrFree( vStr );
+    }
+    Vec_PtrFree( vStrs );
+    return RetValue;
+}
+
+Vec_Str_t * Scl_LibertyReadSclStr( Scl_Tree_t * p, int nThreads, int fVerbose, int fVeryVerbose )
+{
+    Vec_Str_t * vOut;
+    Vec_Ptr_t * vCells, * vTemples = NULL;
+    Scl_Item_t * pCell;
+    int i, Counter, nCells, RetValue = 1;
     int nSkipped[4] = {0};
 
     // read delay-table templates
@@ -1496,6 +1751,7 @@ Vec_Str_t * Scl_LibertyReadSclStr( Scl_Tree_t * p, int fVerbose, int fVeryVerbos
     Vec_StrPutI_( vOut, nCells );
     Vec_StrPut_( vOut );
     Vec_StrPut_( vOut );
+    vCells = Vec_PtrAlloc( nCells );
     Scl_ItemForEachChildName( p, Scl_LibertyRoot(p), pCell, "cell" )
     {
         if ( Scl_LibertyReadCellIsFlop(p, pCell) )
@@ -1506,151 +1762,15 @@ Vec_Str_t * Scl_LibertyReadSclStr( Scl_Tree_t * p, int fVerbose, int fVeryVerbos
             continue;
         if ( (Counter = Scl_LibertyReadCellOutputNum(p, pCell)) == 0 )
             continue;
-        // top level information
-        Vec_StrPutS_( vOut, Scl_LibertyReadString(p, pCell->Head) );
-        pName = Scl_LibertyReadCellArea(p, pCell);
-        Vec_StrPutF_( vOut, pName ? atof(pName) : 1 );
-        pName = Scl_LibertyReadCellLeakage(p, pCell);
-        Vec_StrPutF_( vOut, pName ? atof(pName) : 0 );
-        Vec_StrPutI_( vOut, Scl_LibertyReadDeriveStrength(p, pCell) );
-        // pin count
-        nOutputs = Scl_LibertyReadCellOutputNum( p, pCell );
-        Vec_StrPutI_( vOut, Scl_LibertyItemNum(p, pCell, "pin") - nOutputs );
-        Vec_StrPutI_( vOut, nOutputs );
-        Vec_StrPut_( vOut );
-        Vec_StrPut_( vOut );
-
-        // input pins
-        vNameIns = Vec_PtrAlloc( 16 );
-        Scl_ItemForEachChildName( p, pCell, pPin, "pin" )
-        {
-            float CapOne, CapRise, CapFall;
-            if ( Scl_LibertyReadPinFormula(p, pPin) != NULL ) // skip output pin
-                continue;
-            assert( Scl_LibertyReadPinDirection(p, pPin) == 0 || Scl_LibertyReadPinDirection(p, pPin) == 2);
-            pName = Scl_LibertyReadString(p, pPin->Head);
-            Vec_PtrPush( vNameIns, Abc_UtilStrsav(pName) );
-            Vec_StrPutS_( vOut, pName );
-            CapOne  = Scl_LibertyReadPinCap( p, pPin, "capacitance" );
-            CapRise = Scl_LibertyReadPinCap( p, pPin, "rise_capacitance" );
-            CapFall = Scl_LibertyReadPinCap( p, pPin, "fall_capacitance" );
-            if ( CapRise == 0 )
-                CapRise = CapOne;
-            if ( CapFall == 0 )
-                CapFall = CapOne;
-            Vec_StrPutF_( vOut, CapRise );
-            Vec_StrPutF_( vOut, CapFall );
-            Vec_StrPut_( vOut );
-        }
-        Vec_StrPut_( vOut );
-        // output pins
-        Scl_ItemForEachChildName( p, pCell, pPin, "pin" )
-        {
-            if ( !Scl_LibertyReadPinFormula(p, pPin) ) // skip input pin
-                continue;
-            if (Scl_LibertyReadPinDirection(p, pPin) == 2) // skip internal pin
-                continue;
-            assert( Scl_LibertyReadPinDirection(p, pPin) == 1 );
-            pName = Scl_LibertyReadString(p, pPin->Head);
-            Vec_StrPutS_( vOut, pName );
-            Vec_StrPutF_( vOut, Scl_LibertyReadPinCap( p, pPin, "max_capacitance" ) );
-            Vec_StrPutF_( vOut, Scl_LibertyReadPinCap( p, pPin, "max_transition" ) );
-            Vec_StrPutI_( vOut, Vec_PtrSize(vNameIns) );
-            pFormula = Scl_LibertyReadPinFormula(p, pPin);
-            Vec_StrPutS_( vOut, pFormula );
-            // write truth table
-            vTruth = Mio_ParseFormulaTruth( pFormula, (char **)Vec_PtrArray(vNameIns), Vec_PtrSize(vNameIns) );
-            if ( vTruth == NULL )
-                return NULL;
-            for ( i = 0; i < Abc_Truth6WordNum(Vec_PtrSize(vNameIns)); i++ )
-                Vec_StrPutW_( vOut, Vec_WrdEntry(vTruth, i) );
-            Vec_WrdFree( vTruth );
-            Vec_StrPut_( vOut );
-            Vec_StrPut_( vOut );
-
-            // write the delay tables
-            if ( fUseFirstTable )
-            {
-                Vec_PtrForEachEntry( char *, vNameIns, pName, i )
-                {
-                    pTiming = Scl_LibertyReadPinTiming( p, pPin, pName );
-                    Vec_StrPutS_( vOut, pName );
-                    Vec_StrPutI_( vOut, (int)(pTiming != NULL) );
-                    if ( pTiming == NULL ) // output does not depend on input
-                        continue;
-                    Vec_StrPutI_( vOut, Scl_LibertyReadTimingSense(p, pTiming) );
-                    Vec_StrPut_( vOut );
-                    Vec_StrPut_( vOut );
-                    // some cells only have 'rise' or 'fall' but not both - here we work around this
-                    if ( !Scl_LibertyReadTable( p, vOut, pTiming, "cell_rise",           vTemples ) )
-                        if ( !Scl_LibertyReadTable( p, vOut, pTiming, "cell_fall",       vTemples ) )
-                                { printf( "Table cannot be found\n" ); return NULL; }                              
-                    if ( !Scl_LibertyReadTable( p, vOut, pTiming, "cell_fall",           vTemples ) )
-                        if ( !Scl_LibertyReadTable( p, vOut, pTiming, "cell_rise",       vTemples ) )
-                                { printf( "Table cannot be found\n" ); return NULL; }                              
-                    if ( !Scl_LibertyReadTable( p, vOut, pTiming, "rise_transition",     vTemples ) )
-                        if ( !Scl_LibertyReadTable( p, vOut, pTiming, "fall_transition", vTemples ) )
-                                { printf( "Table cannot be found\n" ); return NULL; }                              
-                    if ( !Scl_LibertyReadTable( p, vOut, pTiming, "fall_transition",     vTemples ) )
-                        if ( !Scl_LibertyReadTable( p, vOut, pTiming, "rise_transition", vTemples ) )
-                                { printf( "Table cannot be found\n" ); return NULL; }  
-                }
-                continue;
-            }
-
-            // write the timing tables
-            Vec_PtrForEachEntry( char *, vNameIns, pName, i )
-            {
-                Vec_Ptr_t * vTables[4];
-                Vec_Ptr_t * vTimings;
-                vTimings = Scl_LibertyReadPinTimingAll( p, pPin, pName );
-                Vec_StrPutS_( vOut, pName );
-                Vec_StrPutI_( vOut, (int)(Vec_PtrSize(vTimings) != 0) );
-                if ( Vec_PtrSize(vTimings) == 0 ) // output does not depend on input
-                {
-                    Vec_PtrFree( vTimings );
-                    continue;
-                }
-                Vec_StrPutI_( vOut, Scl_LibertyReadTimingSense(p, (Scl_Item_t *)Vec_PtrEntry(vTimings, 0)) );
-                Vec_StrPut_( vOut );
-                Vec_StrPut_( vOut );
-                // collect the timing tables
-                for ( k = 0; k < 4; k++ )
-                    vTables[k] = Vec_PtrAlloc( 16 );
-                Vec_PtrForEachEntry( Scl_Item_t *, vTimings, pTiming, k )
-                {
-                    // some cells only have 'rise' or 'fall' but not both - here we work around this
-                    if ( !Scl_LibertyScanTable( p, vTables[0], pTiming, "cell_rise",           vTemples ) )
-                        if ( !Scl_LibertyScanTable( p, vTables[0], pTiming, "cell_fall",       vTemples ) )
-                                { printf( "Table cannot be found\n" ); return NULL; }                              
-                    if ( !Scl_LibertyScanTable( p, vTables[1], pTiming, "cell_fall",           vTemples ) )
-                        if ( !Scl_LibertyScanTable( p, vTables[1], pTiming, "cell_rise",       vTemples ) )
-                                { printf( "Table cannot be found\n" ); return NULL; }                              
-                    if ( !Scl_LibertyScanTable( p, vTables[2], pTiming, "rise_transition",     vTemples ) )
-                        if ( !Scl_LibertyScanTable( p, vTables[2], pTiming, "fall_transition", vTemples ) )
-                                { printf( "Table cannot be found\n" ); return NULL; }                              
-                    if ( !Scl_LibertyScanTable( p, vTables[3], pTiming, "fall_transition",     vTemples ) )
-                        if ( !Scl_LibertyScanTable( p, vTables[3], pTiming, "rise_transition", vTemples ) )
-                                { printf( "Table cannot be found\n" ); return NULL; }  
-                }
-                Vec_PtrFree( vTimings );
-                // compute worse case of the tables
-                for ( k = 0; k < 4; k++ )
-                {
-                    Vec_Flt_t * vInd0, * vInd1, * vValues;
-                    if ( !Scl_LibertyComputeWorstCase( vTables[k], &vInd0, &vInd1, &vValues ) )
-                        { printf( "Table indexes have different values\n" ); return NULL; }  
-                    Vec_VecFree( (Vec_Vec_t *)vTables[k] );
-                    Scl_LibertyDumpTables( vOut, vInd0, vInd1, vValues );
-                    Vec_FltFree( vInd0 );
-                    Vec_FltFree( vInd1 );
-                    Vec_FltFree( vValues );
-                }
-            }
-        }
-        Vec_StrPut_( vOut );
-        Vec_PtrFreeFree( vNameIns );
+        Vec_PtrPush( vCells, pCell );
     }
+    if ( nThreads > 1 )
+        RetValue = Scl_LibertyReadCellsPar( p, vCells, vTemples, vOut, nThreads );
+    else
+        Vec_PtrForEachEntry( Scl_Item_t *, vCells, pCell, i )
+            if ( !(RetValue = Scl_LibertyReadCellStr( p, pCell, vTemples, vOut )) )
+                break;
+    Vec_PtrFree( vCells );
     // free templates
     if ( vTemples )
     {
@@ -1667,6 +1787,11 @@ Vec_Str_t * Scl_LibertyReadSclStr( Scl_Tree_t * p, int fVerbose, int fVeryVerbos
         }
         Vec_PtrFree( vTemples );
     }
+    if ( !RetValue )
+    {
+        Vec_StrFree( vOut );
+        return NULL;
+    }
     if ( fVerbose )
     {
         printf( "Library \"%s\" from \"%s\" has %d cells ", 
@@ -1677,20 +1802,25 @@ Vec_Str_t * Scl_LibertyReadSclStr( Scl_Tree_t * p, int fVerbose, int fVeryVerbos
     }
     return vOut;
 }
-SC_Lib * Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose )
+SC_Lib * Abc_SclReadLiberty( char * pFileName, int fUseCache, int nThreads, int fVerbose, int fVeryVerbose )
 {
     SC_Lib * pLib;
     Scl_Tree_t * p;
     Vec_Str_t * vStr;
+    // try the binary cache written by the previous run
+    if ( fUseCache && (pLib = Abc_SclCacheRead( pFileName, fVerbose )) )
+        return pLib;
     p = Scl_LibertyParse( pFileName, fVeryVerbose );
     if ( p == NULL )
         return NULL;
 //    Scl_LibertyParseDump( p, "temp_.lib" );
     // collect relevant data
-    vStr = Scl_LibertyReadSclStr( p, fVerbose, fVeryVerbose );
+    vStr = Scl_LibertyReadSclStr( p, nThreads, fVerbose, fVeryVerbose );
     Scl_LibertyStop( p, fVeryVerbose );
     if ( vStr == NULL )
         return NULL;
+    if ( fUseCache )
+        Abc_SclCacheWrite( pFileName, vStr, fVerbose );
     // construct SCL data-structure
     pLib = Abc_SclReadFromStr( vStr );
     if ( pLib == NULL )
@@ -1725,7 +1855,7 @@ void Scl_LibertyTest()
     if ( p == NULL )
         return;
 //    Scl_LibertyParseDump( p, "temp_.lib" );
-    vStr = Scl_LibertyReadSclStr( p, fVerbose, fVeryVerbose );
+    vStr = Scl_LibertyReadSclStr( p, 1, fVerbose, fVeryVerbose );
     Scl_LibertyStringDump( "test_scl.lib", vStr );
     Vec_StrFree( vStr );
     Scl_LibertyStop( p, fVerbose );
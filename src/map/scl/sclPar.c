@@ -0,0 +1,256 @@
+/**CFile****************************************************************
+
+  FileName    [sclPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Standard-cell library representation.]
+
+  Synopsis    [Concurrent evaluation of gate swaps.]
+
+  Author      [Alan Mishchenko, Niklas Een]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - August 24, 2012.]
+
+  Revision    [$Id: sclPar.c,v 1.0 2012/08/24 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "sclSize.h"
+#include "misc/util/utilPool.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// Gate swaps of the candidate nodes are evaluated concurrently. Each thread
+// uses a worker manager, which shares the library, the network, and the gate
+// assignment with the main manager, but has its own loads, arrival times,
+// slews, departure times, and backup storage. Before evaluating a node, the
+// worker copies the timing data of the node's window and of the window's
+// fanins from the main manager, which is not modified while the workers run.
+// The evaluation functions do not change the gate assignment: the gate being
+// tried is recorded in the worker (pTrialObj/pTrialCell) and used by timing
+// computation instead of the gate in the network. As a result, the gains are
+// the same as those computed sequentially, for any number of threads.
+
+typedef struct Abc_SclJob_t_ Abc_SclJob_t;
+struct Abc_SclJob_t_
+{
+    SC_Man *        p;           // the main manager
+    SC_Man *        pWorker;     // the manager used for evaluation
+    Abc_SclEval_f   pFunc;       // the evaluation function
+    Vec_Int_t *     vCands;      // the candidate nodes
+    Vec_Wec_t *     vNodes;      // the windows of the candidates
+    Vec_Wec_t *     vEvals;      // the nodes to evaluate for each candidate
+    Vec_Int_t *     vGates;      // the best gate of each candidate
+    Vec_Flt_t *     vGains;      // the best gain of each candidate
+    int             Notches;     // the max number of gates to try
+    int             DelayGap;    // the delay gap
+    int             iStart;      // the first candidate of this job
+    int             nStep;       // the distance between the candidates
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts/updates/stops the worker manager.]
+
+  Description [The worker is a copy of the main manager, in which the
+  timing data and backup storage are replaced by private arrays.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static SC_Man * Abc_SclWorkerStart( SC_Man * p )
+{
+    SC_Man * pW = ABC_ALLOC( SC_Man, 1 );
+    *pW = *p;
+    pW->pLoads    = ABC_CALLOC( SC_Pair, p->nObjs );
+    pW->pDepts    = ABC_CALLOC( SC_Pair, p->nObjs );
+    pW->pTimes    = ABC_CALLOC( SC_Pair, p->nObjs );
+    pW->pSlews    = ABC_CALLOC( SC_Pair, p->nObjs );
+    pW->vLoads2   = Vec_FltAlloc( 100 );
+    pW->vLoads3   = Vec_FltAlloc( 100 );
+    pW->vTimes2   = Vec_FltAlloc( 100 );
+    pW->vTimes3   = Vec_FltAlloc( 100 );
+    pW->pTrialObj = NULL;
+    pW->nWorkers  = 0;
+    pW->pWorkers  = NULL;
+    return pW;
+}
+static void Abc_SclWorkerUpdate( SC_Man * pW, SC_Man * p )
+{
+    SC_Man Temp = *pW;
+    // take the current parameters of the main manager (delays, load estimation)
+    *pW = *p;
+    pW->pLoads    = Temp.pLoads;
+    pW->pDepts    = Temp.pDepts;
+    pW->pTimes    = Temp.pTimes;
+    pW->pSlews    = Temp.pSlews;
+    pW->vLoads2   = Temp.vLoads2;
+    pW->vLoads3   = Temp.vLoads3;
+    pW->vTimes2   = Temp.vTimes2;
+    pW->vTimes3   = Temp.vTimes3;
+    pW->pTrialObj = NULL;
+    pW->nWorkers  = 0;
+    pW->pWorkers  = NULL;
+}
+static void Abc_SclWorkerStop( SC_Man * pW )
+{
+    Vec_FltFree( pW->vLoads2 );
+    Vec_FltFree( pW->vLoads3 );
+    Vec_FltFree( pW->vTimes2 );
+    Vec_FltFree( pW->vTimes3 );
+    ABC_FREE( pW->pLoads );
+    ABC_FREE( pW->pDepts );
+    ABC_FREE( pW->pTimes );
+    ABC_FREE( pW->pSlews );
+    ABC_FREE( pW );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Copies timing data of the window into the worker.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Abc_SclWorkerCopyObj( SC_Man * pW, SC_Man * p, Abc_Obj_t * pObj )
+{
+    int Id = Abc_ObjId(pObj);
+    pW->pLoads[Id] = p->pLoads[Id];
+    pW->pDepts[Id] = p->pDepts[Id];
+    pW->pTimes[Id] = p->pTimes[Id];
+    pW->pSlews[Id] = p->pSlews[Id];
+}
+static void Abc_SclWorkerCopyWindow( SC_Man * pW, SC_Man * p, Vec_Int_t * vNodes )
+{
+    Abc_Obj_t * pObj, * pFanin;
+    int i, k;
+    Abc_NtkForEachObjVec( vNodes, p->pNtk, pObj, i )
+    {
+        Abc_SclWorkerCopyObj( pW, p, pObj );
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+            Abc_SclWorkerCopyObj( pW, p, pFanin );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Evaluates the candidates assigned to one thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Abc_SclEvalTask( void * pArg )
+{
+    Abc_SclJob_t * pJob = (Abc_SclJob_t *)pArg;
+    SC_Man * p = pJob->p, * pW = pJob->pWorker;
+    Abc_Obj_t * pObj;
+    float Gain;
+    int i, Gate;
+    for ( i = pJob->iStart; i < Vec_IntSize(pJob->vCands); i += pJob->nStep )
+    {
+        pObj = Abc_NtkObj( p->pNtk, Vec_IntEntry(pJob->vCands, i) );
+        if ( pW != p )
+            Abc_SclWorkerCopyWindow( pW, p, Vec_WecEntry(pJob->vNodes, i) );
+        Gate = pJob->pFunc( pW, pObj, Vec_WecEntry(pJob->vNodes, i), Vec_WecEntry(pJob->vEvals, i), pJob->Notches, pJob->DelayGap, &Gain );
+        Vec_IntWriteEntry( pJob->vGates, i, Gate );
+        Vec_FltWriteEntry( pJob->vGains, i, Gain );
+    }
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Evaluates gate swaps of the candidates using several threads.]
+
+  Description [For each candidate node in vCands, calls pFunc with the
+  window (vNodes) and the nodes to evaluate (vEvals) of this candidate and
+  records the best gate and gain in vGates and vGains. The network and
+  the main manager are not changed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclEvalPar( SC_Man * p, int nThreads, Abc_SclEval_f pFunc, Vec_Int_t * vCands, Vec_Wec_t * vNodes, Vec_Wec_t * vEvals, int Notches, int DelayGap, Vec_Int_t * vGates, Vec_Flt_t * vGains )
+{
+    Abc_Task_t * pTasks[ABC_POOL_THR_MAX];
+    Abc_SclJob_t pJobs[ABC_POOL_THR_MAX];
+    int t;
+    assert( Vec_IntSize(vCands) == Vec_WecSize(vNodes) );
+    assert( Vec_IntSize(vCands) == Vec_WecSize(vEvals) );
+    nThreads = Abc_MaxInt( 1, Abc_MinInt( nThreads, Abc_MinInt(Vec_IntSize(vCands), ABC_POOL_THR_MAX) ) );
+    Vec_IntFill( vGates, Vec_IntSize(vCands), -1 );
+    Vec_FltFill( vGains, Vec_IntSize(vCands), 0 );
+    // start the workers
+    if ( nThreads > 1 && p->nWorkers < nThreads )
+    {
+        p->pWorkers = ABC_REALLOC( SC_Man *, p->pWorkers, nThreads );
+        for ( t = p->nWorkers; t < nThreads; t++ )
+            p->pWorkers[t] = Abc_SclWorkerStart( p );
+        p->nWorkers = nThreads;
+    }
+    for ( t = 0; t < nThreads; t++ )
+    {
+        pJobs[t].p        = p;
+        pJobs[t].pWorker  = nThreads > 1 ? p->pWorkers[t] : p;
+        pJobs[t].pFunc    = pFunc;
+        pJobs[t].vCands   = vCands;
+        pJobs[t].vNodes   = vNodes;
+        pJobs[t].vEvals   = vEvals;
+        pJobs[t].vGates   = vGates;
+        pJobs[t].vGains   = vGains;
+        pJobs[t].Notches  = Notches;
+        pJobs[t].DelayGap = DelayGap;
+        pJobs[t].iStart   = t;
+        pJobs[t].nStep    = nThreads;
+        if ( nThreads > 1 )
+            Abc_SclWorkerUpdate( p->pWorkers[t], p );
+    }
+    // evaluate the candidates
+    for ( t = 1; t < nThreads; t++ )
+        pTasks[t] = Abc_TaskStart( Abc_PoolGlobal(), Abc_SclEvalTask, pJobs + t );
+    Abc_SclEvalTask( pJobs );
+    for ( t = 1; t < nThreads; t++ )
+    {
+        Abc_TaskWait( pTasks[t] );
+        Abc_TaskFree( pTasks[t] );
+    }
+}
+void Abc_SclEvalParStop( SC_Man * p )
+{
+    int t;
+    for ( t = 0; t < p->nWorkers; t++ )
+        Abc_SclWorkerStop( p->pWorkers[t] );
+    ABC_FREE( p->pWorkers );
+    p->nWorkers = 0;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -350,8 +350,8 @@ void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
         }
         p->nEstNodes++;
     }
-    // get the library cell
-    pCell = Abc_SclObjCell( pObj );
+    // get the library cell (or the cell being tried for this node)
+    pCell = pObj == p->pTrialObj ? p->pTrialCell : Abc_SclObjCell( pObj );
     // compute for each fanin
     Abc_ObjForEachFanin( pObj, pFanin, k )
     {
@@ -82,6 +82,11 @@ struct SC_Man_
     Vec_Wec_t *    vLevels;
     Vec_Int_t *    vChanged; 
     int            nIncUpdates;
+    // concurrent evaluation of gate swaps
+    Abc_Obj_t *    pTrialObj;     // node whose gate is being tried
+    SC_Cell *      pTrialCell;    // the gate tried for this node
+    int            nWorkers;      // the number of worker managers
+    SC_Man **      pWorkers;      // worker managers with private timing data
     // optimization parameters
     float          SumArea;       // total area
     float          MaxDelay;      // max delay
@@ -97,6 +102,9 @@ struct SC_Man_
     abctime        timeOther;     // everything else
 };
 
+// evaluates gate swaps of one node; returns the best gate or -1
+typedef int (*Abc_SclEval_f)( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vNodes, Vec_Int_t * vEvals, int Notches, int DelayGap, float * pGain );
+
 ////////////////////////////////////////////////////////////////////////
 ///                       GLOBAL VARIABLES                           ///
 ////////////////////////////////////////////////////////////////////////
@@ -551,6 +559,7 @@ extern int           Abc_SclCheckNtk( Abc_Ntk_t * p, int fVerbose );
 extern Abc_Ntk_t *   Abc_SclPerformBuffering( Abc_Ntk_t * p, int DegreeR, int Degree, int fUseInvs, int fVerbose );
 extern Abc_Ntk_t *   Abc_SclBufPerform( Abc_Ntk_t * pNtk, int FanMin, int FanMax, int fBufPis, int fSkipDup, int fVerbose );
 /*=== sclDnsize.c ===============================================================*/
+extern int           Abc_SclFindBestCellDn( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vNodes, Vec_Int_t * vEvals, int Notches, int DelayGap, float * pGainBest );
 extern void          Abc_SclDnsizePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPars );
 /*=== sclLoad.c ===============================================================*/
 extern Vec_Flt_t *   Abc_SclFindWireCaps( SC_WireLoad * pWL, int nFanoutMax );
@@ -559,6 +568,9 @@ extern void          Abc_SclAddWireLoad( SC_Man * p, Abc_Obj_t * pObj, int fSubt
 extern void          Abc_SclComputeLoad( SC_Man * p );
 extern void          Abc_SclUpdateLoad( SC_Man * p, Abc_Obj_t * pObj, SC_Cell * pOld, SC_Cell * pNew );
 extern void          Abc_SclUpdateLoadSplit( SC_Man * p, Abc_Obj_t * pBuffer, Abc_Obj_t * pFanout );
+/*=== sclPar.c ===============================================================*/
+extern void          Abc_SclEvalPar( SC_Man * p, int nThreads, Abc_SclEval_f pFunc, Vec_Int_t * vCands, Vec_Wec_t * vNodes, Vec_Wec_t * vEvals, int Notches, int DelayGap, Vec_Int_t * vGates, Vec_Flt_t * vGains );
+extern void          Abc_SclEvalParStop( SC_Man * p );
 /*=== sclSize.c ===============================================================*/
 extern Abc_Obj_t *   Abc_SclFindCriticalCo( SC_Man * p, int * pfRise );
 extern Abc_Obj_t *   Abc_SclFindMostCriticalFanin( SC_Man * p, int * pfRise, Abc_Obj_t * pNode );
@@ -573,6 +585,7 @@ extern void          Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nT
 extern void          Abc_SclPrintBuffers( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fVerbose );
 /*=== sclUpsize.c ===============================================================*/
 extern int           Abc_SclCountNearCriticalNodes( SC_Man * p );
+extern int           Abc_SclFindBestCell( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vRecalcs, Vec_Int_t * vEvals, int Notches, int DelayGap, float * pGainBest );
 extern void          Abc_SclUpsizePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPars );
 /*=== sclUtil.c ===============================================================*/
 extern void          Abc_SclMioGates2SclGates( SC_Lib * pLib, Abc_Ntk_t * p );
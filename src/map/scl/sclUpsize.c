@@ -291,13 +291,14 @@ int Abc_SclFindBestCell( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vRecalcs, Vec
             continue;
         if ( k > Notches )
             break;
-        // set new cell
-        Abc_SclObjSetCell( pObj, pCellNew );
+        // try new cell
+        p->pTrialObj  = pObj;
+        p->pTrialCell = pCellNew;
         Abc_SclUpdateLoad( p, pObj, pCellOld, pCellNew );
         // recompute timing
         Abc_SclTimeCone( p, vRecalcs );
-        // set old cell
-        Abc_SclObjSetCell( pObj, pCellOld );
+        // return to old cell
+        p->pTrialObj  = NULL;
         Abc_SclLoadRestore( p, pObj );
         // save best gain
         dGain = Abc_SclEvalPerform( p, vEvals );
@@ -315,8 +316,7 @@ int Abc_SclFindBestCell( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vRecalcs, Vec
     }
 //    printf( "Best = %.2f   ", dGainBest );
 //    printf( "\n" );
-    // put back old cell and timing
-    Abc_SclObjSetCell( pObj, pCellOld );
+    // put back old timing
     Abc_SclConeRestore( p, vRecalcs );
     *pGainBest = dGainBest;
     return gateBest;
@@ -593,7 +593,7 @@ void Abc_SclObjMarkFanFans( Abc_Obj_t * pObj, Vec_Ptr_t * vNodes )
   SeeAlso     []
 
 ***********************************************************************/
-int Abc_SclFindUpsizes( SC_Man * p, Vec_Int_t * vPathNodes, int Ratio, int Notches, int iIter, int DelayGap, int fMoreConserf )
+int Abc_SclFindUpsizes( SC_Man * p, Vec_Int_t * vPathNodes, int Ratio, int Notches, int iIter, int DelayGap, int fMoreConserf, int nThreads )
 {
     SC_Cell * pCellOld, * pCellNew;
     Vec_Int_t * vRecalcs, * vEvals;
@@ -606,6 +606,44 @@ int Abc_SclFindUpsizes( SC_Man * p, Vec_Int_t * vPathNodes, int Ratio, int Notch
     vRecalcs = Vec_IntAlloc( 100 );
     vEvals = Vec_IntAlloc( 100 );
     Vec_QueClear( p->vNodeByGain );
+    if ( nThreads > 1 )
+    {
+        // collect the windows first because this uses the node marks
+        Vec_Int_t * vCands  = Vec_IntAlloc( Vec_IntSize(vPathNodes) );
+        Vec_Wec_t * vNodesW = Vec_WecAlloc( Vec_IntSize(vPathNodes) );
+        Vec_Wec_t * vEvalsW = Vec_WecAlloc( Vec_IntSize(vPathNodes) );
+        Vec_Int_t * vGates  = Vec_IntAlloc( Vec_IntSize(vPathNodes) );
+        Vec_Flt_t * vGains  = Vec_FltAlloc( Vec_IntSize(vPathNodes) );
+        Abc_NtkForEachObjVec( vPathNodes, p->pNtk, pObj, i )
+        {
+            assert( pObj->fMarkB == 0 );
+            iIterLast = Vec_IntEntry(p->vNodeIter, Abc_ObjId(pObj));
+            if ( iIterLast >= 0 && iIterLast + 5 > iIter )
+                continue;
+            Abc_SclFindNodesToUpdate( pObj, &vRecalcs, &vEvals, NULL );
+            Vec_IntAppend( Vec_WecPushLevel(vNodesW), vRecalcs );
+            Vec_IntAppend( Vec_WecPushLevel(vEvalsW), vEvals );
+            Vec_IntPush( vCands, Abc_ObjId(pObj) );
+        }
+        // evaluate the nodes concurrently and remember savings in the original order
+        Abc_SclEvalPar( p, nThreads, Abc_SclFindBestCell, vCands, vNodesW, vEvalsW, Notches, DelayGap, vGates, vGains );
+        Abc_NtkForEachObjVec( vCands, p->pNtk, pObj, i )
+        {
+            gateBest = Vec_IntEntry( vGates, i );
+            if ( gateBest < 0 )
+                continue;
+            assert( Vec_FltEntry(vGains, i) > 0.0 );
+            Vec_FltWriteEntry( p->vNode2Gain, Abc_ObjId(pObj), Vec_FltEntry(vGains, i) );
+            Vec_IntWriteEntry( p->vNode2Gate, Abc_ObjId(pObj), gateBest );
+            Vec_QuePush( p->vNodeByGain, Abc_ObjId(pObj) );
+        }
+        Vec_IntFree( vCands );
+        Vec_WecFree( vNodesW );
+        Vec_WecFree( vEvalsW );
+        Vec_IntFree( vGates );
+        Vec_FltFree( vGains );
+    }
+    else
     Abc_NtkForEachObjVec( vPathNodes, p->pNtk, pObj, i )
     {
         assert( pObj->fMarkB == 0 );
@@ -915,7 +953,7 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
             if ( pPars->BypassFreq && i && (i % pPars->BypassFreq) == 0 )
                 nUpsizes = Abc_SclFindBypasses( p, vPathNodes, pPars->Ratio, pPars->Notches, i, pPars->DelayGap, pPars->fVeryVerbose );
             else
-                nUpsizes = Abc_SclFindUpsizes( p, vPathNodes, pPars->Ratio, pPars->Notches, i, pPars->DelayGap, (pPars->BypassFreq > 0) );
+                nUpsizes = Abc_SclFindUpsizes( p, vPathNodes, pPars->Ratio, pPars->Notches, i, pPars->DelayGap, (pPars->BypassFreq > 0), pPars->nThreads );
             p->timeSize += Abc_Clock() - clk;
 
             // unmark critical path
@@ -1009,6 +1047,7 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
 
     // save the result and quit
     Abc_SclSclGates2MioGates( pLib, pNtk ); // updates gate pointers
+    Abc_SclEvalParStop( p );
     Abc_SclManFree( p );
 //    Abc_NtkCleanMarkAB( pNtk );
 }
@@ -346,6 +346,21 @@ static inline abctime Abc_Clock()
 #endif
 }
 
+// elapsed (wall-clock) time, which is useful when several threads are running
+static inline abctime Abc_ClockWall()
+{
+#if (defined(LIN) || defined(LIN64)) && !APPLE_MACH && !defined(__MINGW32__)
+    struct timespec ts;
+    if ( clock_gettime(CLOCK_MONOTONIC, &ts) < 0 ) 
+        return (abctime)-1;
+    abctime res = ((abctime) ts.tv_sec) * CLOCKS_PER_SEC;
+    res += (((abctime) ts.tv_nsec) * CLOCKS_PER_SEC) / 1000000000;
+    return res;
+#else
+    return (abctime) clock();
+#endif
+}
+
 
 // misc printing procedures
 enum Abc_VerbLevel
@@ -358,6 +373,10 @@ enum Abc_VerbLevel
 };
 
 
+// memory-mapped files
+extern char * Abc_FileMap( char * pFileName, iword * pnSize );
+extern void   Abc_FileUnmap( char * pContents, iword nSize );
+
 #ifdef ABC_USE_BRIDGE
 
 // bridge communication
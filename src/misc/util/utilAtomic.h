@@ -0,0 +1,88 @@
+/**CFile****************************************************************
+
+  FileName    [utilAtomic.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Atomic operations.]
+
+  Synopsis    [Portable wrappers for atomic integer operations.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: utilAtomic.h,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#ifndef ABC__misc__util__utilAtomic_h
+#define ABC__misc__util__utilAtomic_h
+
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+#include "misc/util/abc_global.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+////////////////////////////////////////////////////////////////////////
+///                      MACRO DEFINITIONS                           ///
+////////////////////////////////////////////////////////////////////////
+
+// loads have acquire semantics, stores have release semantics,
+// read-modify-write operations are sequentially consistent;
+// CAS returns 1 if the value was replaced; ADD returns the old value
+
+#if defined(_MSC_VER)
+
+static inline int  Abc_AtomicLoadInt( volatile int * p )                      { int v = *p; _ReadWriteBarrier(); return v;                                              }
+static inline void Abc_AtomicStoreInt( volatile int * p, int v )              { _ReadWriteBarrier(); *p = v;                                                            }
+static inline int  Abc_AtomicAddInt( volatile int * p, int v )                { return (int)_InterlockedExchangeAdd( (volatile long *)p, (long)v );                      }
+static inline int  Abc_AtomicCasInt( volatile int * p, int Old, int New )     { return (int)_InterlockedCompareExchange( (volatile long *)p, (long)New, (long)Old ) == Old; }
+static inline word Abc_AtomicLoadWord( volatile word * p )                    { word v = *p; _ReadWriteBarrier(); return v;                                             }
+static inline void Abc_AtomicStoreWord( volatile word * p, word v )           { _ReadWriteBarrier(); *p = v;                                                            }
+static inline word Abc_AtomicAddWord( volatile word * p, word v )             { return (word)_InterlockedExchangeAdd64( (volatile __int64 *)p, (__int64)v );             }
+static inline int  Abc_AtomicCasWord( volatile word * p, word Old, word New ) { return (word)_InterlockedCompareExchange64( (volatile __int64 *)p, (__int64)New, (__int64)Old ) == Old; }
+static inline void Abc_AtomicFence()                                          { _ReadWriteBarrier(); _mm_mfence();                                                     }
+static inline void Abc_AtomicPause()                                          { _mm_pause();                                                                            }
+
+#else
+
+static inline int  Abc_AtomicLoadInt( volatile int * p )                      { return __atomic_load_n( p, __ATOMIC_ACQUIRE );                                           }
+static inline void Abc_AtomicStoreInt( volatile int * p, int v )              { __atomic_store_n( p, v, __ATOMIC_RELEASE );                                              }
+static inline int  Abc_AtomicAddInt( volatile int * p, int v )                { return __atomic_fetch_add( p, v, __ATOMIC_SEQ_CST );                                     }
+static inline int  Abc_AtomicCasInt( volatile int * p, int Old, int New )     { return __atomic_compare_exchange_n( p, &Old, New, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST ); }
+static inline word Abc_AtomicLoadWord( volatile word * p )                    { return __atomic_load_n( p, __ATOMIC_ACQUIRE );                                           }
+static inline void Abc_AtomicStoreWord( volatile word * p, word v )           { __atomic_store_n( p, v, __ATOMIC_RELEASE );                                              }
+static inline word Abc_AtomicAddWord( volatile word * p, word v )             { return __atomic_fetch_add( p, v, __ATOMIC_SEQ_CST );                                     }
+static inline int  Abc_AtomicCasWord( volatile word * p, word Old, word New ) { return __atomic_compare_exchange_n( p, &Old, New, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST ); }
+static inline void Abc_AtomicFence()                                          { __atomic_thread_fence( __ATOMIC_SEQ_CST );                                               }
+#if defined(__x86_64__) || defined(__i386__)
+static inline void Abc_AtomicPause()                                          { __builtin_ia32_pause();                                                                  }
+#else
+static inline void Abc_AtomicPause()                                          {                                                                                          }
+#endif
+
+#endif
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
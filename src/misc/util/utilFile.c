@@ -31,6 +31,7 @@
 #include <io.h>
 #else
 #include <unistd.h>
+#include <sys/mman.h>
 #endif
 
 #include "abc_global.h"
@@ -212,6 +213,80 @@ char* nsprintf(const char* format, ...)
     return ret;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Maps the file into memory.]
+
+  Description [Returns the contents of the file and its size. The mapping 
+  is private and copy-on-write: the caller may modify the contents (for 
+  example, to terminate strings in place) without changing the file, and 
+  only the touched pages are copied. Returns NULL if the file cannot be 
+  opened or mapped, or if it is empty.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Abc_FileMap( char * pFileName, iword * pnSize )
+{
+#if defined(_MSC_VER) || defined(__MINGW32__)
+    HANDLE hFile, hMap;
+    LARGE_INTEGER Size;
+    char * pContents = NULL;
+    *pnSize = 0;
+    hFile = CreateFileA( pFileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL );
+    if ( hFile == INVALID_HANDLE_VALUE )
+        return NULL;
+    if ( !GetFileSizeEx( hFile, &Size ) || Size.QuadPart == 0 )
+    {
+        CloseHandle( hFile );
+        return NULL;
+    }
+    hMap = CreateFileMappingA( hFile, NULL, PAGE_WRITECOPY, 0, 0, NULL );
+    if ( hMap != NULL )
+    {
+        pContents = (char *)MapViewOfFile( hMap, FILE_MAP_COPY, 0, 0, 0 );
+        CloseHandle( hMap );
+    }
+    CloseHandle( hFile );
+    if ( pContents )
+        *pnSize = (iword)Size.QuadPart;
+    return pContents;
+#else
+    struct stat Stat;
+    char * pContents;
+    int fd = open( pFileName, O_RDONLY );
+    *pnSize = 0;
+    if ( fd == -1 )
+        return NULL;
+    if ( fstat( fd, &Stat ) == -1 || Stat.st_size == 0 )
+    {
+        close( fd );
+        return NULL;
+    }
+    pContents = (char *)mmap( NULL, (size_t)Stat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if ( pContents == (char *)MAP_FAILED )
+        return NULL;
+#ifdef MADV_SEQUENTIAL
+    madvise( pContents, (size_t)Stat.st_size, MADV_SEQUENTIAL );
+#endif
+    *pnSize = (iword)Stat.st_size;
+    return pContents;
+#endif
+}
+void Abc_FileUnmap( char * pContents, iword nSize )
+{
+    if ( pContents == NULL )
+        return;
+#if defined(_MSC_VER) || defined(__MINGW32__)
+    UnmapViewOfFile( pContents );
+#else
+    munmap( pContents, (size_t)nSize );
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,168 @@
+/**CFile****************************************************************
+
+  FileName    [utilMbox.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Mailbox for engines running concurrently.]
+
+  Synopsis    [Lock-free append-only message log.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: utilMbox.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "abc_global.h"
+#include "utilAtomic.h"
+#include "utilMbox.h"
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the message starts with the header (the data size plus one), followed
+// by the type, the sender, the value, and the data; the header is zero
+// while the message is being written and -1 if the buffer ends here
+#define ABC_MBOX_HEAD   4
+
+struct Abc_Mbox_t_
+{
+    int               nWords;       // the buffer size
+    volatile int      nUsed;        // the number of reserved words
+    volatile int      nPosts;       // the number of posted messages
+    volatile int      nDrops;       // the number of dropped messages
+    int *             pWords;       // the buffer
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the mailbox.]
+
+  Description [The buffer size is given in 32-bit words.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Mbox_t * Abc_MboxStart( int nWords )
+{
+    Abc_Mbox_t * p = ABC_CALLOC( Abc_Mbox_t, 1 );
+    p->nWords = Abc_MaxInt( nWords, 2 * ABC_MBOX_HEAD );
+    p->pWords = ABC_CALLOC( int, p->nWords );
+    return p;
+}
+void Abc_MboxStop( Abc_Mbox_t * p )
+{
+    ABC_FREE( p->pWords );
+    ABC_FREE( p );
+}
+int Abc_MboxPostNum( Abc_Mbox_t * p )
+{
+    return Abc_AtomicLoadInt( &p->nPosts );
+}
+int Abc_MboxDropNum( Abc_Mbox_t * p )
+{
+    return Abc_AtomicLoadInt( &p->nDrops );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Posts one message.]
+
+  Description [Returns 1 if the message was posted and 0 if it was
+  dropped because the buffer is full. Can be called by any thread.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_MboxPost( Abc_Mbox_t * p, int Type, int Sender, int Value, int * pData, int nData )
+{
+    int nSize = ABC_MBOX_HEAD + nData, iStart, i;
+    assert( Type > 0 && nData >= 0 );
+    if ( Abc_AtomicLoadInt(&p->nUsed) + nSize > p->nWords )
+    {
+        Abc_AtomicAddInt( &p->nDrops, 1 );
+        return 0;
+    }
+    iStart = Abc_AtomicAddInt( &p->nUsed, nSize );
+    if ( iStart + nSize > p->nWords )
+    {
+        // the readers stop at the first message that did not fit
+        if ( iStart < p->nWords )
+            Abc_AtomicStoreInt( p->pWords + iStart, -1 );
+        Abc_AtomicAddInt( &p->nDrops, 1 );
+        return 0;
+    }
+    p->pWords[iStart+1] = Type;
+    p->pWords[iStart+2] = Sender;
+    p->pWords[iStart+3] = Value;
+    for ( i = 0; i < nData; i++ )
+        p->pWords[iStart+ABC_MBOX_HEAD+i] = pData[i];
+    Abc_AtomicStoreInt( p->pWords + iStart, nData + 1 );
+    Abc_AtomicAddInt( &p->nPosts, 1 );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the next message.]
+
+  Description [The cursor should be zero before the first call. Returns
+  the data size of the message or -1 if there are no new messages. The
+  data remains valid until the mailbox is stopped. A message that is
+  still being written is returned by one of the next calls, so that
+  messages are never reordered.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_MboxRead( Abc_Mbox_t * p, int * pCursor, int * pType, int * pSender, int * pValue, int ** ppData )
+{
+    int iStart = *pCursor, Head;
+    if ( iStart + ABC_MBOX_HEAD > p->nWords || iStart >= Abc_AtomicLoadInt(&p->nUsed) )
+        return -1;
+    Head = Abc_AtomicLoadInt( p->pWords + iStart );
+    if ( Head == 0 )
+        return -1;
+    if ( Head == -1 )
+    {
+        *pCursor = p->nWords;
+        return -1;
+    }
+    if ( pType )   *pType   = p->pWords[iStart+1];
+    if ( pSender ) *pSender = p->pWords[iStart+2];
+    if ( pValue )  *pValue  = p->pWords[iStart+3];
+    if ( ppData )  *ppData  = p->pWords + iStart + ABC_MBOX_HEAD;
+    *pCursor = iStart + ABC_MBOX_HEAD + Head - 1;
+    return Head - 1;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
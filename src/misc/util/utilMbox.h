@@ -0,0 +1,75 @@
+/**CFile****************************************************************
+
+  FileName    [utilMbox.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Mailbox for engines running concurrently.]
+
+  Synopsis    [External declarations.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: utilMbox.h,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#ifndef ABC__misc__util__utilMbox_h
+#define ABC__misc__util__utilMbox_h
+
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+// message types
+#define ABC_MBOX_DEPTH    1   // Value = the last frame without a counter-example
+#define ABC_MBOX_LEMMA    2   // Value = the last frame where the clause holds; Data = clause over flop literals
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+// An append-only log of messages shared by several threads. A writer
+// reserves space with one atomic addition, fills in the message and
+// publishes it by storing its header last. Each reader keeps its own
+// cursor and sees the messages in the order in which space was reserved.
+// Messages that do not fit into the fixed-size buffer are dropped, so
+// posting never blocks and never allocates memory.
+
+typedef struct Abc_Mbox_t_          Abc_Mbox_t;
+
+////////////////////////////////////////////////////////////////////////
+///                      MACRO DEFINITIONS                           ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== utilMbox.c ==============================================================*/
+extern Abc_Mbox_t *    Abc_MboxStart( int nWords );
+extern void            Abc_MboxStop( Abc_Mbox_t * p );
+extern int             Abc_MboxPost( Abc_Mbox_t * p, int Type, int Sender, int Value, int * pData, int nData );
+extern int             Abc_MboxRead( Abc_Mbox_t * p, int * pCursor, int * pType, int * pSender, int * pValue, int ** ppData );
+extern int             Abc_MboxPostNum( Abc_Mbox_t * p );
+extern int             Abc_MboxDropNum( Abc_Mbox_t * p );
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
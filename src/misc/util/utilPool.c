@@ -0,0 +1,703 @@
+/**CFile****************************************************************
+
+  FileName    [utilPool.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Thread pool.]
+
+  Synopsis    [Persistent worker threads with work-stealing task deques.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: utilPool.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "abc_global.h"
+#include "misc/vec/vec.h"
+#include "utilAtomic.h"
+#include "utilPool.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// task status
+#define ABC_TASK_WAITING    0   // queued but not started
+#define ABC_TASK_RUNNING    1   // being executed
+#define ABC_TASK_DONE       2   // finished
+#define ABC_TASK_CANCELLED  3   // cancelled before it started
+
+struct Abc_Task_t_
+{
+    Abc_Pool_t *      pPool;        // the pool
+    Abc_TaskFunc_t    pFunc;        // the task function
+    void *            pArg;         // the argument
+    void *            pRes;         // the result
+    volatile int      Status;       // the task status
+    volatile int      fCancel;      // cancellation was requested
+    volatile int      nRefs;        // references held by the owner and by the queue
+    int               fBackground;  // the task is executed by the workers only
+};
+
+static int            s_nPoolThreads = 0;       // the user-specified number of threads
+static Abc_Pool_t *   s_pPoolGlobal  = NULL;    // the process-wide pool
+
+#ifdef ABC_USE_PTHREADS
+
+typedef struct Abc_PoolQue_t_ Abc_PoolQue_t;
+struct Abc_PoolQue_t_
+{
+    pthread_mutex_t   Mutex;        // protects the queue
+    Vec_Ptr_t *       vTasks;       // the tasks
+    int               iHead;        // the first task
+    volatile int      nQueued;      // the number of queued tasks (read without locking)
+};
+
+typedef struct Abc_PoolThr_t_ Abc_PoolThr_t;
+struct Abc_PoolThr_t_
+{
+    Abc_Pool_t *      pPool;        // the pool of this worker (NULL for other threads)
+    int               iQue;         // the deque of this worker
+    int               fExternal;    // the thread does not belong to a pool
+    Abc_Task_t *      pCur;         // the task being executed
+    pthread_t         Thread;       // the thread
+};
+
+struct Abc_Pool_t_
+{
+    int               nThreads;     // the number of workers
+    Abc_PoolThr_t *   pThrs;        // the workers
+    Abc_PoolQue_t *   pQues;        // worker deques, followed by the shared queue and the background queue
+    pthread_mutex_t   Mutex;        // protects sleeping
+    pthread_cond_t    Cond;         // signaled when a task is submitted or finished
+    volatile int      nPending;     // the number of queued regular tasks
+    volatile int      nPendingBg;   // the number of queued background tasks
+    volatile int      fStop;        // the pool is being stopped
+};
+
+static pthread_once_t  s_PoolOnce  = PTHREAD_ONCE_INIT;
+static pthread_key_t   s_PoolKey;
+static pthread_mutex_t s_PoolMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static inline int Abc_PoolQueShared( Abc_Pool_t * p )  { return p->nThreads;     }
+static inline int Abc_PoolQueBack( Abc_Pool_t * p )    { return p->nThreads + 1; }
+
+#else
+
+struct Abc_Pool_t_
+{
+    int               nThreads;     // the number of workers
+};
+
+static Abc_Task_t *   s_pTaskCur     = NULL;    // the task being executed
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the number of online processors.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_PoolCpuNum()
+{
+    int nCpus = 1;
+#if defined(_WIN32)
+    char * pEnv = getenv( "NUMBER_OF_PROCESSORS" );
+    if ( pEnv )
+        nCpus = atoi( pEnv );
+#elif defined(ABC_USE_PTHREADS) && defined(_SC_NPROCESSORS_ONLN)
+    nCpus = (int)sysconf( _SC_NPROCESSORS_ONLN );
+#endif
+    return Abc_MaxInt( 1, Abc_MinInt(nCpus, ABC_POOL_THR_MAX) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sets the number of threads of the process-wide pool.]
+
+  Description [Zero selects the number of online processors. Should be
+  called when no tasks are running in the process-wide pool.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_PoolThreadNum()
+{
+    return s_nPoolThreads > 0 ? s_nPoolThreads : Abc_PoolCpuNum();
+}
+void Abc_PoolSetThreadNum( int nThreads )
+{
+    Abc_Pool_t * pOld = NULL;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &s_PoolMutex );
+#endif
+    s_nPoolThreads = Abc_MinInt( Abc_MaxInt(nThreads, 0), ABC_POOL_THR_MAX );
+    if ( s_pPoolGlobal && s_pPoolGlobal->nThreads != Abc_PoolThreadNum() )
+        pOld = s_pPoolGlobal, s_pPoolGlobal = NULL;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &s_PoolMutex );
+#endif
+    if ( pOld )
+        Abc_PoolStop( pOld );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the process-wide pool.]
+
+  Description [The pool is created on the first call.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Pool_t * Abc_PoolGlobal()
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &s_PoolMutex );
+#endif
+    if ( s_pPoolGlobal == NULL )
+        s_pPoolGlobal = Abc_PoolStart( Abc_PoolThreadNum() );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &s_PoolMutex );
+#endif
+    return s_pPoolGlobal;
+}
+int Abc_PoolSize( Abc_Pool_t * p )
+{
+    return p->nThreads;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Task queries.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_TaskIsDone( Abc_Task_t * pTask )
+{
+    return Abc_AtomicLoadInt( &pTask->Status ) >= ABC_TASK_DONE;
+}
+int Abc_TaskIsCancelled( Abc_Task_t * pTask )
+{
+    return pTask != NULL && Abc_AtomicLoadInt( &pTask->fCancel );
+}
+void * Abc_TaskResult( Abc_Task_t * pTask )
+{
+    assert( Abc_TaskIsDone(pTask) );
+    return pTask->pRes;
+}
+static inline Abc_Task_t * Abc_TaskAlloc( Abc_Pool_t * p, Abc_TaskFunc_t pFunc, void * pArg )
+{
+    Abc_Task_t * pTask = ABC_CALLOC( Abc_Task_t, 1 );
+    pTask->pPool  = p;
+    pTask->pFunc  = pFunc;
+    pTask->pArg   = pArg;
+    pTask->Status = ABC_TASK_WAITING;
+    pTask->nRefs  = 1;
+    return pTask;
+}
+static inline void Abc_TaskRelease( Abc_Task_t * pTask )
+{
+    if ( Abc_AtomicAddInt( &pTask->nRefs, -1 ) == 1 )
+        ABC_FREE( pTask );
+}
+void Abc_TaskFree( Abc_Task_t * pTask )
+{
+    if ( pTask )
+        Abc_TaskRelease( pTask );
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Thread-local state.]
+
+  Description [Threads that do not belong to a pool get their state
+  allocated on demand; it is freed when the thread exits.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_PoolThrFree( void * pArg )
+{
+    Abc_PoolThr_t * pThr = (Abc_PoolThr_t *)pArg;
+    if ( pThr && pThr->fExternal )
+        ABC_FREE( pThr );
+}
+static void Abc_PoolKeyStart()
+{
+    pthread_key_create( &s_PoolKey, Abc_PoolThrFree );
+}
+static Abc_PoolThr_t * Abc_PoolThrCur()
+{
+    Abc_PoolThr_t * pThr;
+    pthread_once( &s_PoolOnce, Abc_PoolKeyStart );
+    pThr = (Abc_PoolThr_t *)pthread_getspecific( s_PoolKey );
+    if ( pThr == NULL )
+    {
+        pThr = ABC_CALLOC( Abc_PoolThr_t, 1 );
+        pThr->iQue = -1;
+        pThr->fExternal = 1;
+        pthread_setspecific( s_PoolKey, pThr );
+    }
+    return pThr;
+}
+Abc_Task_t * Abc_TaskCurrent()
+{
+    return Abc_PoolThrCur()->pCur;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Queue operations.]
+
+  Description [The owner of a deque takes tasks from the back, all other
+  threads take tasks from the front.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_PoolQuePush( Abc_PoolQue_t * pQue, Abc_Task_t * pTask )
+{
+    pthread_mutex_lock( &pQue->Mutex );
+    Vec_PtrPush( pQue->vTasks, pTask );
+    Abc_AtomicStoreInt( &pQue->nQueued, Vec_PtrSize(pQue->vTasks) - pQue->iHead );
+    pthread_mutex_unlock( &pQue->Mutex );
+}
+static Abc_Task_t * Abc_PoolQuePop( Abc_PoolQue_t * pQue, int fBack )
+{
+    Abc_Task_t * pTask = NULL;
+    if ( Abc_AtomicLoadInt(&pQue->nQueued) == 0 ) // quick check without locking
+        return NULL;
+    pthread_mutex_lock( &pQue->Mutex );
+    if ( Vec_PtrSize(pQue->vTasks) > pQue->iHead )
+    {
+        if ( fBack )
+            pTask = (Abc_Task_t *)Vec_PtrPop( pQue->vTasks );
+        else
+            pTask = (Abc_Task_t *)Vec_PtrEntry( pQue->vTasks, pQue->iHead++ );
+        if ( Vec_PtrSize(pQue->vTasks) == pQue->iHead )
+        {
+            Vec_PtrClear( pQue->vTasks );
+            pQue->iHead = 0;
+        }
+        Abc_AtomicStoreInt( &pQue->nQueued, Vec_PtrSize(pQue->vTasks) - pQue->iHead );
+    }
+    pthread_mutex_unlock( &pQue->Mutex );
+    return pTask;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds a queued task for the given thread.]
+
+  Description [Tries the thread's own deque, the shared queue, the deques
+  of other workers and, if allowed, the queue of background tasks.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Abc_Task_t * Abc_PoolGrab( Abc_Pool_t * p, Abc_PoolThr_t * pThr, int fBackground )
+{
+    Abc_Task_t * pTask;
+    int i, iStart = pThr->pPool == p ? pThr->iQue : 0;
+    if ( pThr->pPool == p && (pTask = Abc_PoolQuePop(p->pQues + pThr->iQue, 1)) )
+        goto found;
+    if ( (pTask = Abc_PoolQuePop(p->pQues + Abc_PoolQueShared(p), 0)) )
+        goto found;
+    for ( i = 1; i <= p->nThreads; i++ )
+        if ( (pTask = Abc_PoolQuePop(p->pQues + (iStart + i) % p->nThreads, 0)) )
+            goto found;
+    if ( fBackground && (pTask = Abc_PoolQuePop(p->pQues + Abc_PoolQueBack(p), 0)) )
+    {
+        Abc_AtomicAddInt( &p->nPendingBg, -1 );
+        return pTask;
+    }
+    return NULL;
+found:
+    Abc_AtomicAddInt( &p->nPending, -1 );
+    return pTask;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Executes the task if it was not started or cancelled.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_PoolSetStatus( Abc_Pool_t * p, Abc_Task_t * pTask, int Status )
+{
+    pthread_mutex_lock( &p->Mutex );
+    Abc_AtomicStoreInt( &pTask->Status, Status );
+    pthread_cond_broadcast( &p->Cond );
+    pthread_mutex_unlock( &p->Mutex );
+}
+static void Abc_PoolRun( Abc_PoolThr_t * pThr, Abc_Task_t * pTask )
+{
+    Abc_Task_t * pPrev;
+    if ( !Abc_AtomicCasInt( &pTask->Status, ABC_TASK_WAITING, ABC_TASK_RUNNING ) )
+        return;
+    pPrev = pThr->pCur;
+    pThr->pCur = pTask;
+    pTask->pRes = pTask->pFunc( pTask->pArg );
+    pThr->pCur = pPrev;
+    Abc_PoolSetStatus( pTask->pPool, pTask, ABC_TASK_DONE );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [The worker thread.]
+
+  Description [Executes queued tasks and sleeps when there is no work.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Abc_PoolWorker( void * pArg )
+{
+    Abc_PoolThr_t * pThr = (Abc_PoolThr_t *)pArg;
+    Abc_Pool_t * p = pThr->pPool;
+    Abc_Task_t * pTask;
+    pthread_once( &s_PoolOnce, Abc_PoolKeyStart );
+    pthread_setspecific( s_PoolKey, pThr );
+    while ( 1 )
+    {
+        if ( (pTask = Abc_PoolGrab( p, pThr, 1 )) )
+        {
+            Abc_PoolRun( pThr, pTask );
+            Abc_TaskRelease( pTask );
+            continue;
+        }
+        pthread_mutex_lock( &p->Mutex );
+        while ( !p->fStop && Abc_AtomicLoadInt(&p->nPending) == 0 && Abc_AtomicLoadInt(&p->nPendingBg) == 0 )
+            pthread_cond_wait( &p->Cond, &p->Mutex );
+        if ( p->fStop && Abc_AtomicLoadInt(&p->nPending) == 0 && Abc_AtomicLoadInt(&p->nPendingBg) == 0 )
+        {
+            pthread_mutex_unlock( &p->Mutex );
+            break;
+        }
+        pthread_mutex_unlock( &p->Mutex );
+    }
+    pthread_setspecific( s_PoolKey, NULL );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the pool.]
+
+  Description [Stopping the pool waits until all queued tasks are done.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Pool_t * Abc_PoolStart( int nThreads )
+{
+    Abc_Pool_t * p = ABC_CALLOC( Abc_Pool_t, 1 );
+    int i, status;
+    p->nThreads = Abc_MinInt( Abc_MaxInt(nThreads, 1), ABC_POOL_THR_MAX );
+    p->pThrs = ABC_CALLOC( Abc_PoolThr_t, p->nThreads );
+    p->pQues = ABC_CALLOC( Abc_PoolQue_t, p->nThreads + 2 );
+    for ( i = 0; i < p->nThreads + 2; i++ )
+    {
+        pthread_mutex_init( &p->pQues[i].Mutex, NULL );
+        p->pQues[i].vTasks = Vec_PtrAlloc( 16 );
+    }
+    pthread_mutex_init( &p->Mutex, NULL );
+    pthread_cond_init( &p->Cond, NULL );
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        p->pThrs[i].pPool = p;
+        p->pThrs[i].iQue  = i;
+        status = pthread_create( &p->pThrs[i].Thread, NULL, Abc_PoolWorker, (void *)(p->pThrs + i) );  assert( status == 0 );
+    }
+    return p;
+}
+void Abc_PoolStop( Abc_Pool_t * p )
+{
+    int i, status;
+    pthread_mutex_lock( &p->Mutex );
+    p->fStop = 1;
+    pthread_cond_broadcast( &p->Cond );
+    pthread_mutex_unlock( &p->Mutex );
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        status = pthread_join( p->pThrs[i].Thread, NULL );  assert( status == 0 );
+    }
+    for ( i = 0; i < p->nThreads + 2; i++ )
+    {
+        assert( Vec_PtrSize(p->pQues[i].vTasks) == p->pQues[i].iHead );
+        pthread_mutex_destroy( &p->pQues[i].Mutex );
+        Vec_PtrFree( p->pQues[i].vTasks );
+    }
+    pthread_mutex_destroy( &p->Mutex );
+    pthread_cond_destroy( &p->Cond );
+    ABC_FREE( p->pQues );
+    ABC_FREE( p->pThrs );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Submits a task.]
+
+  Description [Tasks submitted by a worker go to its own deque.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Abc_Task_t * Abc_TaskStartInt( Abc_Pool_t * p, Abc_TaskFunc_t pFunc, void * pArg, int fBackground )
+{
+    Abc_PoolThr_t * pThr = Abc_PoolThrCur();
+    Abc_Task_t * pTask = Abc_TaskAlloc( p, pFunc, pArg );
+    pTask->nRefs++; // the reference held by the queue
+    pTask->fBackground = fBackground;
+    if ( fBackground )
+    {
+        Abc_PoolQuePush( p->pQues + Abc_PoolQueBack(p), pTask );
+        Abc_AtomicAddInt( &p->nPendingBg, 1 );
+    }
+    else
+    {
+        Abc_PoolQuePush( p->pQues + (pThr->pPool == p ? pThr->iQue : Abc_PoolQueShared(p)), pTask );
+        Abc_AtomicAddInt( &p->nPending, 1 );
+    }
+    pthread_mutex_lock( &p->Mutex );
+    pthread_cond_broadcast( &p->Cond );
+    pthread_mutex_unlock( &p->Mutex );
+    return pTask;
+}
+Abc_Task_t * Abc_TaskStart( Abc_Pool_t * p, Abc_TaskFunc_t pFunc, void * pArg )
+{
+    return Abc_TaskStartInt( p, pFunc, pArg, 0 );
+}
+Abc_Task_t * Abc_TaskStartBackground( Abc_Pool_t * p, Abc_TaskFunc_t pFunc, void * pArg )
+{
+    return Abc_TaskStartInt( p, pFunc, pArg, 1 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Cancels the task.]
+
+  Description [A task that was not started is never executed; a running
+  task can poll Abc_TaskIsCancelled().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_TaskCancel( Abc_Task_t * pTask )
+{
+    Abc_AtomicStoreInt( &pTask->fCancel, 1 );
+    if ( Abc_AtomicCasInt( &pTask->Status, ABC_TASK_WAITING, ABC_TASK_CANCELLED ) )
+        Abc_PoolSetStatus( pTask->pPool, pTask, ABC_TASK_CANCELLED );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Waits for the task and returns its result.]
+
+  Description [A regular task that was not started is executed by the
+  calling thread. Otherwise, the calling thread executes other queued
+  regular tasks until the task is finished. Background tasks are never
+  executed by the calling thread. Returns NULL for cancelled tasks.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Abc_TaskWait( Abc_Task_t * pTask )
+{
+    Abc_TaskWaitAny( &pTask, 1 );
+    return pTask->pRes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Waits until one of the tasks is finished.]
+
+  Description [Returns the index of a finished task. NULL entries of the
+  array are skipped. Returns -1 if all entries are NULL. While waiting,
+  the calling thread executes queued regular tasks but never starts
+  a background task.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_TaskWaitAny( Abc_Task_t ** pTasks, int nTasks )
+{
+    Abc_PoolThr_t * pThr = Abc_PoolThrCur();
+    Abc_Pool_t * p = NULL;
+    Abc_Task_t * pTask;
+    int i;
+    for ( i = 0; i < nTasks; i++ )
+        if ( pTasks[i] )
+            p = pTasks[i]->pPool;
+    if ( p == NULL )
+        return -1;
+    if ( nTasks == 1 && !pTasks[0]->fBackground ) // run the task here if it was not started
+        Abc_PoolRun( pThr, pTasks[0] );
+    while ( 1 )
+    {
+        for ( i = 0; i < nTasks; i++ )
+            if ( pTasks[i] && Abc_TaskIsDone(pTasks[i]) )
+                return i;
+        if ( (pTask = Abc_PoolGrab( p, pThr, 0 )) )
+        {
+            Abc_PoolRun( pThr, pTask );
+            Abc_TaskRelease( pTask );
+            continue;
+        }
+        pthread_mutex_lock( &p->Mutex );
+        while ( Abc_AtomicLoadInt(&p->nPending) == 0 )
+        {
+            for ( i = 0; i < nTasks; i++ )
+                if ( pTasks[i] && Abc_TaskIsDone(pTasks[i]) )
+                    break;
+            if ( i < nTasks )
+                break;
+            pthread_cond_wait( &p->Cond, &p->Mutex );
+        }
+        pthread_mutex_unlock( &p->Mutex );
+    }
+    return -1;
+}
+
+#else
+
+/**Function*************************************************************
+
+  Synopsis    [Without threads, tasks are executed upon submission.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Pool_t * Abc_PoolStart( int nThreads )
+{
+    Abc_Pool_t * p = ABC_CALLOC( Abc_Pool_t, 1 );
+    p->nThreads = 1;
+    return p;
+}
+void Abc_PoolStop( Abc_Pool_t * p )
+{
+    ABC_FREE( p );
+}
+static Abc_Task_t * Abc_TaskStartInt( Abc_Pool_t * p, Abc_TaskFunc_t pFunc, void * pArg )
+{
+    Abc_Task_t * pTask = Abc_TaskAlloc( p, pFunc, pArg );
+    Abc_Task_t * pPrev = s_pTaskCur;
+    pTask->Status = ABC_TASK_RUNNING;
+    s_pTaskCur = pTask;
+    pTask->pRes = pFunc( pArg );
+    s_pTaskCur = pPrev;
+    pTask->Status = ABC_TASK_DONE;
+    return pTask;
+}
+Abc_Task_t * Abc_TaskStart( Abc_Pool_t * p, Abc_TaskFunc_t pFunc, void * pArg )
+{
+    return Abc_TaskStartInt( p, pFunc, pArg );
+}
+Abc_Task_t * Abc_TaskStartBackground( Abc_Pool_t * p, Abc_TaskFunc_t pFunc, void * pArg )
+{
+    return Abc_TaskStartInt( p, pFunc, pArg );
+}
+void Abc_TaskCancel( Abc_Task_t * pTask )
+{
+    pTask->fCancel = 1;
+}
+void * Abc_TaskWait( Abc_Task_t * pTask )
+{
+    return pTask->pRes;
+}
+int Abc_TaskWaitAny( Abc_Task_t ** pTasks, int nTasks )
+{
+    int i;
+    for ( i = 0; i < nTasks; i++ )
+        if ( pTasks[i] )
+            return i;
+    return -1;
+}
+Abc_Task_t * Abc_TaskCurrent()
+{
+    return s_pTaskCur;
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -0,0 +1,103 @@
+/**CFile****************************************************************
+
+  FileName    [utilPool.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Thread pool.]
+
+  Synopsis    [External declarations.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: utilPool.h,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#ifndef ABC__misc__util__utilPool_h
+#define ABC__misc__util__utilPool_h
+
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+// the largest number of worker threads in one pool
+#define ABC_POOL_THR_MAX  256
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+// A pool of persistent worker threads. Each worker owns a task deque:
+// tasks submitted from a worker go to its own deque and are taken back
+// in LIFO order, while idle workers steal from the other end. Tasks
+// submitted from outside of the pool go to a shared queue. Idle workers
+// sleep on a condition variable instead of spinning.
+//
+// A task is a future: Abc_TaskWait() returns the value computed by the
+// task function. A waiting thread executes other queued tasks until
+// the task it is waiting for is finished, which makes nested parallelism
+// (tasks submitting and waiting for subtasks) deadlock-free.
+//
+// Background tasks are long-running jobs (such as a prover launched next
+// to the main computation); they are executed by the workers only and
+// are never picked up by a waiting thread, even the one waiting for them.
+// A background task occupies its worker until it finishes, so long-running
+// jobs should be submitted to a private pool rather than the global one.
+//
+// Cancellation is cooperative: a task cancelled before it started never
+// runs, while a running task can poll Abc_TaskIsCancelled().
+//
+// Abc_TaskFree() releases the handle; a task that is still running when
+// its handle is released is reclaimed by the pool after it finishes.
+
+typedef struct Abc_Pool_t_          Abc_Pool_t;
+typedef struct Abc_Task_t_          Abc_Task_t;
+
+typedef void * (*Abc_TaskFunc_t)( void * );
+
+////////////////////////////////////////////////////////////////////////
+///                      MACRO DEFINITIONS                           ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== utilPool.c ==============================================================*/
+extern Abc_Pool_t *    Abc_PoolStart( int nThreads );
+extern void            Abc_PoolStop( Abc_Pool_t * p );
+extern int             Abc_PoolSize( Abc_Pool_t * p );
+extern Abc_Pool_t *    Abc_PoolGlobal();
+extern void            Abc_PoolSetThreadNum( int nThreads );
+extern int             Abc_PoolThreadNum();
+extern Abc_Task_t *    Abc_TaskStart( Abc_Pool_t * p, Abc_TaskFunc_t pFunc, void * pArg );
+extern Abc_Task_t *    Abc_TaskStartBackground( Abc_Pool_t * p, Abc_TaskFunc_t pFunc, void * pArg );
+extern void *          Abc_TaskWait( Abc_Task_t * pTask );
+extern int             Abc_TaskWaitAny( Abc_Task_t ** pTasks, int nTasks );
+extern void            Abc_TaskCancel( Abc_Task_t * pTask );
+extern int             Abc_TaskIsDone( Abc_Task_t * pTask );
+extern int             Abc_TaskIsCancelled( Abc_Task_t * pTask );
+extern void *          Abc_TaskResult( Abc_Task_t * pTask );
+extern Abc_Task_t *    Abc_TaskCurrent();
+extern void            Abc_TaskFree( Abc_Task_t * pTask );
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
@@ -52,6 +52,7 @@ void Sfm_ParSetDefault( Sfm_Par_t * pPars )
     pPars->nWinSizeMax  =  300;  // the maximum window size
     pPars->nGrowthLevel =    0;  // the maximum allowed growth in level
     pPars->nBTLimit     = 5000;  // the maximum number of conflicts in one SAT run
+    pPars->nThreads     =    1;  // the number of threads
     pPars->fRrOnly      =    0;  // perform redundancy removal
     pPars->fArea        =    0;  // performs optimization for area
     pPars->fMoreEffort  =    0;  // performs high-affort minimization
@@ -73,7 +74,7 @@ void Sfm_ParSetDefault( Sfm_Par_t * pPars )
 ***********************************************************************/
 void Sfm_NtkPrintStats( Sfm_Ntk_t * p )
 {
-    p->timeOther = p->timeTotal - p->timeWin - p->timeDiv - p->timeCnf - p->timeSat;
+    p->timeOther = p->timeTotal - p->timeWin - p->timeDiv - p->timeCnf - p->timeSat - p->timePar;
     printf( "Nodes = %d. Try = %d. Resub = %d. Div = %d (ave = %d). SAT calls = %d. Timeouts = %d. MaxDivs = %d.\n",
         Sfm_NtkNodeNum(p), p->nNodesTried, p->nRemoves + p->nResubs, p->nTotalDivs, p->nTotalDivs/Abc_MaxInt(1, p->nNodesTried), p->nSatCalls, p->nTimeOuts, p->nMaxDivs );
 
@@ -89,6 +90,14 @@ void Sfm_NtkPrintStats( Sfm_Ntk_t * p )
     printf( "Edges  %6d out of %6d (%6.2f %%)   ", p->nTotalEdgesBeg-p->nTotalEdgesEnd, p->nTotalEdgesBeg, 100.0*(p->nTotalEdgesBeg-p->nTotalEdgesEnd)/Abc_MaxInt(1, p->nTotalEdgesBeg) );
     printf( "\n" );
 
+    if ( p->pPars->nThreads > 1 )
+    {
+        printf( "Parallel :   " );
+        printf( "Found  %6d in %6d batches   ", p->nParFound, p->nStamps );
+        printf( "Re-derived %6d (%6.2f %%)   ", p->nParRetries, 100.0*p->nParRetries/Abc_MaxInt(1, p->nParFound) );
+        printf( "\n" );
+        ABC_PRTP( "Par", p->timePar  ,  p->timeTotal );
+    }
     ABC_PRTP( "Win", p->timeWin  ,  p->timeTotal );
     ABC_PRTP( "Div", p->timeDiv  ,  p->timeTotal );
     ABC_PRTP( "Cnf", p->timeCnf  ,  p->timeTotal );
@@ -208,6 +217,13 @@ finish:
             iNode, f, Sfm_ObjFanin(p, iNode, f), iVar, Vec_IntEntry(p->vDivs, iVar) );
         Kit_DsdPrintFromTruth( (unsigned *)&uTruth, Vec_IntSize(p->vDivIds) ); printf( "\n" );
     }
+    if ( p->fSpeculate )
+    {
+        p->iPropFanin = f;
+        p->iPropNew   = iVar == -1 ? -1 : Vec_IntEntry(p->vDivs, iVar);
+        p->uPropTruth = uTruth;
+        return 1;
+    }
     if ( iVar == -1 )
         p->nRemoves++;
     else
@@ -277,11 +293,19 @@ p->timeSat += Abc_Clock() - clk;
         if ( New > Old )
             return 0;
     }
+    if ( p->fSpeculate )
+    {
+        p->iPropFanin = -1;
+        p->iPropNew   = -1;
+        p->uPropTruth = uTruth;
+        return 1;
+    }
     p->nImproves++;
     if ( fSkipUpdate )
         return 0;
     // update truth table
     Vec_WrdWriteEntry( p->vTruths, iNode, uTruth );
+    Sfm_ObjTouch( p, iNode );
     Sfm_TruthToCnf( uTruth, NULL, Sfm_ObjFaninNum(p, iNode), p->vCover, (Vec_Str_t *)Vec_WecEntry(p->vCnfs, iNode) );
     return 1;
 }
@@ -368,7 +392,7 @@ int Sfm_NtkPerform( Sfm_Ntk_t * p, Sfm_Par_t * pPars )
 {
     int i, k, Counter = 0, CounterLarge = 0;
     //Sfm_NtkPrint( p );
-    p->timeTotal = Abc_Clock();
+    p->timeTotal = Abc_ClockWall();
     if ( pPars->fVerbose )
     {
         int nFixed = p->vFixed ? Vec_StrSum(p->vFixed) : 0;
@@ -382,6 +406,9 @@ int Sfm_NtkPerform( Sfm_Ntk_t * p, Sfm_Par_t * pPars )
 //    return 0;
     p->nTotalNodesBeg = Vec_WecSizeUsedLimits( &p->vFanins, Sfm_NtkPiNum(p), Vec_WecSize(&p->vFanins) - Sfm_NtkPoNum(p) );
     p->nTotalEdgesBeg = Vec_WecSizeSize(&p->vFanins) - Sfm_NtkPoNum(p);
+    if ( pPars->nThreads > 1 )
+        Counter = Sfm_NtkPerformPar( p, &CounterLarge );
+    else
     Sfm_NtkForEachNode( p, i )
     {
         if ( Sfm_ObjIsFixed( p, i ) )
@@ -406,7 +433,7 @@ int Sfm_NtkPerform( Sfm_Ntk_t * p, Sfm_Par_t * pPars )
     }
     p->nTotalNodesEnd = Vec_WecSizeUsedLimits( &p->vFanins, Sfm_NtkPiNum(p), Vec_WecSize(&p->vFanins) - Sfm_NtkPoNum(p) );
     p->nTotalEdgesEnd = Vec_WecSizeSize(&p->vFanins) - Sfm_NtkPoNum(p);
-    p->timeTotal = Abc_Clock() - p->timeTotal;
+    p->timeTotal = Abc_ClockWall() - p->timeTotal;
     if ( pPars->fVerbose && CounterLarge )
         printf( "MFS skipped %d (out of %d) nodes with more than %d fanins.\n", CounterLarge, p->nNodes, SFM_SUPP_MAX );
     if ( pPars->fVerbose )
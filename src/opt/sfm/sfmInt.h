@@ -129,6 +129,15 @@ struct Sfm_Ntk_t_
     word *            pTtElems[SFM_FANIN_MAX];
     word              pTruth[SFM_WORDS_MAX];
     word              pCube[SFM_WORDS_MAX];
+    // parallel optimization
+    int               fSpeculate;  // record the change instead of applying it
+    int               iPropFanin;  // recorded change: fanin to replace (-1 if the function is updated)
+    int               iPropNew;    // recorded change: new fanin (-1 if the fanin is removed)
+    word              uPropTruth;  // recorded change: new function (in pTruth for large nodes)
+    Vec_Int_t         vStamps;     // the last batch, in which the object was changed
+    int               nStamps;     // the current batch
+    int               nParFound;   // changes found by the workers
+    int               nParRetries; // changes re-derived because their windows were modified
     // nodes
     int               nTotalNodesBeg;
     int               nTotalEdgesBeg;
@@ -144,6 +153,7 @@ struct Sfm_Ntk_t_
     abctime           timeDiv;
     abctime           timeCnf;
     abctime           timeSat;
+    abctime           timePar;
     abctime           timeOther;
     abctime           timeTotal;
 //    abctime           time1;
@@ -183,6 +193,9 @@ static inline void Sfm_ObjSetLevel( Sfm_Ntk_t * p, int iObj, int Lev )  { Vec_In
 static inline int  Sfm_ObjLevelR( Sfm_Ntk_t * p, int iObj )             { return Vec_IntEntry( &p->vLevelsR, iObj );                        }
 static inline void Sfm_ObjSetLevelR( Sfm_Ntk_t * p, int iObj, int Lev ) { Vec_IntWriteEntry( &p->vLevelsR, iObj, Lev );                     }
 
+static inline void Sfm_ObjTouch( Sfm_Ntk_t * p, int iObj )              { if ( Vec_IntSize(&p->vStamps) ) Vec_IntWriteEntry(&p->vStamps, iObj, p->nStamps); }
+static inline int  Sfm_ObjIsTouched( Sfm_Ntk_t * p, int iObj )          { return Vec_IntEntry(&p->vStamps, iObj) == p->nStamps;            }
+
 static inline int  Sfm_ObjUpdateFaninCount( Sfm_Ntk_t * p, int iObj )   { return Vec_IntAddToEntry(&p->vCounts, iObj, -1);                  }
 static inline void Sfm_ObjResetFaninCount( Sfm_Ntk_t * p, int iObj )    { Vec_IntWriteEntry(&p->vCounts, iObj, Sfm_ObjFaninNum(p, iObj)-1); }
 
@@ -209,6 +222,7 @@ extern int          Sfm_TruthToCnf( word Truth, word * pTruth, int nVars, Vec_In
 extern Vec_Wec_t *  Sfm_CreateCnf( Sfm_Ntk_t * p );
 extern void         Sfm_TranslateCnf( Vec_Wec_t * vRes, Vec_Str_t * vCnf, Vec_Int_t * vFaninMap, int iPivotVar );
 /*=== sfmCore.c ==========================================================*/
+extern int          Sfm_NodeResub( Sfm_Ntk_t * p, int iNode );
 /*=== sfmLib.c ==========================================================*/
 extern int          Sfm_LibFindComplInputGate( Vec_Wrd_t * vFuncs, int iGate, int nFanins, int iFanin, int * piFaninNew );
 extern Sfm_Lib_t *  Sfm_LibPrepare( int nVars, int fTwo, int fDelay, int fVerbose, int fLibVerbose );
@@ -223,6 +237,8 @@ extern int          Sfm_LibImplementGatesDelay( Sfm_Lib_t * p, int * pFanins, Mi
 extern Sfm_Ntk_t *  Sfm_ConstructNetwork( Vec_Wec_t * vFanins, int nPis, int nPos );
 extern void         Sfm_NtkPrepare( Sfm_Ntk_t * p );
 extern void         Sfm_NtkUpdate( Sfm_Ntk_t * p, int iNode, int f, int iFaninNew, word uTruth, word * pTruth );
+/*=== sfmPar.c ==========================================================*/
+extern int          Sfm_NtkPerformPar( Sfm_Ntk_t * p, int * pCounterLarge );
 /*=== sfmSat.c ==========================================================*/
 extern int          Sfm_NtkWindowToSolver( Sfm_Ntk_t * p );
 extern word         Sfm_ComputeInterpolant( Sfm_Ntk_t * p );
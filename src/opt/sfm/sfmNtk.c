@@ -234,6 +234,7 @@ void Sfm_NtkFree( Sfm_Ntk_t * p )
     ABC_FREE( p->vTravIds2.pArray );
     ABC_FREE( p->vId2Var.pArray );
     ABC_FREE( p->vVar2Id.pArray );
+    ABC_FREE( p->vStamps.pArray );
     Vec_WecFree( p->vCnfs );
     Vec_IntFree( p->vCover );
     // other data
@@ -273,6 +274,7 @@ void Sfm_NtkRemoveFanin( Sfm_Ntk_t * p, int iNode, int iFanin )
     assert( RetValue );
     RetValue = Vec_IntRemove( Sfm_ObjFoArray(p, iFanin), iNode );
     assert( RetValue );
+    Sfm_ObjTouch( p, iNode );
 }
 void Sfm_NtkAddFanin( Sfm_Ntk_t * p, int iNode, int iFanin )
 {
@@ -284,6 +286,8 @@ void Sfm_NtkAddFanin( Sfm_Ntk_t * p, int iNode, int iFanin )
     assert( Vec_IntFind( Sfm_ObjFoArray(p, iFanin), iNode ) == -1 );
     Vec_IntPush( Sfm_ObjFiArray(p, iNode), iFanin );
     Vec_IntPush( Sfm_ObjFoArray(p, iFanin), iNode );
+    Sfm_ObjTouch( p, iNode );
+    Sfm_ObjTouch( p, iFanin );
 }
 void Sfm_NtkDeleteObj_rec( Sfm_Ntk_t * p, int iNode )
 {
@@ -297,6 +301,7 @@ void Sfm_NtkDeleteObj_rec( Sfm_Ntk_t * p, int iNode )
         Sfm_NtkDeleteObj_rec( p, iFanin );
     }
     Vec_IntClear( Sfm_ObjFiArray(p, iNode) );
+    Sfm_ObjTouch( p, iNode );
     Vec_WrdWriteEntry( p->vTruths, iNode, (word)0 );
 }
 void Sfm_NtkUpdateLevel_rec( Sfm_Ntk_t * p, int iNode )
@@ -351,6 +356,7 @@ void Sfm_NtkUpdate( Sfm_Ntk_t * p, int iNode, int f, int iFaninNew, word uTruth,
         Sfm_NtkUpdateLevelR_rec( p, iFanin );
     // update truth table
     Vec_WrdWriteEntry( p->vTruths, iNode, uTruth );
+    Sfm_ObjTouch( p, iNode );
     if ( p->vTruths2 && Vec_WrdSize(p->vTruths2) )
         Abc_TtCopy( Vec_WrdEntryP(p->vTruths2, Vec_IntEntry(p->vStarts, iNode)), pTruth, nWords, 0 );
     Sfm_TruthToCnf( uTruth, pTruth, Sfm_ObjFaninNum(p, iNode), p->vCover, (Vec_Str_t *)Vec_WecEntry(p->vCnfs, iNode) );
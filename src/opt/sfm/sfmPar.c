@@ -0,0 +1,345 @@
+/**CFile****************************************************************
+
+  FileName    [sfmPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT-based optimization using internal don't-cares.]
+
+  Synopsis    [Parallel windowed optimization.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: sfmPar.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "sfmInt.h"
+#include "misc/util/utilPool.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The candidate nodes are divided into regions of consecutive nodes, which
+// are optimized concurrently: each batch contains the next node of every
+// region, so that the nodes of a batch are far apart in the network and
+// rarely share their windows. The workers evaluate the nodes of a batch
+// against the network frozen at the beginning of the batch. Each worker has
+// its own window manager and SAT solver, while the network is shared
+// read-only. When a change is found, the worker records it together with
+// the window used to prove it. After that, the changes are committed in the
+// order of regions. A change is applied as is, if none of its window objects
+// was modified by the changes committed earlier in this batch (a modified
+// object is a node with new fanins or function, a deleted node, or a node
+// with a new fanout) and if the new fanin still meets the level bound, which
+// depends on the levels updated by the earlier changes; otherwise, it is
+// re-derived for the current network.
+// Since the batches do not depend on the number of threads, the result is
+// the same for any number of threads.
+
+#define SFM_PAR_BATCH  32   // the number of regions (candidates in one batch)
+
+typedef struct Sfm_Prop_t_ Sfm_Prop_t;
+struct Sfm_Prop_t_
+{
+    int               iNode;       // the node
+    int               fFound;      // the change is found
+    int               iFanin;      // the fanin to replace (-1 if the function is updated)
+    int               iFaninNew;   // the new fanin (-1 if the fanin is removed)
+    word              uTruth;      // the new function
+    word              pTruth[SFM_WORDS_MAX]; // the new function (large nodes)
+    Vec_Int_t *       vWin;        // the window objects
+};
+
+typedef struct Sfm_Job_t_ Sfm_Job_t;
+struct Sfm_Job_t_
+{
+    Sfm_Ntk_t *       p;           // the worker
+    Sfm_Prop_t *      pProps;      // the candidates of the batch
+    int               nProps;      // the number of candidates
+    int               iStart;      // the first candidate of this worker
+    int               nStep;       // the distance between the candidates of this worker
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the worker.]
+
+  Description [The worker shares the network with the manager and owns
+  the traversal data, the window, and the SAT solver.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Sfm_Ntk_t * Sfm_NtkStartWorker( Sfm_Ntk_t * p )
+{
+    Sfm_Ntk_t * pNew = ABC_CALLOC( Sfm_Ntk_t, 1 );
+    int i;
+    pNew->pPars    = ABC_ALLOC( Sfm_Par_t, 1 );
+    *pNew->pPars   = *p->pPars;
+    pNew->pPars->fVeryVerbose = 0;
+    pNew->nPis     = p->nPis;
+    pNew->nPos     = p->nPos;
+    pNew->nNodes   = p->nNodes;
+    pNew->nObjs    = p->nObjs;
+    // shared data
+    pNew->vFixed   = p->vFixed;
+    pNew->vEmpty   = p->vEmpty;
+    pNew->vTruths  = p->vTruths;
+    pNew->vFanins  = p->vFanins;
+    pNew->vStarts  = p->vStarts;
+    pNew->vTruths2 = p->vTruths2;
+    pNew->vFanouts = p->vFanouts;
+    pNew->vLevels  = p->vLevels;
+    pNew->vLevelsR = p->vLevelsR;
+    pNew->vCnfs    = p->vCnfs;
+    // own data
+    Vec_IntFill( &pNew->vCounts,   pNew->nObjs,  0 );
+    Vec_IntFill( &pNew->vTravIds,  pNew->nObjs,  0 );
+    Vec_IntFill( &pNew->vTravIds2, pNew->nObjs,  0 );
+    Vec_IntFill( &pNew->vId2Var,   2*pNew->nObjs, -1 );
+    Vec_IntFill( &pNew->vVar2Id,   2*pNew->nObjs, -1 );
+    pNew->vCover   = Vec_IntAlloc( 1 << 16 );
+    for ( i = 0; i < SFM_FANIN_MAX; i++ )
+        pNew->pTtElems[i] = pNew->TtElems[i];
+    Abc_TtElemInit( pNew->pTtElems, SFM_FANIN_MAX );
+    Sfm_NtkPrepare( pNew );
+    pNew->nLevelMax  = p->nLevelMax;
+    pNew->fSpeculate = 1;
+    return pNew;
+}
+void Sfm_NtkStopWorker( Sfm_Ntk_t * pNew, Sfm_Ntk_t * p )
+{
+    // add the statistics
+    p->nNodesTried  += pNew->nNodesTried;
+    p->nTotalDivs   += pNew->nTotalDivs;
+    p->nSatCalls    += pNew->nSatCalls;
+    p->nTimeOuts    += pNew->nTimeOuts;
+    p->nMaxDivs     += pNew->nMaxDivs;
+    p->nTryRemoves  += pNew->nTryRemoves;
+    p->nTryImproves += pNew->nTryImproves;
+    p->nTryResubs   += pNew->nTryResubs;
+    // own data
+    ABC_FREE( pNew->vCounts.pArray );
+    ABC_FREE( pNew->vTravIds.pArray );
+    ABC_FREE( pNew->vTravIds2.pArray );
+    ABC_FREE( pNew->vId2Var.pArray );
+    ABC_FREE( pNew->vVar2Id.pArray );
+    Vec_IntFree( pNew->vCover );
+    Vec_IntFreeP( &pNew->vNodes );
+    Vec_IntFreeP( &pNew->vDivs  );
+    Vec_IntFreeP( &pNew->vRoots );
+    Vec_IntFreeP( &pNew->vTfo   );
+    Vec_WrdFreeP( &pNew->vDivCexes );
+    Vec_IntFreeP( &pNew->vOrder );
+    Vec_IntFreeP( &pNew->vDivVars );
+    Vec_IntFreeP( &pNew->vDivIds );
+    Vec_IntFreeP( &pNew->vLits  );
+    Vec_IntFreeP( &pNew->vValues );
+    Vec_WecFreeP( &pNew->vClauses );
+    Vec_IntFreeP( &pNew->vFaninMap );
+    if ( pNew->pSat ) sat_solver_delete( pNew->pSat );
+    ABC_FREE( pNew->pPars );
+    ABC_FREE( pNew );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Evaluates the candidates assigned to one worker.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Sfm_NtkWorkerTask( void * pArg )
+{
+    Sfm_Job_t * pJob = (Sfm_Job_t *)pArg;
+    Sfm_Ntk_t * p = pJob->p;
+    Sfm_Prop_t * pProp;
+    int i;
+    for ( i = pJob->iStart; i < pJob->nProps; i += pJob->nStep )
+    {
+        pProp = pJob->pProps + i;
+        pProp->fFound = Sfm_NodeResub( p, pProp->iNode );
+        if ( !pProp->fFound )
+            continue;
+        pProp->iFanin    = p->iPropFanin;
+        pProp->iFaninNew = p->iPropNew;
+        pProp->uTruth    = p->uPropTruth;
+        memcpy( pProp->pTruth, p->pTruth, sizeof(word) * SFM_WORDS_MAX );
+        Vec_IntClear( pProp->vWin );
+        Vec_IntAppend( pProp->vWin, p->vOrder );
+    }
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Commits the change found by the worker.]
+
+  Description [Returns 1 if the node was changed. The change is re-derived
+  if its window was modified by the earlier changes of the batch or if the
+  new fanin no longer meets the level bound used to select the divisors.
+  The levels are updated for the whole TFI/TFO of a changed node, so they
+  are checked here rather than tracked in the window.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sfm_NtkCommit( Sfm_Ntk_t * p, Sfm_Prop_t * pProp )
+{
+    int i, iObj, iNode = pProp->iNode, fRetry = 0;
+    // re-derive the change if the window was modified
+    Vec_IntForEachEntry( pProp->vWin, iObj, i )
+        if ( Sfm_ObjIsTouched(p, iObj) )
+        {
+            fRetry = 1;
+            break;
+        }
+    // re-derive the change if the new fanin is too deep after the earlier changes
+    if ( pProp->iFaninNew >= 0 && Sfm_ObjLevel(p, pProp->iFaninNew) > p->nLevelMax - Sfm_ObjLevelR(p, iNode) )
+        fRetry = 1;
+    if ( fRetry )
+    {
+        p->nParRetries++;
+        return Sfm_ObjFanoutNum(p, iNode) > 0 && Sfm_NodeResub( p, iNode );
+    }
+    // update the function
+    if ( pProp->iFanin == -1 )
+    {
+        p->nImproves++;
+        Vec_WrdWriteEntry( p->vTruths, iNode, pProp->uTruth );
+        Sfm_ObjTouch( p, iNode );
+        Sfm_TruthToCnf( pProp->uTruth, NULL, Sfm_ObjFaninNum(p, iNode), p->vCover, (Vec_Str_t *)Vec_WecEntry(p->vCnfs, iNode) );
+        return 1;
+    }
+    // update the fanins
+    if ( pProp->iFaninNew == -1 )
+        p->nRemoves++;
+    else
+        p->nResubs++;
+    Sfm_NtkUpdate( p, iNode, pProp->iFanin, pProp->iFaninNew, pProp->uTruth, pProp->pTruth );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs optimization using several threads.]
+
+  Description [Returns the number of changed nodes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sfm_NtkPerformPar( Sfm_Ntk_t * p, int * pCounterLarge )
+{
+    Sfm_Ntk_t * pWorkers[ABC_POOL_THR_MAX];
+    Abc_Task_t * pTasks[ABC_POOL_THR_MAX];
+    Sfm_Job_t pJobs[ABC_POOL_THR_MAX];
+    Sfm_Prop_t * pProps = ABC_CALLOC( Sfm_Prop_t, SFM_PAR_BATCH );
+    Vec_Int_t * vCands = Vec_IntAlloc( p->nNodes );
+    int nThreads = Abc_MinInt( p->pPars->nThreads, ABC_POOL_THR_MAX );
+    int i, k, t, r, b, nBatches, nProps, iNode, Counter = 0;
+    abctime clk;
+    // collect the candidates
+    Sfm_NtkForEachNode( p, iNode )
+    {
+        if ( Sfm_ObjIsFixed( p, iNode ) )
+            continue;
+        if ( p->pPars->nDepthMax && Sfm_ObjLevel(p, iNode) > p->pPars->nDepthMax )
+            continue;
+        if ( Sfm_ObjFaninNum(p, iNode) > SFM_SUPP_MAX )
+        {
+            (*pCounterLarge)++;
+            continue;
+        }
+        Vec_IntPush( vCands, iNode );
+    }
+    nBatches = (Vec_IntSize(vCands) + SFM_PAR_BATCH - 1) / SFM_PAR_BATCH;
+    Vec_IntFill( &p->vStamps, p->nObjs, 0 );
+    for ( t = 0; t < nThreads; t++ )
+        pWorkers[t] = Sfm_NtkStartWorker( p );
+    for ( i = 0; i < SFM_PAR_BATCH; i++ )
+        pProps[i].vWin = Vec_IntAlloc( 100 );
+    for ( b = 0; b < nBatches; b++ )
+    {
+        // take the next candidate of each region (skipping the nodes deleted by other regions)
+        for ( nProps = r = 0; r < SFM_PAR_BATCH; r++ )
+            if ( r * nBatches + b < Vec_IntSize(vCands) )
+            {
+                iNode = Vec_IntEntry( vCands, r * nBatches + b );
+                if ( Sfm_ObjFanoutNum(p, iNode) > 0 )
+                    pProps[nProps++].iNode = iNode;
+            }
+        // evaluate the candidates
+        clk = Abc_ClockWall();
+        for ( t = 0; t < nThreads; t++ )
+        {
+            pJobs[t].p      = pWorkers[t];
+            pJobs[t].pProps = pProps;
+            pJobs[t].nProps = nProps;
+            pJobs[t].iStart = t;
+            pJobs[t].nStep  = nThreads;
+        }
+        for ( t = 1; t < nThreads; t++ )
+            pTasks[t] = Abc_TaskStart( Abc_PoolGlobal(), Sfm_NtkWorkerTask, pJobs + t );
+        Sfm_NtkWorkerTask( pJobs );
+        for ( t = 1; t < nThreads; t++ )
+        {
+            Abc_TaskWait( pTasks[t] );
+            Abc_TaskFree( pTasks[t] );
+        }
+        p->timePar += Abc_ClockWall() - clk;
+        // commit the changes in the order of nodes
+        p->nStamps++;
+        for ( i = 0; i < nProps; i++ )
+        {
+            if ( !pProps[i].fFound )
+                continue;
+            p->nParFound++;
+            if ( !Sfm_NtkCommit( p, pProps + i ) )
+                continue;
+            for ( k = 1; Sfm_NodeResub(p, pProps[i].iNode); k++ );
+            Counter++;
+            if ( p->pPars->nNodesMax && Counter >= p->pPars->nNodesMax )
+                break;
+        }
+        if ( i < nProps )
+            break;
+    }
+    for ( i = 0; i < SFM_PAR_BATCH; i++ )
+        Vec_IntFree( pProps[i].vWin );
+    ABC_FREE( pProps );
+    Vec_IntFree( vCands );
+    for ( t = 0; t < nThreads; t++ )
+        Sfm_NtkStopWorker( pWorkers[t], p );
+    return Counter;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
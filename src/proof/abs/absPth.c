@@ -21,6 +21,7 @@
 #include "abs.h"
 #include "proof/pdr/pdr.h"
 #include "proof/ssw/ssw.h"
+#include "misc/util/utilPool.h"
 
 
 #ifdef ABC_USE_PTHREADS
@@ -60,6 +61,7 @@ typedef struct Abs_ThData_t_
 pthread_mutex_t g_mutex = PTHREAD_MUTEX_INITIALIZER;
 static volatile int g_nRunIds = 0;             // the number of the last prover instance
 static volatile int g_fAbstractionProved = 0;  // set to 1 when prover successed to prove
+static Abc_Pool_t * g_pProverPool = NULL;       // the private pool running the provers
 
 // call back procedure for PDR
 int Abs_CallBackToStop( int RunId ) { assert( RunId <= g_nRunIds ); return RunId < g_nRunIds; }
@@ -83,7 +85,7 @@ int Pdr_ManSolve_test( Aig_Man_t * pAig, Pdr_Par_t * pPars, Abc_Cex_t ** ppCex )
 
 /**Function*************************************************************
 
-  Synopsis    [Create one thread]
+  Synopsis    [Runs the prover as a background task.]
 
   Description []
                
@@ -124,9 +126,6 @@ void * Abs_ProverThread( void * pArg )
     // free memory
     Aig_ManStop( pThData->pAig );
     ABC_FREE( pThData );
-    // quit this thread
-    pthread_exit( NULL );
-    assert(0);
     return NULL;
 }
 void Gia_GlaProveAbsracted( Gia_Man_t * pGia, int fSimpProver, int fVerbose )
@@ -136,7 +135,6 @@ void Gia_GlaProveAbsracted( Gia_Man_t * pGia, int fSimpProver, int fVerbose )
     Ssw_Pars_t Pars, * pPars = &Pars;
     Aig_Man_t * pAig, * pTemp;
     Gia_Man_t * pAbs;
-    pthread_t ProverThread;
     int status;
     // disable verbosity
 //    fVerbose = 0;
@@ -170,11 +168,14 @@ void Gia_GlaProveAbsracted( Gia_Man_t * pGia, int fSimpProver, int fVerbose )
     pThData->fVerbose = fVerbose;
     status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
     pThData->RunId = ++g_nRunIds;
+    if ( g_pProverPool == NULL )
+        g_pProverPool = Abc_PoolStart( 1 );
     status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
-    // create thread
+    // run the prover in the background on its own worker, so that it does not
+    // occupy the global pool; a cancelled prover quits at its next check of
+    // the run ID, after which the worker picks up the new one
     if ( fVerbose )  Abc_Print( 1, "\nTrying to prove abstraction %d.\n", pThData->RunId );
-    status = pthread_create( &ProverThread, NULL, Abs_ProverThread, pThData );
-    assert( status == 0 );
+    Abc_TaskFree( Abc_TaskStartBackground( g_pProverPool, Abs_ProverThread, pThData ) );
 }
 void Gia_GlaProveCancel( int fVerbose )
 {
@@ -108,6 +108,7 @@ struct Cec_ParFra_t_
     int              nCallsRecycle; // calls to perform before recycling SAT solver
     int              nSatVarMax;    // the max number of SAT variables
     int              nGenIters;     // pattern generation iterations
+    int              nThreads;      // the number of threads for SAT solving
     int              fRewriting;    // enables AIG rewriting
     int              fCheckMiter;   // the circuit is the miter
 //    int              fFirstStop;    // stop on the first sat output
@@ -117,6 +118,7 @@ struct Cec_ParFra_t_
     int              fRunCSat;      // enable another solver
     int              fUseCones;     // use cones
     int              fUseOrigIds;   // enable recording of original IDs
+    int              fIncremental;  // reuse the sweeping session across calls
     int              fVeryVerbose;  // verbose stats
     int              fVerbose;      // verbose stats
     int              iOutFail;      // the failed output
@@ -132,6 +134,7 @@ struct Cec_ParCec_t_
     int              fUseSmartCnf;  // use smart CNF computation
     int              fRewriting;    // enables AIG rewriting
     int              fNaive;        // performs naive SAT-based checking
+    int              nThreads;      // the number of Glucose solvers in naive checking
     int              fSilent;       // print no messages
     int              fVeryVerbose;  // verbose stats
     int              fVerbose;      // verbose stats
@@ -23,6 +23,7 @@
 #include "aig/gia/giaAig.h"
 #include "misc/extra/extra.h"
 #include "sat/cnf/cnf.h"
+#include "sat/glucose2/AbcGlucosePort2.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -212,11 +213,39 @@ int Cec_ManHandleSpecialCases( Gia_Man_t * p, Cec_ParCec_t * pPars )
     return -1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Solves one query in the naive checking.]
+
+  Description [Uses the portfolio of Glucose solvers if it is given.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cec_ManVerifyNaiveSolve( sat_solver * pSat, bmcg2_sat_port * pPort, int * pLits, int nBTLimit )
+{
+    int status;
+    if ( pSat )
+        return sat_solver_solve( pSat, pLits, pLits + 2, nBTLimit, 0, 0, 0 );
+    bmcg2_sat_port_set_conflict_budget( pPort, nBTLimit );
+    status = bmcg2_sat_port_solve( pPort, pLits, 2 );
+    return status == 1 ? l_True : status == -1 ? l_False : l_Undef;
+}
+static int Cec_ManVerifyNaiveAddClause( sat_solver * pSat, bmcg2_sat_port * pPort, int * pLits )
+{
+    if ( pSat )
+        return sat_solver_addclause( pSat, pLits, pLits + 2 );
+    return bmcg2_sat_port_addclause( pPort, pLits, 2 );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Performs naive checking.]
 
-  Description []
+  Description [If the number of threads is more than one, the queries
+  are solved by the portfolio of Glucose solvers sharing learned clauses.]
                
   SideEffects []
 
@@ -226,7 +255,8 @@ int Cec_ManHandleSpecialCases( Gia_Man_t * p, Cec_ParCec_t * pPars )
 int Cec_ManVerifyNaive( Gia_Man_t * p, Cec_ParCec_t * pPars )
 {
     Cnf_Dat_t * pCnf = (Cnf_Dat_t *)Mf_ManGenerateCnf( p, 8, 0, 0, 0, 0 );
-    sat_solver * pSat = (sat_solver *)Cnf_DataWriteIntoSolver( pCnf, 1, 0 );
+    sat_solver * pSat = pPars->nThreads > 1 ? NULL : (sat_solver *)Cnf_DataWriteIntoSolver( pCnf, 1, 0 );
+    bmcg2_sat_port * pPort = pPars->nThreads > 1 ? bmcg2_sat_port_start( pPars->nThreads ) : NULL;
     Gia_Obj_t * pObj0, * pObj1;
     abctime clkStart = Abc_Clock();
     int nPairs = Gia_ManPoNum(p)/2;
@@ -234,6 +264,14 @@ int Cec_ManVerifyNaive( Gia_Man_t * p, Cec_ParCec_t * pPars )
     int i, iVar0, iVar1, pLits[2], status, RetValue;
     ProgressBar * pProgress = Extra_ProgressBarStart( stdout, nPairs );
     assert( Gia_ManPoNum(p) % 2 == 0 );
+    if ( pPort )
+    {
+        while ( bmcg2_sat_port_varnum(pPort) < pCnf->nVars )
+            bmcg2_sat_port_addvar( pPort );
+        for ( i = 0; i < pCnf->nClauses; i++ )
+            if ( !bmcg2_sat_port_addclause( pPort, pCnf->pClauses[i], pCnf->pClauses[i+1]-pCnf->pClauses[i] ) )
+                assert( 0 );
+    }
     for ( i = 0; i < nPairs; i++ )
     {
         if ( (i & 0xFF) == 0 )
@@ -259,12 +297,12 @@ int Cec_ManVerifyNaive( Gia_Man_t * p, Cec_ParCec_t * pPars )
         pLits[1] = Abc_Var2Lit( iVar1, 0 );
         // check direct
         pLits[0] = lit_neg(pLits[0]);
-        status = sat_solver_solve( pSat, pLits, pLits + 2, pPars->nBTLimit, 0, 0, 0 );
+        status = Cec_ManVerifyNaiveSolve( pSat, pPort, pLits, pPars->nBTLimit );
         if ( status == l_False )
         {
             pLits[0] = lit_neg( pLits[0] );
             pLits[1] = lit_neg( pLits[1] );
-            RetValue = sat_solver_addclause( pSat, pLits, pLits + 2 );
+            RetValue = Cec_ManVerifyNaiveAddClause( pSat, pPort, pLits );
             assert( RetValue );
         }
         else if ( status == l_True )
@@ -279,12 +317,12 @@ int Cec_ManVerifyNaive( Gia_Man_t * p, Cec_ParCec_t * pPars )
             continue;
         }
         // check inverse
-        status = sat_solver_solve( pSat, pLits, pLits + 2, pPars->nBTLimit, 0, 0, 0 );
+        status = Cec_ManVerifyNaiveSolve( pSat, pPort, pLits, pPars->nBTLimit );
         if ( status == l_False )
         {
             pLits[0] = lit_neg( pLits[0] );
             pLits[1] = lit_neg( pLits[1] );
-            RetValue = sat_solver_addclause( pSat, pLits, pLits + 2 );
+            RetValue = Cec_ManVerifyNaiveAddClause( pSat, pPort, pLits );
             assert( RetValue );
         }
         else if ( status == l_True )
@@ -303,8 +341,13 @@ int Cec_ManVerifyNaive( Gia_Man_t * p, Cec_ParCec_t * pPars )
     Extra_ProgressBarStop( pProgress );
     printf( "UNSAT = %6d.  SAT = %6d.   UNDEC = %6d.  Trivial = %6d.  ", nUnsats, nSats, nUndecs, nTrivs );
     Abc_PrintTime( 1, "Time", Abc_Clock() - clkStart );
+    if ( pPort && pPars->fVerbose )
+        bmcg2_sat_port_print_stats( pPort );
     Cnf_DataFree( pCnf );
-    sat_solver_delete( pSat );
+    if ( pSat )
+        sat_solver_delete( pSat );
+    if ( pPort )
+        bmcg2_sat_port_stop( pPort );
     if ( nSats )
         return 0;
     if ( nUndecs )
@@ -164,6 +164,7 @@ void Cec_ManCecSetDefaultParams( Cec_ParCec_t * p )
 //    p->fFirstStop     =       0;  // stop on the first sat output
     p->fUseSmartCnf   =       0;  // use smart CNF computation
     p->fRewriting     =       0;  // enables AIG rewriting
+    p->nThreads       =       1;  // the number of Glucose solvers in naive checking
     p->fVeryVerbose   =       0;  // verbose stats
     p->fVerbose       =       0;  // verbose stats
     p->iOutFail       =      -1;  // the number of failed output
@@ -20,6 +20,7 @@
 
 #include "aig/gia/gia.h"
 #include "misc/util/utilTruth.h"
+#include "misc/util/utilPool.h"
 #include "cec.h"
 
 #define USE_GLUCOSE2
@@ -81,6 +82,21 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// sweeping session reused across calls
+typedef struct Cec4_Ses_t_ Cec4_Ses_t;
+struct Cec4_Ses_t_
+{
+    Gia_Man_t *      pNew;           // internal AIG of all calls (strashed)
+    sat_solver *     pSat;           // SAT solver loaded with the CNF of pNew
+    Vec_Int_t *      vMerged;        // proved representative literal of each node of pNew (or -1)
+    Vec_Ptr_t *      vPats;          // recent counter-examples (literals of CI indices)
+    int              iPatNext;       // the next pattern to overwrite
+    int              jType;          // solver type
+    int              nCalls;         // the number of calls
+    int              nObjsStart;     // the number of nodes before the current call
+    int              nReused;        // nodes found in pNew during the current call
+};
+
 // SAT solving manager
 typedef struct Cec4_Man_t_ Cec4_Man_t;
 struct Cec4_Man_t_
@@ -88,8 +104,13 @@ struct Cec4_Man_t_
     Cec_ParFra_t *   pPars;          // parameters
     Gia_Man_t *      pAig;           // user's AIG
     Gia_Man_t *      pNew;           // internal AIG
+    Cec4_Ses_t *     pSes;           // session (or NULL)
     // SAT solving
     sat_solver *     pSat;           // SAT solver
+    Vec_Int_t *      vSatIds;        // SAT variable of each node of pNew (or -1)
+    Vec_Int_t *      vSuppVars;      // nodes of pNew that have SAT variables
+    Vec_Int_t *      vCopiesTwo;     // pairs (CI node of pNew, SAT variable)
+    Vec_Int_t *      vVarMap;        // node of pNew of each SAT variable
     Vec_Ptr_t *      vFrontier;      // CNF construction
     Vec_Ptr_t *      vFanins;        // CNF construction
     Vec_Int_t *      vCexMin;        // minimized CEX
@@ -104,6 +125,16 @@ struct Cec4_Man_t_
     int              iPosRead;       // candidate reading position
     int              iPosWrite;      // candidate writing position
     int              iLastConst;     // last const node proved
+    // multi-threading
+    Cec4_Man_t *     pMain;          // the main manager (or this manager)
+    Cec4_Man_t **    pWorkers;       // per-thread managers (the first one is the main manager)
+    int              nWorkers;       // the number of threads
+    int              iWorker;        // the index of this manager among the workers
+    Vec_Int_t *      vBatch;         // candidate pairs (node, repr) solved in parallel
+    Vec_Int_t *      vBatchRes;      // the SAT status of each pair
+    Vec_Int_t *      vBatchPats;     // counter-examples found by a worker (pair, size, CI literals)
+    Vec_Bit_t *      vPending;       // nodes of pAig whose pairs are in the batch
+    Vec_Int_t *      vProvedBy;      // the node of pAig each node was proved equal to (or -1)
     // refinement
     Vec_Int_t *      vRefClasses;
     Vec_Int_t *      vRefNodes;
@@ -131,6 +162,8 @@ struct Cec4_Man_t_
     abctime          timeSatSat;
     abctime          timeSatUnsat;
     abctime          timeSatUndec;
+    abctime          timeSatWait;
+    abctime          timeSatWorkers;
     abctime          timeSim;
     abctime          timeRefine;
     abctime          timeResimGlo;
@@ -142,6 +175,19 @@ static inline int    Cec4_ObjSatId( Gia_Man_t * p, Gia_Obj_t * pObj )
 static inline int    Cec4_ObjSetSatId( Gia_Man_t * p, Gia_Obj_t * pObj, int Num ) { assert(Cec4_ObjSatId(p, pObj) == -1); Gia_ObjSetCopy2Array(p, Gia_ObjId(p, pObj), Num); Vec_IntPush(&p->vSuppVars, Gia_ObjId(p, pObj)); if ( Gia_ObjIsCi(pObj) ) Vec_IntPushTwo(&p->vCopiesTwo, Gia_ObjId(p, pObj), Num); assert(Vec_IntSize(&p->vVarMap) == Num); Vec_IntPush(&p->vVarMap, Gia_ObjId(p, pObj)); return Num;  }
 static inline void   Cec4_ObjCleanSatId( Gia_Man_t * p, Gia_Obj_t * pObj )        { assert(Cec4_ObjSatId(p, pObj) != -1); Gia_ObjSetCopy2Array(p, Gia_ObjId(p, pObj), -1);               }
 
+// SAT variables of the manager, which are stored in pNew for the main manager and separately for the workers
+static inline int    Cec4_ManSatId( Cec4_Man_t * p, int iObj )                    { return Vec_IntEntry(p->vSatIds, iObj);                                                               }
+static inline int    Cec4_ManSetSatId( Cec4_Man_t * p, int iObj, int Num )        { assert(Cec4_ManSatId(p, iObj) == -1); Vec_IntWriteEntry(p->vSatIds, iObj, Num); Vec_IntPush(p->vSuppVars, iObj); if ( Gia_ObjIsCi(Gia_ManObj(p->pNew, iObj)) ) Vec_IntPushTwo(p->vCopiesTwo, iObj, Num); assert(Vec_IntSize(p->vVarMap) == Num); Vec_IntPush(p->vVarMap, iObj); return Num;  }
+
+// the number of counter-examples kept by the session
+#define CEC4_SES_PATS_MAX  255
+// the number of candidate pairs per thread in one batch
+#define CEC4_BATCH_PAIRS    16
+
+static Cec4_Ses_t * s_pCec4Ses = NULL;
+
+extern Gia_Man_t * Cec4_ManStartNew( Gia_Man_t * pAig );
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -194,6 +240,174 @@ void Cec4_EvalPatterns( Gia_Man_t * p, Vec_Int_t * vPats, int nPats )
     Vec_WrdFree( vSimsPo );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Sweeping session reused across calls.]
+
+  Description [The session keeps the internal AIG, the SAT solver with its 
+  CNF and learned clauses, the proved equivalences, and recent counter-examples.
+  Nodes of the next AIG are strashed into the same internal AIG, so unchanged
+  logic maps into nodes whose equivalences are already proved, and only 
+  the changed cones need SAT calls. The session is restarted when the CI count
+  or the solver type change, or when the internal AIG grows too large.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec4_ManSessionStop()
+{
+    Cec4_Ses_t * p = s_pCec4Ses;
+    if ( p == NULL )
+        return;
+    sat_solver_stop( p->pSat );
+    Gia_ManStopP( &p->pNew );
+    Vec_IntFreeP( &p->vMerged );
+    Vec_VecFree( (Vec_Vec_t *)p->vPats );
+    ABC_FREE( p );
+    s_pCec4Ses = NULL;
+}
+Cec4_Ses_t * Cec4_ManSessionStart( Gia_Man_t * pAig, Cec_ParFra_t * pPars )
+{
+    Cec4_Ses_t * p = s_pCec4Ses;
+    if ( p && (Gia_ManCiNum(p->pNew) != Gia_ManCiNum(pAig) || p->jType != pPars->jType || 
+               !p->pNew->pMuxes != !pAig->pMuxes || Gia_ManObjNum(p->pNew) > 4 * Gia_ManObjNum(pAig) + 1000) )
+    {
+        if ( pPars->fVerbose )
+            printf( "Restarting the sweeping session after %d calls.\n", p->nCalls );
+        Cec4_ManSessionStop();
+        p = NULL;
+    }
+    if ( p == NULL )
+    {
+        p = s_pCec4Ses   = ABC_CALLOC( Cec4_Ses_t, 1 );
+        p->pNew          = Cec4_ManStartNew( pAig );
+        p->pSat          = sat_solver_start();
+        sat_solver_set_jftr( p->pSat, pPars->jType );
+        p->vMerged       = Vec_IntStartFull( Gia_ManObjNum(p->pNew) );
+        p->vPats         = Vec_PtrAlloc( CEC4_SES_PATS_MAX );
+        p->jType         = pPars->jType;
+    }
+    p->nCalls++;
+    p->nReused = 0;
+    return p;
+}
+Gia_Man_t * Cec4_ManSessionNew( Cec4_Ses_t * p, Gia_Man_t * pAig )
+{
+    Gia_Obj_t * pObj; int i;
+    Gia_ManFillValue( pAig );
+    Gia_ManConst0(pAig)->Value = 0;
+    Gia_ManForEachCi( pAig, pObj, i )
+        pObj->Value = Abc_Var2Lit( Gia_ObjId(p->pNew, Gia_ManCi(p->pNew, i)), 0 );
+    // each node of pAig adds at most one node to pNew
+    Vec_IntFillExtra( &p->pNew->vCopies2, Gia_ManObjNum(p->pNew) + Gia_ManObjNum(pAig), -1 );
+    Vec_IntFillExtra( p->vMerged, Gia_ManObjNum(p->pNew) + Gia_ManObjNum(pAig), -1 );
+    p->nObjsStart = Gia_ManObjNum(p->pNew);
+    return p->pNew;
+}
+static inline int Cec4_ManSessionRepr( Cec4_Ses_t * p, int iLit )
+{
+    int iRepr;
+    while ( (iRepr = Vec_IntEntry(p->vMerged, Abc_Lit2Var(iLit))) >= 0 )
+        iLit = Abc_LitNotCond( iRepr, Abc_LitIsCompl(iLit) );
+    return iLit;
+}
+static inline int Cec4_ManSessionLit( Cec4_Ses_t * p, int iLit )
+{
+    iLit = Cec4_ManSessionRepr( p, iLit );
+    if ( Abc_Lit2Var(iLit) < p->nObjsStart )
+        p->nReused++;
+    return iLit;
+}
+void Cec4_ManSessionMerge( Cec4_Ses_t * p, int iLitOld, int iLitNew )
+{
+    // both literals are resolved, so that the redirection chains remain acyclic
+    iLitOld = Cec4_ManSessionRepr( p, iLitOld );
+    iLitNew = Cec4_ManSessionRepr( p, iLitNew );
+    if ( Abc_Lit2Var(iLitOld) == Abc_Lit2Var(iLitNew) )
+        return;
+    Vec_IntWriteEntry( p->vMerged, Abc_Lit2Var(iLitOld), Abc_LitNotCond(iLitNew, Abc_LitIsCompl(iLitOld)) );
+}
+void Cec4_ManSessionAddPat( Cec4_Ses_t * p, Gia_Man_t * pNew, Vec_Int_t * vPat )
+{
+    // the pattern refers to the CI nodes of the SAT AIG; it is saved in terms
+    // of CI indices, which are the same in all AIGs of the session
+    Vec_Int_t * vSaved; int i, iLit;
+    if ( Vec_PtrSize(p->vPats) < CEC4_SES_PATS_MAX )
+        Vec_PtrPush( p->vPats, (vSaved = Vec_IntAlloc(Vec_IntSize(vPat))) );
+    else
+    {
+        vSaved = (Vec_Int_t *)Vec_PtrEntry( p->vPats, p->iPatNext );
+        Vec_IntClear( vSaved );
+        p->iPatNext = (p->iPatNext + 1) % CEC4_SES_PATS_MAX;
+    }
+    Vec_IntForEachEntry( vPat, iLit, i )
+    {
+        Gia_Obj_t * pObj = Gia_ManObj( pNew, Abc_Lit2Var(iLit) );
+        if ( !Gia_ObjIsCi(pObj) ) // the constant node
+            continue;
+        Vec_IntPush( vSaved, Abc_Var2Lit(Gia_ObjCioId(pObj), Abc_LitIsCompl(iLit)) );
+    }
+}
+void Cec4_ManSessionLoadPats( Cec4_Ses_t * p, Gia_Man_t * pAig )
+{
+    // the saved patterns overwrite random values starting from bit 1 (bit 0 is the all-0 pattern)
+    Vec_Int_t * vPat; int i, k, iLit;
+    Vec_PtrForEachEntry( Vec_Int_t *, p->vPats, vPat, i )
+    {
+        if ( i + 1 == 64 * pAig->nSimWords )
+            break;
+        Vec_IntForEachEntry( vPat, iLit, k )
+        {
+            word * pSim;
+            assert( Abc_Lit2Var(iLit) < Gia_ManCiNum(pAig) );
+            pSim = Vec_WrdEntryP( pAig->vSims, pAig->nSimWords * Gia_ObjId(pAig, Gia_ManCi(pAig, Abc_Lit2Var(iLit))) );
+            if ( Abc_InfoHasBit( (unsigned*)pSim, i + 1 ) != Abc_LitIsCompl(iLit) )
+                Abc_InfoXorBit( (unsigned*)pSim, i + 1 );
+        }
+    }
+}
+Gia_Man_t * Cec4_ManSessionDerive( Cec4_Ses_t * p, Gia_Man_t * pAig )
+{
+    Gia_Man_t * pNew = p->pNew, * pRes;
+    Gia_Obj_t * pObj; int i, iLit;
+    // mark the cones of the outputs in the session AIG
+    Gia_ManCleanMark0( pNew );
+    Gia_ManForEachCo( pAig, pObj, i )
+        Gia_ManObj( pNew, Abc_Lit2Var(Gia_ObjFanin0Copy(pObj)) )->fMark0 = 1;
+    Gia_ManForEachAndReverse( pNew, pObj, i )
+        if ( pObj->fMark0 )
+            Gia_ObjFanin0(pObj)->fMark0 = Gia_ObjFanin1(pObj)->fMark0 = 1;
+    // copy the marked nodes
+    pRes = Gia_ManStart( Gia_ManObjNum(pAig) );
+    pRes->pName = Abc_UtilStrsav( pAig->pName );
+    pRes->pSpec = Abc_UtilStrsav( pAig->pSpec );
+    if ( pNew->pMuxes )
+        pRes->pMuxes = ABC_CALLOC( unsigned, pRes->nObjsAlloc );
+    Gia_ManConst0(pNew)->Value = 0;
+    Gia_ManForEachCi( pNew, pObj, i )
+        pObj->Value = Gia_ManAppendCi( pRes );
+    Gia_ManForEachAnd( pNew, pObj, i )
+        if ( !pObj->fMark0 )
+            continue;
+        else if ( Gia_ObjIsXor(pObj) )
+            pObj->Value = Gia_ManAppendXorReal( pRes, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+        else
+            pObj->Value = Gia_ManAppendAnd( pRes, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+    Gia_ManForEachCo( pAig, pObj, i )
+    {
+        iLit = Gia_ObjFanin0Copy(pObj);
+        Gia_ManAppendCo( pRes, Abc_LitNotCond(Gia_ManObj(pNew, Abc_Lit2Var(iLit))->Value, Abc_LitIsCompl(iLit)) );
+    }
+    Gia_ManSetRegNum( pRes, Gia_ManRegNum(pAig) );
+    // restore the session AIG
+    Gia_ManCleanMark0( pNew );
+    Gia_ManForEachObj( pNew, pObj, i )
+        pObj->Value = 0;
+    return pRes;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Default parameter settings.]
@@ -218,6 +432,7 @@ void Cec4_ManSetParams( Cec_ParFra_t * pPars )
     pPars->nSatVarMax     =    1000;    // the max number of SAT variables before recycling SAT solver
     pPars->nCallsRecycle  =     500;    // calls to perform before recycling SAT solver
     pPars->nGenIters      =     100;    // pattern generation iterations
+    pPars->nThreads       =       1;    // the number of threads
 }
 
 /**Function*************************************************************
@@ -235,11 +450,17 @@ Cec4_Man_t * Cec4_ManCreate( Gia_Man_t * pAig, Cec_ParFra_t * pPars )
 {
     Cec4_Man_t * p = ABC_CALLOC( Cec4_Man_t, 1 );
     memset( p, 0, sizeof(Cec4_Man_t) );
-    p->timeStart     = Abc_Clock();
+    p->timeStart     = Abc_ClockWall();
     p->pPars         = pPars;
     p->pAig          = pAig;
-    p->pSat          = sat_solver_start();  
-    sat_solver_set_jftr( p->pSat, pPars->jType );
+    p->pSes          = pPars->fIncremental ? Cec4_ManSessionStart( pAig, pPars ) : NULL;
+    if ( p->pSes )
+        p->pSat      = p->pSes->pSat;
+    else
+    {
+        p->pSat      = sat_solver_start();  
+        sat_solver_set_jftr( p->pSat, pPars->jType );
+    }
     p->vFrontier     = Vec_PtrAlloc( 1000 );
     p->vFanins       = Vec_PtrAlloc( 100 );
     p->vCexMin       = Vec_IntAlloc( 100 );
@@ -249,7 +470,7 @@ Cec4_Man_t * Cec4_ManCreate( Gia_Man_t * pAig, Cec_ParFra_t * pPars )
     p->vVisit        = Vec_IntAlloc( 100 );
     p->vPat          = Vec_IntAlloc( 100 );
     p->vDisprPairs   = Vec_IntAlloc( 100 );
-    p->vFails        = Vec_BitStart( Gia_ManObjNum(pAig) );
+    p->vFails        = Vec_BitStart( Gia_ManObjNum(pAig) + (p->pSes ? Gia_ManObjNum(p->pSes->pNew) : 0) );
     //pAig->pData     = p->pSat; // point AIG manager to the solver
     //Vec_IntFreeP( &p->pAig->vPats );
     //p->pAig->vPats = Vec_IntAlloc( 1000 );
@@ -266,8 +487,9 @@ void Cec4_ManDestroy( Cec4_Man_t * p )
 {
     if ( p->pPars->fVerbose ) 
     {
-        abctime timeTotal = Abc_Clock() - p->timeStart;
-        abctime timeSat   = p->timeSatSat0 + p->timeSatSat + p->timeSatUnsat0 + p->timeSatUnsat + p->timeSatUndec;
+        abctime timeTotal = Abc_ClockWall() - p->timeStart;
+        // the total is the elapsed time of the main thread, while the SAT times include the workers
+        abctime timeSat   = p->timeSatSat0 + p->timeSatSat + p->timeSatUnsat0 + p->timeSatUnsat + p->timeSatUndec + p->timeSatWait - p->timeSatWorkers;
         abctime timeOther = timeTotal - timeSat - p->timeSim - p->timeRefine - p->timeResimLoc - p->timeGenPats;// - p->timeResimGlo;
         ABC_PRTP( "SAT solving  ", timeSat,          timeTotal );
         ABC_PRTP( "  sat(easy)  ", p->timeSatSat0,   timeTotal );
@@ -275,6 +497,10 @@ void Cec4_ManDestroy( Cec4_Man_t * p )
         ABC_PRTP( "  unsat(easy)", p->timeSatUnsat0, timeTotal );
         ABC_PRTP( "  unsat      ", p->timeSatUnsat,  timeTotal );
         ABC_PRTP( "  fail       ", p->timeSatUndec,  timeTotal );
+        if ( p->timeSatWait )
+        ABC_PRTP( "  wait       ", p->timeSatWait,   timeTotal );
+        if ( p->timeSatWorkers )
+        ABC_PRTP( "  workers    ", p->timeSatWorkers,timeTotal );
         ABC_PRTP( "Generate CNF ", p->timeCnf,       timeTotal );
         ABC_PRTP( "Generate pats", p->timeGenPats,   timeTotal );
         ABC_PRTP( "Simulation   ", p->timeSim,       timeTotal );
@@ -292,8 +518,11 @@ void Cec4_ManDestroy( Cec4_Man_t * p )
     Vec_WrdFreeP( &p->pAig->vSims );
     Vec_WrdFreeP( &p->pAig->vSimsPi );
     Gia_ManCleanMark01( p->pAig );
-    sat_solver_stop( p->pSat );
-    Gia_ManStopP( &p->pNew );
+    if ( p->pSes == NULL )
+    {
+        sat_solver_stop( p->pSat );
+        Gia_ManStopP( &p->pNew );
+    }
     Vec_PtrFreeP( &p->vFrontier );
     Vec_PtrFreeP( &p->vFanins );
     Vec_IntFreeP( &p->vCexMin );
@@ -308,6 +537,11 @@ void Cec4_ManDestroy( Cec4_Man_t * p )
     Vec_IntFreeP( &p->vRefClasses );
     Vec_IntFreeP( &p->vRefNodes );
     Vec_IntFreeP( &p->vRefBins );
+    Vec_IntFreeP( &p->vBatch );
+    Vec_IntFreeP( &p->vBatchRes );
+    Vec_IntFreeP( &p->vBatchPats );
+    Vec_BitFreeP( &p->vPending );
+    Vec_IntFreeP( &p->vProvedBy );
     ABC_FREE( p->pTable );
     ABC_FREE( p );
 }
@@ -542,11 +776,11 @@ int Cec4_ObjGetCnfVar( Cec4_Man_t * p, int iObj )
     Gia_Obj_t * pObj = Gia_ManObj(p->pNew, iObj);
     int i, k;
     // quit if CNF is ready
-    if ( Cec4_ObjSatId(p->pNew,pObj) >= 0 )
-        return Cec4_ObjSatId(p->pNew,pObj);
+    if ( Cec4_ManSatId(p, iObj) >= 0 )
+        return Cec4_ManSatId(p, iObj);
     assert( iObj > 0 );
     if ( Gia_ObjIsCi(pObj) )
-        return Cec4_ObjSetSatId( p->pNew, pObj, sat_solver_addvar(p->pSat) );
+        return Cec4_ManSetSatId( p, iObj, sat_solver_addvar(p->pSat) );
     assert( Gia_ObjIsAnd(pObj) );
     if ( fUseSimple )
     {
@@ -557,7 +791,7 @@ int Cec4_ObjGetCnfVar( Cec4_Man_t * p, int iObj )
         {
             int iVar0 = Cec4_ObjGetCnfVar( p, Gia_ObjId(p->pNew, Gia_Regular(pFan0)) );
             int iVar1 = Cec4_ObjGetCnfVar( p, Gia_ObjId(p->pNew, Gia_Regular(pFan1)) );
-            int iVar  = Cec4_ObjSetSatId( p->pNew, pObj, sat_solver_addvar(p->pSat) );
+            int iVar  = Cec4_ManSetSatId( p, iObj, sat_solver_addvar(p->pSat) );
             if ( p->pPars->jType < 2 )
                 sat_solver_add_xor( p->pSat, iVar, iVar0, iVar1, 0 );
             if ( p->pPars->jType > 0 )
@@ -575,7 +809,7 @@ int Cec4_ObjGetCnfVar( Cec4_Man_t * p, int iObj )
         {
             int iVar0 = Cec4_ObjGetCnfVar( p, Gia_ObjFaninId0(pObj, iObj) );
             int iVar1 = Cec4_ObjGetCnfVar( p, Gia_ObjFaninId1(pObj, iObj) );
-            int iVar  = Cec4_ObjSetSatId( p->pNew, pObj, sat_solver_addvar(p->pSat) );
+            int iVar  = Cec4_ManSetSatId( p, iObj, sat_solver_addvar(p->pSat) );
             if ( p->pPars->jType < 2 )
             {
                 if ( Gia_ObjIsXor(pObj) )
@@ -593,9 +827,10 @@ int Cec4_ObjGetCnfVar( Cec4_Man_t * p, int iObj )
                 p->nGates[Gia_ObjIsXor(pObj)]++;
             }
         }
-        return Cec4_ObjSatId( p->pNew, pObj );
+        return Cec4_ManSatId( p, iObj );
     }
     assert( !Gia_ObjIsXor(pObj) );
+    assert( p->vSatIds == &p->pNew->vCopies2 ); // complex CNF is only supported for the main manager
     // start the frontier
     Vec_PtrClear( p->vFrontier );
     Cec4_ObjAddToFrontier( p->pNew, pObj, p->vFrontier, p->pSat );
@@ -1494,18 +1729,20 @@ int Cec4_ManGeneratePatterns( Cec4_Man_t * p )
 ***********************************************************************/
 void Cec4_ManSatSolverRecycle( Cec4_Man_t * p )
 {
-    Gia_Obj_t * pObj;
-    int i;
+    int i, iObj;
     //printf( "Solver size = %d.\n", sat_solver_varnum(p->pSat) );
     p->nRecycles++;
     p->nCallsSince = 0;
     sat_solver_reset( p->pSat );
     // clean mapping of AigIds into SatIds
-    Gia_ManForEachObjVec( &p->pNew->vSuppVars, p->pNew, pObj, i )
-        Cec4_ObjCleanSatId( p->pNew, pObj );
-    Vec_IntClear( &p->pNew->vSuppVars  );  // AigIds for which SatId is defined
-    Vec_IntClear( &p->pNew->vCopiesTwo );  // pairs (CiAigId, SatId)
-    Vec_IntClear( &p->pNew->vVarMap    );  // mapping of SatId into AigId
+    Vec_IntForEachEntry( p->vSuppVars, iObj, i )
+    {
+        assert( Cec4_ManSatId(p, iObj) != -1 );
+        Vec_IntWriteEntry( p->vSatIds, iObj, -1 );
+    }
+    Vec_IntClear( p->vSuppVars  );  // AigIds for which SatId is defined
+    Vec_IntClear( p->vCopiesTwo );  // pairs (CiAigId, SatId)
+    Vec_IntClear( p->vVarMap    );  // mapping of SatId into AigId
 }
 int Cec4_ManSolveTwo( Cec4_Man_t * p, int iObj0, int iObj1, int fPhase, int * pfEasy, int fVerbose, int fEffort )
 {
@@ -1521,19 +1758,19 @@ int Cec4_ManSolveTwo( Cec4_Man_t * p, int iObj0, int iObj1, int fPhase, int * pf
     // check if SAT solver needs recycling
     p->nCallsSince++; 
     if ( p->nCallsSince > p->pPars->nCallsRecycle && 
-         Vec_IntSize(&p->pNew->vSuppVars) > p->pPars->nSatVarMax && p->pPars->nSatVarMax )
+         Vec_IntSize(p->vSuppVars) > p->pPars->nSatVarMax && p->pPars->nSatVarMax )
         Cec4_ManSatSolverRecycle( p );
     // add more logic to the solver
-    if ( !iObj0 && Cec4_ObjSatId(p->pNew, Gia_ManConst0(p->pNew)) == -1 )
-        Cec4_ObjSetSatId( p->pNew, Gia_ManConst0(p->pNew), sat_solver_addvar(p->pSat) );
+    if ( !iObj0 && Cec4_ManSatId(p, 0) == -1 )
+        Cec4_ManSetSatId( p, 0, sat_solver_addvar(p->pSat) );
     clk = Abc_Clock();
     iVar0 = Cec4_ObjGetCnfVar( p, iObj0 );
     iVar1 = Cec4_ObjGetCnfVar( p, iObj1 );
     if( p->pPars->jType > 0 )
     {
         sat_solver_start_new_round( p->pSat );
-        sat_solver_mark_cone( p->pSat, Cec4_ObjSatId(p->pNew, Gia_ManObj(p->pNew, iObj0)) );
-        sat_solver_mark_cone( p->pSat, Cec4_ObjSatId(p->pNew, Gia_ManObj(p->pNew, iObj1)) );
+        sat_solver_mark_cone( p->pSat, Cec4_ManSatId(p, iObj0) );
+        sat_solver_mark_cone( p->pSat, Cec4_ManSatId(p, iObj1) );
     }
     p->timeCnf += Abc_Clock() - clk;
     // perform solving
@@ -1605,10 +1842,60 @@ int Cec4_ManSolveTwo( Cec4_Man_t * p, int iObj0, int iObj1, int fPhase, int * pf
     //    printf( "*  " );
     return status;
 }
+void Cec4_ManReadCex( Cec4_Man_t * p, Vec_Int_t * vPat )
+{
+    int i, IdAig, IdSat;
+    Vec_IntClear( vPat );
+    if ( p->pPars->jType == 0 )
+    {
+        Vec_IntForEachEntryDouble( p->vCopiesTwo, IdAig, IdSat, i )
+            Vec_IntPush( vPat, Abc_Var2Lit(IdAig, sat_solver_read_cex_varvalue(p->pSat, IdSat)) );
+    }
+    else
+    {
+        int * pCex = sat_solver_read_cex( p->pSat );
+        int * pMap = Vec_IntArray(p->vVarMap);
+        for ( i = 0; i < pCex[0]; )
+            Vec_IntPush( vPat, Abc_Lit2LitV(pMap, Abc_LitNot(pCex[++i])) );
+    }
+}
+void Cec4_ManAddCex( Cec4_Man_t * p, Vec_Int_t * vPat )
+{
+    int i, iLit;
+    //int iPatsOld = p->pAig->iPatsPi;
+    assert( p->pAig->iPatsPi >= 0 && p->pAig->iPatsPi < 64 * p->pAig->nSimWords - 1 );
+    p->pAig->iPatsPi++;
+    Vec_IntForEachEntry( vPat, iLit, i )
+        Cec4_ObjSimSetInputBit( p->pAig, Abc_Lit2Var(iLit), Abc_LitIsCompl(iLit) );
+    if ( p->pSes )
+        Cec4_ManSessionAddPat( p->pSes, p->pNew, vPat );
+    if ( p->pAig->vPats )
+    {
+        Vec_IntPush( p->pAig->vPats, Vec_IntSize(vPat)+2 );
+        Vec_IntAppend( p->pAig->vPats, vPat );
+        Vec_IntPush( p->pAig->vPats, -1 );
+    }
+    //Cec4_ManPackAddPattern( p->pAig, vPat, 0 );
+    //assert( iPatsOld + 1 == p->pAig->iPatsPi );
+    // resimulated once in a while
+    if ( p->pAig->iPatsPi == 64 * p->pAig->nSimWords - 2 )
+    {
+        abctime clk2 = Abc_Clock();
+        Cec4_ManSimulate( p->pAig, p );
+        //printf( "FasterSmall = %d.  FasterBig = %d.\n", p->nFaster[0], p->nFaster[1] );
+        p->nFaster[0] = p->nFaster[1] = 0;
+        //if ( p->nSatSat && p->nSatSat % 100 == 0 )
+            Cec4_ManPrintStats( p->pAig, p->pPars, p, 0 );
+        Vec_IntFill( p->vCexStamps, Gia_ManObjNum(p->pAig), 0 );
+        p->pAig->iPatsPi = 0;
+        Vec_WrdFill( p->pAig->vSimsPi, Vec_WrdSize(p->pAig->vSimsPi), 0 );
+        p->timeResimGlo += Abc_Clock() - clk2;
+    }
+}
 int Cec4_ManSweepNode( Cec4_Man_t * p, int iObj, int iRepr )
 {
     abctime clk = Abc_Clock();
-    int i, IdAig, IdSat, status, fEasy, RetValue = 1;
+    int status, fEasy, RetValue = 1;
     Gia_Obj_t * pObj = Gia_ManObj( p->pAig, iObj );
     Gia_Obj_t * pRepr = Gia_ManObj( p->pAig, iRepr );
     int fCompl = Abc_LitIsCompl(pObj->Value) ^ Abc_LitIsCompl(pRepr->Value) ^ pObj->fPhase ^ pRepr->fPhase;
@@ -1616,36 +1903,10 @@ int Cec4_ManSweepNode( Cec4_Man_t * p, int iObj, int iRepr )
     status = Cec4_ManSolveTwo( p, Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(pObj->Value), fCompl, &fEasy, p->pPars->fVerbose, fEffort );
     if ( status == GLUCOSE_SAT )
     {
-        int iLit;
-        //int iPatsOld = p->pAig->iPatsPi;
         //printf( "Disproved: %d == %d.\n", Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(pObj->Value) );
         p->nSatSat++;
         p->nPatterns++;
-        Vec_IntClear( p->vPat );
-        if ( p->pPars->jType == 0 )
-        {
-            Vec_IntForEachEntryDouble( &p->pNew->vCopiesTwo, IdAig, IdSat, i )
-                Vec_IntPush( p->vPat, Abc_Var2Lit(IdAig, sat_solver_read_cex_varvalue(p->pSat, IdSat)) );
-        }
-        else
-        {
-            int * pCex = sat_solver_read_cex( p->pSat );
-            int * pMap = Vec_IntArray(&p->pNew->vVarMap);
-            for ( i = 0; i < pCex[0]; )
-                Vec_IntPush( p->vPat, Abc_Lit2LitV(pMap, Abc_LitNot(pCex[++i])) );
-        }
-        assert( p->pAig->iPatsPi >= 0 && p->pAig->iPatsPi < 64 * p->pAig->nSimWords - 1 );
-        p->pAig->iPatsPi++;
-        Vec_IntForEachEntry( p->vPat, iLit, i )
-            Cec4_ObjSimSetInputBit( p->pAig, Abc_Lit2Var(iLit), Abc_LitIsCompl(iLit) );
-        if ( p->pAig->vPats )
-        {
-            Vec_IntPush( p->pAig->vPats, Vec_IntSize(p->vPat)+2 );
-            Vec_IntAppend( p->pAig->vPats, p->vPat );
-            Vec_IntPush( p->pAig->vPats, -1 );
-        }
-        //Cec4_ManPackAddPattern( p->pAig, p->vPat, 0 );
-        //assert( iPatsOld + 1 == p->pAig->iPatsPi );
+        Cec4_ManReadCex( p, p->vPat );
         if ( fEasy )
             p->timeSatSat0 += Abc_Clock() - clk;
         else
@@ -1653,20 +1914,7 @@ int Cec4_ManSweepNode( Cec4_Man_t * p, int iObj, int iRepr )
         RetValue = 0;
         // this is not needed, but we keep it here anyway, because it takes very little time
         //Cec4_ManVerify( p->pNew, Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(pObj->Value), fCompl, p->pSat );
-        // resimulated once in a while
-        if ( p->pAig->iPatsPi == 64 * p->pAig->nSimWords - 2 )
-        {
-            abctime clk2 = Abc_Clock();
-            Cec4_ManSimulate( p->pAig, p );
-            //printf( "FasterSmall = %d.  FasterBig = %d.\n", p->nFaster[0], p->nFaster[1] );
-            p->nFaster[0] = p->nFaster[1] = 0;
-            //if ( p->nSatSat && p->nSatSat % 100 == 0 )
-                Cec4_ManPrintStats( p->pAig, p->pPars, p, 0 );
-            Vec_IntFill( p->vCexStamps, Gia_ManObjNum(p->pAig), 0 );
-            p->pAig->iPatsPi = 0;
-            Vec_WrdFill( p->pAig->vSimsPi, Vec_WrdSize(p->pAig->vSimsPi), 0 );
-            p->timeResimGlo += Abc_Clock() - clk2;
-        }
+        Cec4_ManAddCex( p, p->vPat );
     }
     else if ( status == GLUCOSE_UNSAT )
     {
@@ -1695,6 +1943,240 @@ int Cec4_ManSweepNode( Cec4_Man_t * p, int iObj, int iRepr )
     }
     return RetValue;
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Solves candidate pairs in parallel.]
+
+  Description [Candidate pairs are collected in the topological order into
+  a batch, which is split among the threads in a round-robin fashion. 
+  Each thread has its own SAT solver with its own mapping of the nodes 
+  of the shared internal AIG into SAT variables, and reads pNew and pAig 
+  without modifying them. The main thread (the first worker) then records 
+  the proved equivalences and undecided pairs, followed by the counter-examples,
+  which are added to the common simulation info in the order of the pairs.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cec4_Man_t * Cec4_ManStartWorker( Cec4_Man_t * pMain, int iWorker )
+{
+    Cec4_Man_t * p = ABC_CALLOC( Cec4_Man_t, 1 );
+    p->pPars       = pMain->pPars;
+    p->pAig        = pMain->pAig;
+    p->pMain       = pMain;
+    p->iWorker     = iWorker;
+    p->pSat        = sat_solver_start();
+    sat_solver_set_jftr( p->pSat, p->pPars->jType );
+    p->vSatIds     = Vec_IntAlloc( 1000 );
+    p->vSuppVars   = Vec_IntAlloc( 1000 );
+    p->vCopiesTwo  = Vec_IntAlloc( 100 );
+    p->vVarMap     = Vec_IntAlloc( 1000 );
+    p->vPat        = Vec_IntAlloc( 100 );
+    p->vBatchPats  = Vec_IntAlloc( 100 );
+    p->vFails      = pMain->vFails;
+    p->vCoDrivers  = pMain->vCoDrivers;
+    return p;
+}
+void Cec4_ManStopWorker( Cec4_Man_t * p )
+{
+    Cec4_Man_t * pMain = p->pMain;
+    int i;
+    for ( i = 0; i < 2; i++ )
+    {
+        pMain->nConflicts[i][0] += p->nConflicts[i][0];
+        pMain->nConflicts[i][1] += p->nConflicts[i][1];
+        pMain->nConflicts[i][2]  = Abc_MaxInt( pMain->nConflicts[i][2], p->nConflicts[i][2] );
+        pMain->nGates[i]        += p->nGates[i];
+    }
+    pMain->nRecycles     += p->nRecycles;
+    pMain->timeSatSat0   += p->timeSatSat0;
+    pMain->timeSatUnsat0 += p->timeSatUnsat0;
+    pMain->timeSatSat    += p->timeSatSat;
+    pMain->timeSatUnsat  += p->timeSatUnsat;
+    pMain->timeSatUndec  += p->timeSatUndec;
+    pMain->timeSatWorkers+= p->timeSatSat0 + p->timeSatUnsat0 + p->timeSatSat + p->timeSatUnsat + p->timeSatUndec;
+    sat_solver_stop( p->pSat );
+    Vec_IntFree( p->vSatIds );
+    Vec_IntFree( p->vSuppVars );
+    Vec_IntFree( p->vCopiesTwo );
+    Vec_IntFree( p->vVarMap );
+    Vec_IntFree( p->vPat );
+    Vec_IntFree( p->vBatchPats );
+    ABC_FREE( p );
+}
+void Cec4_ManStartWorkers( Cec4_Man_t * p, int nWorkers )
+{
+    // each node of pAig is strashed at most twice (the second time after its batch is solved)
+    int k, nObjsMax = Gia_ManObjNum(p->pNew) + 2 * Gia_ManObjNum(p->pAig);
+    assert( nWorkers > 1 && nWorkers <= ABC_POOL_THR_MAX );
+    Vec_IntFillExtra( p->vSatIds, nObjsMax, -1 );
+    Vec_BitFillExtra( p->vFails, nObjsMax, 0 );
+    if ( p->pSes )
+        Vec_IntFillExtra( p->pSes->vMerged, nObjsMax, -1 );
+    p->pMain      = p;
+    p->nWorkers   = nWorkers;
+    p->pWorkers   = ABC_CALLOC( Cec4_Man_t *, nWorkers );
+    p->pWorkers[0] = p;
+    for ( k = 1; k < nWorkers; k++ )
+        p->pWorkers[k] = Cec4_ManStartWorker( p, k );
+    p->vBatch     = Vec_IntAlloc( 4 * CEC4_BATCH_PAIRS * nWorkers );
+    p->vBatchRes  = Vec_IntAlloc( 2 * CEC4_BATCH_PAIRS * nWorkers );
+    p->vBatchPats = Vec_IntAlloc( 100 );
+    p->vPending   = Vec_BitStart( Gia_ManObjNum(p->pAig) );
+    p->vProvedBy  = Vec_IntStartFull( Gia_ManObjNum(p->pAig) );
+}
+void Cec4_ManStopWorkers( Cec4_Man_t * p )
+{
+    int k;
+    for ( k = 1; k < p->nWorkers; k++ )
+        Cec4_ManStopWorker( p->pWorkers[k] );
+    ABC_FREE( p->pWorkers );
+    p->nWorkers = 0;
+}
+void * Cec4_ManSolveBatchWorker( void * pArg )
+{
+    Cec4_Man_t * p = (Cec4_Man_t *)pArg, * pMain = p->pMain;
+    int k, status, fEasy, nPairs = Vec_IntSize(pMain->vBatch) / 2;
+    for ( k = p->iWorker; k < nPairs; k += pMain->nWorkers )
+    {
+        abctime clk = Abc_Clock();
+        Gia_Obj_t * pObj  = Gia_ManObj( p->pAig, Vec_IntEntry(pMain->vBatch, 2*k) );
+        Gia_Obj_t * pRepr = Gia_ManObj( p->pAig, Vec_IntEntry(pMain->vBatch, 2*k+1) );
+        int fCompl  = Abc_LitIsCompl(pObj->Value) ^ Abc_LitIsCompl(pRepr->Value) ^ pObj->fPhase ^ pRepr->fPhase;
+        int fEffort = p->vCoDrivers ? Vec_BitEntry(p->vCoDrivers, Gia_ObjId(p->pAig, pObj)) || Vec_BitEntry(p->vCoDrivers, Gia_ObjId(p->pAig, pRepr)) : 0;
+        status = Cec4_ManSolveTwo( p, Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(pObj->Value), fCompl, &fEasy, p->pPars->fVerbose, fEffort );
+        Vec_IntWriteEntry( pMain->vBatchRes, k, status );
+        if ( status == GLUCOSE_SAT )
+        {
+            Cec4_ManReadCex( p, p->vPat );
+            Vec_IntPushTwo( p->vBatchPats, k, Vec_IntSize(p->vPat) );
+            Vec_IntAppend( p->vBatchPats, p->vPat );
+            if ( fEasy )
+                p->timeSatSat0 += Abc_Clock() - clk;
+            else
+                p->timeSatSat += Abc_Clock() - clk;
+        }
+        else if ( status == GLUCOSE_UNSAT )
+        {
+            if ( fEasy )
+                p->timeSatUnsat0 += Abc_Clock() - clk;
+            else
+                p->timeSatUnsat += Abc_Clock() - clk;
+        }
+        else
+            p->timeSatUndec += Abc_Clock() - clk;
+    }
+    return NULL;
+}
+void Cec4_ManSolveBatch( Cec4_Man_t * p )
+{
+    Gia_Obj_t * pObj, * pRepr;
+    int pPos[ABC_POOL_THR_MAX] = {0};
+    int k, iLitOld, status, nPairs = Vec_IntSize(p->vBatch) / 2;
+    if ( nPairs == 0 )
+        return;
+    Vec_IntFill( p->vBatchRes, nPairs, GLUCOSE_UNDEC );
+    for ( k = 0; k < p->nWorkers; k++ )
+    {
+        Cec4_Man_t * pWorker = p->pWorkers[k];
+        pWorker->pNew = p->pNew;
+        Vec_IntClear( pWorker->vBatchPats );
+        if ( k > 0 )
+            Vec_IntFillExtra( pWorker->vSatIds, Gia_ManObjNum(p->pNew), -1 );
+    }
+#ifdef ABC_USE_PTHREADS
+    {
+        Abc_Task_t * pTasks[ABC_POOL_THR_MAX];
+        abctime clk;
+        for ( k = 1; k < p->nWorkers; k++ )
+            pTasks[k] = Abc_TaskStart( Abc_PoolGlobal(), Cec4_ManSolveBatchWorker, p->pWorkers[k] );
+        Cec4_ManSolveBatchWorker( p );
+        // the waiting thread is blocked, so the wait is measured in wall time
+        clk = Abc_ClockWall();
+        for ( k = 1; k < p->nWorkers; k++ )
+        {
+            Abc_TaskWait( pTasks[k] );
+            Abc_TaskFree( pTasks[k] );
+        }
+        p->timeSatWait += Abc_ClockWall() - clk;
+    }
+#else
+    for ( k = 1; k < p->nWorkers; k++ )
+        Cec4_ManSolveBatchWorker( p->pWorkers[k] );
+    Cec4_ManSolveBatchWorker( p );
+#endif
+    // record the results before the counter-examples refine the classes
+    for ( k = 0; k < nPairs; k++ )
+    {
+        pObj   = Gia_ManObj( p->pAig, Vec_IntEntry(p->vBatch, 2*k) );
+        pRepr  = Gia_ManObj( p->pAig, Vec_IntEntry(p->vBatch, 2*k+1) );
+        status = Vec_IntEntry( p->vBatchRes, k );
+        Vec_BitWriteEntry( p->vPending, Gia_ObjId(p->pAig, pObj), 0 );
+        if ( status == GLUCOSE_SAT )
+        {
+            p->nSatSat++;
+            p->nPatterns++;
+        }
+        else if ( status == GLUCOSE_UNSAT )
+        {
+            p->nSatUnsat++;
+            iLitOld = pObj->Value;
+            pObj->Value = Abc_LitNotCond( pRepr->Value, pObj->fPhase ^ pRepr->fPhase );
+            Gia_ObjSetProved( p->pAig, Gia_ObjId(p->pAig, pObj) );
+            Vec_IntWriteEntry( p->vProvedBy, Gia_ObjId(p->pAig, pObj), Gia_ObjId(p->pAig, pRepr) );
+            if ( Gia_ObjId(p->pAig, pRepr) == 0 )
+                p->iLastConst = Gia_ObjId(p->pAig, pObj);
+            if ( p->pSes )
+                Cec4_ManSessionMerge( p->pSes, iLitOld, pObj->Value );
+        }
+        else
+        {
+            p->nSatUndec++;
+            Gia_ObjSetFailed( p->pAig, Gia_ObjId(p->pAig, pObj) );
+            Vec_BitWriteEntry( p->vFails, Gia_ObjId(p->pAig, pObj), 1 );
+        }
+    }
+    // add the counter-examples in the order of the pairs
+    for ( k = 0; k < nPairs; k++ )
+    {
+        int * pEntry;
+        if ( Vec_IntEntry(p->vBatchRes, k) != GLUCOSE_SAT )
+            continue;
+        pEntry = Vec_IntEntryP( p->pWorkers[k % p->nWorkers]->vBatchPats, pPos[k % p->nWorkers] );
+        assert( pEntry[0] == k );
+        Vec_IntClear( p->vPat );
+        Vec_IntPushArray( p->vPat, pEntry + 2, pEntry[1] );
+        pPos[k % p->nWorkers] += 2 + pEntry[1];
+        Cec4_ManAddCex( p, p->vPat );
+    }
+    Vec_IntClear( p->vBatch );
+}
+void Cec4_ManRestrash( Cec4_Man_t * p, int iStart, int iStop )
+{
+    // nodes added after the first pair of the batch may have used the fanins before merging
+    Gia_Obj_t * pObj, * pRepr; int i;
+    for ( i = iStart; i <= iStop; i++ )
+    {
+        pObj = Gia_ManObj( p->pAig, i );
+        if ( !Gia_ObjIsAnd(pObj) )
+            continue;
+        if ( Vec_IntEntry(p->vProvedBy, i) >= 0 )
+        {
+            pRepr = Gia_ManObj( p->pAig, Vec_IntEntry(p->vProvedBy, i) );
+            pObj->Value = Abc_LitNotCond( pRepr->Value, pObj->fPhase ^ pRepr->fPhase );
+            continue;
+        }
+        if ( Gia_ObjIsXor(pObj) )
+            pObj->Value = Gia_ManHashXorReal( p->pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+        else
+            pObj->Value = Gia_ManHashAnd( p->pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+        if ( p->pSes )
+            pObj->Value = Cec4_ManSessionRepr( p->pSes, pObj->Value );
+    }
+}
 Gia_Obj_t * Cec4_ManFindRepr( Gia_Man_t * p, Cec4_Man_t * pMan, int iObj )
 {
     abctime clk = Abc_Clock();
@@ -1717,6 +2199,8 @@ Gia_Obj_t * Cec4_ManFindRepr( Gia_Man_t * p, Cec4_Man_t * pMan, int iObj )
             break;
         if ( Gia_ObjProved(p, iMem) || Gia_ObjFailed(p, iMem) )
             continue;
+        if ( pMan->vPending && Vec_BitEntry(pMan->vPending, iMem) )
+            continue;
         Cec4_ManSimulate_rec( p, pMan, iMem );
         if ( Cec4_ObjSimEqual(p, iObj, iMem) )
         {
@@ -1761,6 +2245,8 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
     // simulate one round and create classes
     Cec4_ManSimAlloc( p, pPars->nWords );
     Cec4_ManSimulateCis( p );
+    if ( pMan->pSes )
+        Cec4_ManSessionLoadPats( pMan->pSes, p );
     Cec4_ManSimulate( p, pMan );
     if ( pPars->fCheckMiter && !Cec4_ManSimulateCos(p) ) // cex detected
         goto finalize;
@@ -1798,15 +2284,23 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
     p->iPatsPi = 0;
     Vec_WrdFill( p->vSimsPi, Vec_WrdSize(p->vSimsPi), 0 );
     pMan->nSatSat = 0;
-    pMan->pNew = Cec4_ManStartNew( p );
+    pMan->pNew = pMan->pSes ? Cec4_ManSessionNew( pMan->pSes, p ) : Cec4_ManStartNew( p );
+    pMan->vSatIds    = &pMan->pNew->vCopies2;
+    pMan->vSuppVars  = &pMan->pNew->vSuppVars;
+    pMan->vCopiesTwo = &pMan->pNew->vCopiesTwo;
+    pMan->vVarMap    = &pMan->pNew->vVarMap;
+    if ( pPars->nThreads > 1 )
+        Cec4_ManStartWorkers( pMan, Abc_MinInt(pPars->nThreads, ABC_POOL_THR_MAX) );
     Gia_ManForEachAnd( p, pObj, i )
     {
-        Gia_Obj_t * pObjNew; 
+        Gia_Obj_t * pObjNew; int iLitOld;
         pMan->nAndNodes++;
         if ( Gia_ObjIsXor(pObj) )
             pObj->Value = Gia_ManHashXorReal( pMan->pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
         else
             pObj->Value = Gia_ManHashAnd( pMan->pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+        if ( pMan->pSes ) // use equivalences proved in the previous calls
+            pObj->Value = Cec4_ManSessionLit( pMan->pSes, pObj->Value );
         if ( pPars->nLevelMax && Gia_ObjLevel(p, pObj) > pPars->nLevelMax )
             continue;
         pObjNew = Gia_ManObj( pMan->pNew, Abc_Lit2Var(pObj->Value) );
@@ -1830,12 +2324,41 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
         {
             assert( (pObj->Value ^ pRepr->Value) == (pObj->fPhase ^ pRepr->fPhase) );
             Gia_ObjSetProved( p, i );
+            if ( pMan->vProvedBy )
+                Vec_IntWriteEntry( pMan->vProvedBy, i, Gia_ObjId(p, pRepr) );
             if ( Gia_ObjId(p, pRepr) == 0 )
                 pMan->iLastConst = i;
             continue;
         }
+        if ( pMan->nWorkers > 1 ) // solve in parallel with other pairs
+        {
+            Vec_IntPushTwo( pMan->vBatch, i, Gia_ObjId(p, pRepr) );
+            Vec_BitWriteEntry( pMan->vPending, i, 1 );
+            if ( Vec_IntSize(pMan->vBatch) == 2 * CEC4_BATCH_PAIRS * pMan->nWorkers )
+            {
+                int iFirst = Vec_IntEntry( pMan->vBatch, 0 );
+                Cec4_ManSolveBatch( pMan );
+                Cec4_ManRestrash( pMan, iFirst, i );
+            }
+            continue;
+        }
+        iLitOld = pObj->Value;
         if ( Cec4_ManSweepNode(pMan, i, Gia_ObjId(p, pRepr)) && Gia_ObjProved(p, i) )
+        {
             pObj->Value = Abc_LitNotCond( pRepr->Value, pObj->fPhase ^ pRepr->fPhase );
+            if ( pMan->pSes )
+                Cec4_ManSessionMerge( pMan->pSes, iLitOld, pObj->Value );
+        }
+    }
+    if ( pMan->nWorkers > 1 )
+    {
+        if ( Vec_IntSize(pMan->vBatch) > 0 )
+        {
+            int iFirst = Vec_IntEntry( pMan->vBatch, 0 );
+            Cec4_ManSolveBatch( pMan );
+            Cec4_ManRestrash( pMan, iFirst, Gia_ManObjNum(p) - 1 );
+        }
+        Cec4_ManStopWorkers( pMan );
     }
     if ( p->iPatsPi > 0 )
     {
@@ -1847,7 +2370,13 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
     }
     if ( pPars->fVerbose )
         Cec4_ManPrintStats( p, pPars, pMan, 0 );
-    if ( ppNew )
+    if ( pPars->fVerbose && pMan->pSes )
+        printf( "Session call %d:  AIG = %d nodes (%d new)  Reused = %d  Merged = %d  Saved CEXes = %d\n", 
+            pMan->pSes->nCalls, Gia_ManObjNum(pMan->pNew), Gia_ManObjNum(pMan->pNew) - pMan->pSes->nObjsStart, 
+            pMan->pSes->nReused, Vec_IntCountLarger(pMan->pSes->vMerged, -1), Vec_PtrSize(pMan->pSes->vPats) );
+    if ( ppNew && pMan->pSes )
+        *ppNew = Cec4_ManSessionDerive( pMan->pSes, p );
+    else if ( ppNew )
     {
         Gia_ManForEachCo( p, pObj, i )
             pObj->Value = Gia_ManAppendCo( pMan->pNew, Gia_ObjFanin0Copy(pObj) );
@@ -24,19 +24,9 @@
 #include "sat/cnf/cnf.h"
 #include "sat/bsat/satSolver.h"
 #include "misc/util/utilTruth.h"
+#include "misc/util/utilPool.h"
 //#include "bdd/cudd/cuddInt.h"
 
-#ifdef ABC_USE_PTHREADS
-
-#ifdef _WIN32
-#include "../lib/pthread.h"
-#else
-#include <pthread.h>
-#include <unistd.h>
-#endif
-
-#endif
-
 ABC_NAMESPACE_IMPL_START
 
 
@@ -544,7 +534,6 @@ typedef struct Par_ThData_t_
     Cnf_Dat_t * pCnf;
     int         iThread;
     int         nTimeOut;
-    int         fWorking;
     int         Result;
     int         nVars;
     int         nConfs;
@@ -552,33 +541,20 @@ typedef struct Par_ThData_t_
 void * Cec_GiaSplitWorkerThread( void * pArg )
 {
     Par_ThData_t * pThData = (Par_ThData_t *)pArg;
-    volatile int * pPlace = &pThData->fWorking;
-    while ( 1 )
-    {
-        while ( *pPlace == 0 );
-        assert( pThData->fWorking );
-        if ( pThData->p == NULL )
-        {
-            pthread_exit( NULL );
-            assert( 0 );
-            return NULL;
-        }
-        pThData->Result = Cnf_GiaSolveOne( pThData->p, pThData->pCnf, pThData->nTimeOut, &pThData->nVars, &pThData->nConfs );
-        pThData->fWorking = 0;
-    }
-    assert( 0 );
+    pThData->Result = Cnf_GiaSolveOne( pThData->p, pThData->pCnf, pThData->nTimeOut, &pThData->nVars, &pThData->nConfs );
     return NULL;
 }
 int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent )
 {
     abctime clkTotal = Abc_Clock();
     Par_ThData_t ThData[PAR_THR_MAX];
-    pthread_t WorkerThread[PAR_THR_MAX];
+    Abc_Task_t * pTasks[PAR_THR_MAX];
+    Abc_Pool_t * pPool = Abc_PoolGlobal();
     Vec_Ptr_t * vStack;
     Cnf_Dat_t * pCnf;
     double Progress = 0;
     int i, status, nSatVars, nSatConfs;
-    int nIter = 0, RetValue = -1, fWorkToDo = 1;
+    int nIter = 0, RetValue = -1;
     Abc_CexFreeP( &p->pCexComb );
     if ( fVerbose )
         printf( "Solving CEC problem by cofactoring with the following parameters:\n" );
@@ -587,8 +563,6 @@ int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax,
     fflush( stdout );
     if ( nProcs == 1 )
         return Cec_GiaSplitTest2( p, nProcs, nTimeOut, nIterMax, LookAhead, fVerbose, fVeryVerbose, fSilent );
-    // subtract manager thread
-    nProcs--;
     assert( nProcs >= 1 && nProcs <= PAR_THR_MAX );
     // check the problem
     pCnf = Cec_GiaDeriveGiaRemapped( p );
@@ -612,113 +586,111 @@ int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax,
     // create local copy
     vStack = Vec_PtrAlloc( 1000 );
     Vec_PtrPush( vStack, Gia_ManDup(p) );
-    // start threads
+    // prepare task slots
     for ( i = 0; i < nProcs; i++ )
     {
         ThData[i].p        = NULL;
         ThData[i].pCnf     = NULL;
         ThData[i].iThread  = i;
         ThData[i].nTimeOut = nTimeOut;
-        ThData[i].fWorking = 0;
         ThData[i].Result   = -1;
         ThData[i].nVars    = -1;
         ThData[i].nConfs   = -1;
-        status = pthread_create( WorkerThread + i, NULL,Cec_GiaSplitWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+        pTasks[i]          = NULL;
     }
-    // look at the threads
-    while ( fWorkToDo )
+    // look at the tasks
+    while ( 1 )
     {
-        fWorkToDo = (int)(Vec_PtrSize(vStack) > 0);
-        for ( i = 0; i < nProcs; i++ )
+        // submit new tasks into the free slots
+        for ( i = 0; i < nProcs && Vec_PtrSize(vStack) > 0; i++ )
         {
-            // check if this thread is working
-            if ( ThData[i].fWorking )
-            {
-                fWorkToDo = 1;
+            if ( pTasks[i] != NULL )
                 continue;
+            assert( ThData[i].p == NULL );
+            ThData[i].p = (Gia_Man_t*)Vec_PtrPop( vStack );
+            ThData[i].pCnf = Cec_GiaDeriveGiaRemapped( ThData[i].p );
+            pTasks[i] = Abc_TaskStart( pPool, Cec_GiaSplitWorkerThread, (void *)(ThData + i) );
+        }
+        // wait for a task to finish
+        i = Abc_TaskWaitAny( pTasks, nProcs );
+        if ( i == -1 ) // no tasks and no work left
+        {
+            RetValue = 1;
+            break;
+        }
+        Abc_TaskFree( pTasks[i] );
+        pTasks[i] = NULL;
+        // process the result
+        {
+            Gia_Man_t * pLast = ThData[i].p;
+            int Depth = pLast->vCofVars ? Vec_IntSize(pLast->vCofVars) : 0;
+            if ( pLast->vCofVars == NULL )
+                pLast->vCofVars = Vec_IntAlloc( 100 );
+            if ( fVerbose )
+                Cec_GiaSplitPrint( i+1, Depth, ThData[i].nVars, ThData[i].nConfs, ThData[i].Result, Progress, Abc_Clock() - clkTotal );
+            if ( ThData[i].Result == 0 ) // SAT
+            {
+                p->pCexComb = pLast->pCexComb;  pLast->pCexComb = NULL;
+                RetValue = 0;
+                goto finish;
             }
-            // check if this thread has recently finished
-            if ( ThData[i].p != NULL )
+            if ( ThData[i].Result == -1 ) // UNDEC
             {
-                Gia_Man_t * pLast = ThData[i].p;
-                int Depth = pLast->vCofVars ? Vec_IntSize(pLast->vCofVars) : 0;
-                if ( pLast->vCofVars == NULL )
-                    pLast->vCofVars = Vec_IntAlloc( 100 );
-                if ( fVerbose )
-                    Cec_GiaSplitPrint( i+1, Depth, ThData[i].nVars, ThData[i].nConfs, ThData[i].Result, Progress, Abc_Clock() - clkTotal );
-                if ( ThData[i].Result == 0 ) // SAT
-                {
-                    p->pCexComb = pLast->pCexComb;  pLast->pCexComb = NULL;
-                    RetValue = 0;
-                    goto finish;
-                }
-                if ( ThData[i].Result == -1 ) // UNDEC
+                // determine cofactoring variable
+                int nFanouts, Cost, iVar = Gia_SplitCofVar( pLast, LookAhead, &nFanouts, &Cost );
+                // cofactor
+                Gia_Man_t * pPart = Gia_ManDupCofactorVar( pLast, iVar, 0 );
+                pPart->vCofVars = Vec_IntAlloc( Vec_IntSize(pLast->vCofVars) + 1 );
+                Vec_IntAppend( pPart->vCofVars, pLast->vCofVars );
+                Vec_IntPush( pPart->vCofVars, Abc_Var2Lit(iVar, 1) );
+                Vec_PtrPush( vStack, pPart );
+                // print results
+                if ( fVeryVerbose )
                 {
-                    // determine cofactoring variable
-                    int nFanouts, Cost, iVar = Gia_SplitCofVar( pLast, LookAhead, &nFanouts, &Cost );
-                    // cofactor
-                    Gia_Man_t * pPart = Gia_ManDupCofactorVar( pLast, iVar, 0 );
-                    pPart->vCofVars = Vec_IntAlloc( Vec_IntSize(pLast->vCofVars) + 1 );
-                    Vec_IntAppend( pPart->vCofVars, pLast->vCofVars );
-                    Vec_IntPush( pPart->vCofVars, Abc_Var2Lit(iVar, 1) );
-                    Vec_PtrPush( vStack, pPart );
-                    // print results
-                    if ( fVeryVerbose )
-                    {
-//                        Cec_GiaSplitPrintRefs( pLast );
-                        printf( "Var = %5d. Fanouts = %5d. Cost = %8d.  AndBefore = %6d.  AndAfter = %6d.\n", 
-                            iVar, nFanouts, Cost, Gia_ManAndNum(pLast), Gia_ManAndNum(pPart) );
-//                        Cec_GiaSplitPrintRefs( pPart );
-                    }
-                    // cofactor
-                    pPart = Gia_ManDupCofactorVar( pLast, iVar, 1 );
-                    pPart->vCofVars = Vec_IntAlloc( Vec_IntSize(pLast->vCofVars) + 1 );
-                    Vec_IntAppend( pPart->vCofVars, pLast->vCofVars );
-                    Vec_IntPush( pPart->vCofVars, Abc_Var2Lit(iVar, 1) );
-                    Vec_PtrPush( vStack, pPart );
-                    // keep working
-                    fWorkToDo = 1;
-                    nIter++;
+//                    Cec_GiaSplitPrintRefs( pLast );
+                    printf( "Var = %5d. Fanouts = %5d. Cost = %8d.  AndBefore = %6d.  AndAfter = %6d.\n", 
+                        iVar, nFanouts, Cost, Gia_ManAndNum(pLast), Gia_ManAndNum(pPart) );
+//                    Cec_GiaSplitPrintRefs( pPart );
                 }
-                else
-                    Progress += 1.0 / pow((double)2, (double)Depth);
-                Gia_ManStopP( &ThData[i].p );
-                if ( ThData[i].pCnf == NULL )
-                    continue;
-                Cnf_DataFree( ThData[i].pCnf );
-                ThData[i].pCnf = NULL;
+                // cofactor
+                pPart = Gia_ManDupCofactorVar( pLast, iVar, 1 );
+                pPart->vCofVars = Vec_IntAlloc( Vec_IntSize(pLast->vCofVars) + 1 );
+                Vec_IntAppend( pPart->vCofVars, pLast->vCofVars );
+                Vec_IntPush( pPart->vCofVars, Abc_Var2Lit(iVar, 1) );
+                Vec_PtrPush( vStack, pPart );
+                nIter++;
             }
-            if ( Vec_PtrSize(vStack) == 0 )
-                continue;
-            // start a new thread
-            assert( ThData[i].p == NULL );
-            ThData[i].p = (Gia_Man_t*)Vec_PtrPop( vStack );
-            ThData[i].pCnf = Cec_GiaDeriveGiaRemapped( ThData[i].p );
-            ThData[i].fWorking = 1;
+            else
+                Progress += 1.0 / pow((double)2, (double)Depth);
+            Gia_ManStopP( &ThData[i].p );
+            if ( ThData[i].pCnf )
+                Cnf_DataFree( ThData[i].pCnf );
+            ThData[i].pCnf = NULL;
         }
         if ( nIterMax && nIter >= nIterMax )
             break;
     }
-    if ( !fWorkToDo )
-        RetValue = 1;
 finish:
-    // wait till threads finish
+    // cancel the tasks that did not start and wait till the running ones finish
     for ( i = 0; i < nProcs; i++ )
-        if ( ThData[i].fWorking )
-            i = 0;
-    // stop threads
+        if ( pTasks[i] != NULL )
+            Abc_TaskCancel( pTasks[i] );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        if ( pTasks[i] == NULL )
+            continue;
+        Abc_TaskWait( pTasks[i] );
+        Abc_TaskFree( pTasks[i] );
+        pTasks[i] = NULL;
+    }
+    // cleanup
     for ( i = 0; i < nProcs; i++ )
     {
-        assert( !ThData[i].fWorking );
-        // cleanup
         Gia_ManStopP( &ThData[i].p );
         if ( ThData[i].pCnf == NULL )
             continue;
         Cnf_DataFree( ThData[i].pCnf );
         ThData[i].pCnf = NULL;
-        // stop
-        ThData[i].p = NULL;
-        ThData[i].fWorking = 1;
     }
     // finish
     Cec_GiaSplitClean( vStack );
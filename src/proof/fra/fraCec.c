@@ -44,7 +44,7 @@ ABC_NAMESPACE_IMPL_START
   SeeAlso     []
 
 ***********************************************************************/
-int Fra_FraigSat( Aig_Man_t * pMan, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, int nLearnedStart, int nLearnedDelta, int nLearnedPerce, int fFlipBits, int fAndOuts, int fNewSolver, int fVerbose )
+int Fra_FraigSatInt( Aig_Man_t * pMan, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, int nLearnedStart, int nLearnedDelta, int nLearnedPerce, int fFlipBits, int fAndOuts, int fNewSolver, int fPreproc, int fVerbose )
 {
     if ( fNewSolver )
     {
@@ -73,6 +73,10 @@ int Fra_FraigSat( Aig_Man_t * pMan, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimi
             Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
         }
 
+        // simplify the CNF while keeping the variables of inputs and outputs
+        if ( fPreproc )
+            Cnf_DataPreprocess( pCnf, NULL, fVerbose );
+
         // convert into SAT solver
         pSat = (sat_solver2 *)Cnf_DataWriteIntoSolver2( pCnf, 1, 0 );
         if ( pSat == NULL )
@@ -185,6 +189,10 @@ int Fra_FraigSat( Aig_Man_t * pMan, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimi
             Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
         }
 
+        // simplify the CNF while keeping the variables of inputs and outputs
+        if ( fPreproc )
+            Cnf_DataPreprocess( pCnf, NULL, fVerbose );
+
         // convert into SAT solver
         pSat = (sat_solver *)Cnf_DataWriteIntoSolver( pCnf, 1, 0 );
         if ( pSat == NULL )
@@ -284,6 +292,22 @@ int Fra_FraigSat( Aig_Man_t * pMan, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimi
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Solves the miter without preprocessing the CNF.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Fra_FraigSat( Aig_Man_t * pMan, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, int nLearnedStart, int nLearnedDelta, int nLearnedPerce, int fFlipBits, int fAndOuts, int fNewSolver, int fVerbose )
+{
+    return Fra_FraigSatInt( pMan, nConfLimit, nInsLimit, nLearnedStart, nLearnedDelta, nLearnedPerce, fFlipBits, fAndOuts, fNewSolver, 0, fVerbose );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Recognizes what nodes are inputs of the EXOR.]
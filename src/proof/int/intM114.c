@@ -223,6 +223,8 @@ int Inter_ManPerformOneStep( Inter_Man_t * p, int fUseBias, int fUseBackward, ab
     // set runtime limit
     if ( nTimeNewOut )
         sat_solver_set_runtime_limit( pSat, nTimeNewOut );
+    sat_solver_set_runid( pSat, p->RunId );
+    sat_solver_set_stop_func( pSat, p->pFuncStop );
 
     // collect global variables
     pGlobalVars = ABC_CALLOC( int, sat_solver_nvars(pSat) );
@@ -50,6 +50,8 @@ struct Pdr_Par_t_
     int nTimeOutGap;      // approximate timeout in seconds since the last change
     int nTimeOutOne;      // approximate timeout in seconds per one output
     int nRandomSeed;      // value to seed the SAT solver with
+    int nThreads;         // the number of threads (the master and the helpers)
+    int nTerWords;        // the number of words in bit-parallel ternary simulation (0 = scalar)
     int fTwoRounds;       // use two rounds for generalization
     int fMonoCnf;         // monolythic CNF
     int fNewXSim;         // updated X-valued simulation
@@ -81,6 +83,8 @@ struct Pdr_Par_t_
     int RunId;            // PDR id in this run 
     int(*pFuncStop)(int); // callback to terminate
     int(*pFuncOnFail)(int,Abc_Cex_t*); // called for a failed output in MO mode
+    void * pMbox;         // mailbox shared with other engines (Abc_Mbox_t)
+    int MboxId;           // the ID of this engine in the mailbox
     abctime timeLastSolved; // the time when the last output was solved
     Vec_Int_t * vOutMap;  // in the multi-output mode, contains status for each PO (0 = sat; 1 = unsat; negative = undecided)
     char * pInvFileName;  // invariable file name
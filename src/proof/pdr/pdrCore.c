@@ -21,6 +21,8 @@
 #include "pdrInt.h"
 #include "base/main/main.h"
 #include "misc/hash/hash.h"
+#include "misc/util/utilMbox.h"
+#include "misc/util/utilPool.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -59,6 +61,8 @@ void Pdr_ManSetDefaultParams( Pdr_Par_t * pPars )
     pPars->nConfGenLimit  =       0;  // limit on SAT solver conflicts during generalization
     pPars->nRestLimit     =       0;  // limit on the number of proof-obligations
     pPars->nRandomSeed   = 91648253;  // value to seed the SAT solver with
+    pPars->nThreads       =       1;  // the number of threads
+    pPars->nTerWords      =       4;  // the number of words in bit-parallel ternary simulation
     pPars->fTwoRounds     =       0;  // use two rounds for generalization
     pPars->fMonoCnf       =       0;  // monolythic CNF
     pPars->fNewXSim       =       0;  // updated X-valued simulation
@@ -194,6 +198,7 @@ int Pdr_ManPushClauses( Pdr_Man_t * p )
 
             // if it can be moved, add it to the next frame
             Pdr_ManSolverAddClause( p, k+1, pCubeK );
+            Pdr_ManParLog( p, k+1, pCubeK, 1 );
             // check if the clause subsumes others
             Vec_PtrForEachEntry( Pdr_Set_t *, vArrayK1, pCubeK1, i )
             {
@@ -303,6 +308,37 @@ int * Pdr_ManSortByPriority( Pdr_Man_t * p, Pdr_Set_t * pCube )
     return pArray;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Shares the results with other engines.]
+
+  Description [The clause blocking the cube holds in all states reachable
+  in k or fewer steps. The clause is posted as flop literals. When a new
+  frame is opened, the frames before it have no counter-examples.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManPostLemma( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )
+{
+    int i;
+    if ( p->pPars->pMbox == NULL )
+        return;
+    Vec_IntClear( p->vMbox );
+    for ( i = 0; i < pCube->nLits; i++ )
+        if ( pCube->Lits[i] != -1 )
+            Vec_IntPush( p->vMbox, Abc_LitNot(pCube->Lits[i]) );
+    Abc_MboxPost( (Abc_Mbox_t *)p->pPars->pMbox, ABC_MBOX_LEMMA, p->pPars->MboxId, k, Vec_IntArray(p->vMbox), Vec_IntSize(p->vMbox) );
+}
+void Pdr_ManPostDepth( Pdr_Man_t * p, int iFrame )
+{
+    if ( p->pPars->pMbox == NULL || p->pPars->fSolveAll )
+        return;
+    Abc_MboxPost( (Abc_Mbox_t *)p->pPars->pMbox, ABC_MBOX_DEPTH, p->pPars->MboxId, iFrame - 1, NULL, 0 );
+}
+
 
 /**Function*************************************************************
 
@@ -433,6 +469,8 @@ int ZPdr_ManDown( Pdr_Man_t * p, int k, Pdr_Set_t ** ppCube, Pdr_Set_t * pPred,
             // add clause
             for ( i = 1; i <= l; i++ )
                 Pdr_ManSolverAddClause( p, i, pCubeMin );
+            Pdr_ManPostLemma( p, l, pCubeMin );
+            Pdr_ManParLog( p, l, pCubeMin, 0 );
             Pdr_SetDeref( pPred );
             RetValue = Pdr_ManCheckCube( p, k, *ppCube, &pPred, p->pPars->nConfLimit, 0, 1 );
             assert( RetValue >= 0 );
@@ -697,7 +735,7 @@ int Pdr_ManGeneralize( Pdr_Man_t * p, int k, Pdr_Set_t * pCube, Pdr_Set_t ** ppP
         return -1;
     if ( RetValue == 0 )
     {
-        p->tGeneral += clock() - clk;
+        p->tGeneral += Abc_Clock() - clk;
         return 0;
     }
 
@@ -919,6 +957,8 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
             return 1; // restart
         }
         pThis = Pdr_QueuePop( p );
+        // merge the lemmas derived by the helpers
+        Pdr_ManParCollect( p, 0 );
         assert( pThis->iFrame > 0 );
         assert( !Pdr_SetIsInit(pThis->pState, -1) );
         p->iUseFrame = Abc_MinInt( p->iUseFrame, pThis->iFrame );
@@ -944,6 +984,8 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
             continue;
         }
 
+        // let the idle helpers work on other obligations or on this one
+        Pdr_ManParDispatch( p, pThis );
         // check if the cube holds with relative induction
         pCubeMin = NULL;
         RetValue = Pdr_ManGeneralize( p, pThis->iFrame-1, pThis->pState, &pPred, &pCubeMin );
@@ -991,6 +1033,8 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
             // add clause
             for ( i = 1; i <= k; i++ )
                 Pdr_ManSolverAddClause( p, i, pCubeMin );
+            Pdr_ManPostLemma( p, k, pCubeMin );
+            Pdr_ManParLog( p, k, pCubeMin, 0 );
             // schedule proof obligation
             if ( (k < kMax || p->pPars->fReuseProofOblig) && !p->pPars->fShortest )
             {
@@ -1150,9 +1194,15 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
                     if ( p->pPars->fVerbose )
                         Pdr_ManPrintProgress( p, 1, Abc_Clock() - clkStart );
                     if ( p->timeToStop && Abc_Clock() > p->timeToStop )
-                        Abc_Print( 1, "Reached timeout (%d seconds) in frame %d.\n",  p->pPars->nTimeOut, iFrame );
+                    {
+                        if ( !p->pPars->fSilent )
+                            Abc_Print( 1, "Reached timeout (%d seconds) in frame %d.\n",  p->pPars->nTimeOut, iFrame );
+                    }
                     else if ( p->pPars->nTimeOutGap && p->pPars->timeLastSolved && Abc_Clock() > p->pPars->timeLastSolved + p->pPars->nTimeOutGap * CLOCKS_PER_SEC )
-                        Abc_Print( 1, "Reached gap timeout (%d seconds) in frame %d.\n",  p->pPars->nTimeOutGap, iFrame );
+                    {
+                        if ( !p->pPars->fSilent )
+                            Abc_Print( 1, "Reached gap timeout (%d seconds) in frame %d.\n",  p->pPars->nTimeOutGap, iFrame );
+                    }
                     else if ( p->timeToStopOne && Abc_Clock() > p->timeToStopOne )
                     {
                         Pdr_QueueClean( p );
@@ -1174,9 +1224,15 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
                         if ( p->pPars->fVerbose )
                             Pdr_ManPrintProgress( p, 1, Abc_Clock() - clkStart );
                         if ( p->timeToStop && Abc_Clock() > p->timeToStop )
-                            Abc_Print( 1, "Reached timeout (%d seconds) in frame %d.\n",  p->pPars->nTimeOut, iFrame );
+                        {
+                            if ( !p->pPars->fSilent )
+                                Abc_Print( 1, "Reached timeout (%d seconds) in frame %d.\n",  p->pPars->nTimeOut, iFrame );
+                        }
                         else if ( p->pPars->nTimeOutGap && p->pPars->timeLastSolved && Abc_Clock() > p->pPars->timeLastSolved + p->pPars->nTimeOutGap * CLOCKS_PER_SEC )
-                            Abc_Print( 1, "Reached gap timeout (%d seconds) in frame %d.\n",  p->pPars->nTimeOutGap, iFrame );
+                        {
+                            if ( !p->pPars->fSilent )
+                                Abc_Print( 1, "Reached gap timeout (%d seconds) in frame %d.\n",  p->pPars->nTimeOutGap, iFrame );
+                        }
                         else if ( p->timeToStopOne && Abc_Clock() > p->timeToStopOne )
                         {
                             Pdr_QueueClean( p );
@@ -1281,12 +1337,14 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
         assert( pCube == NULL );
         Pdr_ManSetPropertyOutput( p, iFrame );
         Pdr_ManCreateSolver( p, ++iFrame );
+        Pdr_ManPostDepth( p, iFrame );
         if ( fPrintClauses )
         {
             Abc_Print( 1, "*** Clauses after frame %d:\n", iFrame );
             Pdr_ManPrintClauses( p, 0 );
         }
         // push clauses into this timeframe
+        Pdr_ManParCollect( p, 1 );
         RetValue = Pdr_ManPushClauses( p );
         if ( RetValue == -1 )
         {
@@ -1414,7 +1472,10 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
     }
     ABC_FREE( pAig->pSeqModel );
     p = Pdr_ManStart( pAig, pPars, NULL );
+    if ( pPars->nThreads > 1 && !pPars->fSolveAll && !pPars->fUseAbs )
+        Pdr_ManParStart( p, Abc_MinInt(pPars->nThreads, ABC_POOL_THR_MAX) - 1 );
     RetValue = Pdr_ManSolveInt( p );
+    Pdr_ManParStop( p );
     if ( RetValue == 0 )
         assert( pAig->pSeqModel != NULL || p->vCexes != NULL );
     if ( p->vCexes )
@@ -1430,7 +1491,7 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
         Pdr_ManDumpClauses( p, pFileName, RetValue==1 );
         printf( "Dumped inductive invariant in file \"%s\".\n", pFileName );
     }
-    else if ( RetValue == 1 )
+    else if ( RetValue == 1 && Abc_TaskCurrent() == NULL ) // the global frame is not updated by worker threads
         Abc_FrameSetInv( Pdr_ManDeriveInfinityClauses( p, RetValue!=1 ) );
     p->tTotal += Abc_Clock() - clk;
     Pdr_ManStop( p );
@@ -126,6 +126,7 @@ struct Pdr_Man_t_
     int         nCexesTotal;
     // terminary simulation
     Txs3_Man_t * pTxs3;      
+    Vec_Wrd_t * vTerSims;  // bit-parallel ternary simulation info
     // internal use
     Vec_Int_t * vPrio;     // priority flops
     Vec_Int_t * vLits;     // array of literals
@@ -138,8 +139,14 @@ struct Pdr_Man_t_
     Vec_Int_t * vVisits;   // intermediate
     Vec_Int_t * vCi2Rem;   // CIs to be removed
     Vec_Int_t * vRes;      // final result
+    Vec_Int_t * vMbox;     // clause posted to the mailbox
     abctime *   pTime4Outs;// timeout per output
     Vec_Ptr_t * vInfCubes; // infinity clauses/cubes
+    // helper threads
+    void *      pPool;     // thread pool of the helpers (Abc_Pool_t)
+    Vec_Ptr_t * vHelpers;  // helpers generalizing proof obligations
+    Vec_Ptr_t * vLog;      // lemmas not yet passed to some helpers
+    Vec_Int_t * vLogLevels;// their levels
     // statistics
     int         nBlocks;   // the number of times blockState was called
     int         nObligs;   // the number of proof obligations derived
@@ -158,6 +165,9 @@ struct Pdr_Man_t_
     int         nQueLim;
     int         nXsimRuns;
     int         nXsimLits;
+    word        nTerEvals; // the number of node evaluations in bit-parallel ternary simulation
+    int         nParJobs;  // the number of jobs given to helpers
+    int         nParLemmas;// the number of lemmas merged from helpers
     // runtime
     abctime     timeToStop;
     abctime     timeToStopOne;
@@ -216,6 +226,12 @@ extern Pdr_Man_t *     Pdr_ManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_In
 extern void            Pdr_ManStop( Pdr_Man_t * p );
 extern Abc_Cex_t *     Pdr_ManDeriveCex( Pdr_Man_t * p );
 extern Abc_Cex_t *     Pdr_ManDeriveCexAbs( Pdr_Man_t * p );
+/*=== pdrPar.c ==========================================================*/
+extern void            Pdr_ManParStart( Pdr_Man_t * p, int nHelpers );
+extern void            Pdr_ManParStop( Pdr_Man_t * p );
+extern void            Pdr_ManParLog( Pdr_Man_t * p, int k, Pdr_Set_t * pCube, int fPush );
+extern void            Pdr_ManParCollect( Pdr_Man_t * p, int fWait );
+extern void            Pdr_ManParDispatch( Pdr_Man_t * p, Pdr_Obl_t * pCur );
 /*=== pdrSat.c ==========================================================*/
 extern sat_solver *    Pdr_ManCreateSolver( Pdr_Man_t * p, int k );
 extern sat_solver *    Pdr_ManFetchSolver( Pdr_Man_t * p, int k );
@@ -227,6 +243,7 @@ extern void            Pdr_ManCollectValues( Pdr_Man_t * p, int k, Vec_Int_t * v
 extern int             Pdr_ManCheckCubeCs( Pdr_Man_t * p, int k, Pdr_Set_t * pCube );
 extern int             Pdr_ManCheckCube( Pdr_Man_t * p, int k, Pdr_Set_t * pCube, Pdr_Set_t ** ppPred, int nConfLimit, int fTryConf, int fUseLit );
 /*=== pdrTsim.c ==========================================================*/
+extern int             Pdr_ManSimDataInit( Aig_Man_t * pAig, Vec_Int_t * vCiObjs, Vec_Int_t * vCiVals, Vec_Int_t * vNodes, Vec_Int_t * vCoObjs, Vec_Int_t * vCoVals, Vec_Int_t * vCi2Rem );
 extern Pdr_Set_t *     Pdr_ManTernarySim( Pdr_Man_t * p, int k, Pdr_Set_t * pCube );
 /*=== pdrTsim2.c ==========================================================*/
 extern Txs_Man_t *     Txs_ManStart( Pdr_Man_t * pMan, Aig_Man_t * pAig, Vec_Int_t * vPrio );
@@ -236,6 +253,9 @@ extern Pdr_Set_t *     Txs_ManTernarySim( Txs_Man_t * p, int k, Pdr_Set_t * pCub
 extern Txs3_Man_t *    Txs3_ManStart( Pdr_Man_t * pMan, Aig_Man_t * pAig, Vec_Int_t * vPrio );
 extern void            Txs3_ManStop( Txs3_Man_t * );
 extern Pdr_Set_t *     Txs3_ManTernarySim( Txs3_Man_t * p, int k, Pdr_Set_t * pCube );
+/*=== pdrTsim4.c ==========================================================*/
+extern void            Pdr_ManTswSimulate( Aig_Man_t * pAig, Vec_Wrd_t * vSims, int nWords, int nWordsUse, Vec_Int_t * vNodes, Vec_Int_t * vCoObjs );
+extern word            Pdr_ManTswExtend( Aig_Man_t * pAig, Vec_Wrd_t * vSims, int nWords, Vec_Int_t * vCiObjs, Vec_Int_t * vCiVals, Vec_Int_t * vNodes, Vec_Int_t * vCoObjs, Vec_Int_t * vCoVals, Vec_Int_t * vCands, Vec_Int_t * vLive, Vec_Int_t * vCi2Rem );
 /*=== pdrUtil.c ==========================================================*/
 extern Pdr_Set_t *     Pdr_SetAlloc( int nSize );
 extern Pdr_Set_t *     Pdr_SetCreate( Vec_Int_t * vLits, Vec_Int_t * vPiLits );
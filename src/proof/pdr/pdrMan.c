@@ -279,9 +279,11 @@ Pdr_Man_t * Pdr_ManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_Int_t * vPrio
     p->vVisits  = Vec_IntAlloc( 100 );  // intermediate
     p->vCi2Rem  = Vec_IntAlloc( 100 );  // CIs to be removed
     p->vRes     = Vec_IntAlloc( 100 );  // final result
+    p->vMbox    = Vec_IntAlloc( 100 );  // clause posted to the mailbox
     p->pCnfMan  = Cnf_ManStart();
     // ternary simulation
     p->pTxs3    = pPars->fNewXSim ? Txs3_ManStart( p, pAig, p->vPrio ) : NULL;
+    p->vTerSims = pPars->nTerWords > 0 ? Vec_WrdStart( 2 * pPars->nTerWords * Aig_ManObjNumMax(pAig) ) : NULL;
     // additional AIG data-members
     if ( pAig->pFanData == NULL )
         Aig_ManFanoutStart( pAig );
@@ -320,18 +322,24 @@ void Pdr_ManStop( Pdr_Man_t * p )
     Pdr_Set_t * pCla;
     sat_solver * pSat;
     int i, k;
+    Pdr_ManParStop( p );
     Gia_ManStopP( &p->pGia );
     Aig_ManCleanMarkAB( p->pAig );
     if ( p->pPars->fVerbose ) 
     {
         Abc_Print( 1, "Block =%5d  Oblig =%6d  Clause =%6d  Call =%6d (sat=%.1f%%)  Cex =%4d  Start =%4d\n", 
             p->nBlocks, p->nObligs, p->nCubes, p->nCalls, 100.0 * p->nCallsS / p->nCalls, p->nCexesTotal, p->nStarts );
+        if ( p->nParJobs )
+            Abc_Print( 1, "Helpers =%3d  Jobs =%6d  Merged lemmas =%6d\n", p->pPars->nThreads - 1, p->nParJobs, p->nParLemmas );
         ABC_PRTP( "SAT solving", p->tSat,       p->tTotal );
         ABC_PRTP( "  unsat    ", p->tSatUnsat,  p->tTotal );
         ABC_PRTP( "  sat      ", p->tSatSat,    p->tTotal );
         ABC_PRTP( "Generalize ", p->tGeneral,   p->tTotal );
         ABC_PRTP( "Push clause", p->tPush,      p->tTotal );
         ABC_PRTP( "Ternary sim", p->tTsim,      p->tTotal );
+        if ( p->nTerEvals )
+            Abc_Print( 1, "Ternary sim: %d words per node. %.2f M node evaluations/sec.\n", p->pPars->nTerWords, 
+                1.0 * p->nTerEvals / 1000000 / Abc_MaxDouble(1.0 * p->tTsim / CLOCKS_PER_SEC, 0.000001) );
         ABC_PRTP( "Containment", p->tContain,   p->tTotal );
         ABC_PRTP( "CNF compute", p->tCnf,       p->tTotal );
         ABC_PRTP( "Refinement ", p->tAbs,       p->tTotal );
@@ -370,6 +378,7 @@ void Pdr_ManStop( Pdr_Man_t * p )
     // terminary simulation
     if ( p->pPars->fNewXSim )
         Txs3_ManStop( p->pTxs3 );
+    Vec_WrdFreeP( &p->vTerSims );
     // internal use
     Vec_IntFreeP( &p->vPrio   );  // priority flops
     Vec_IntFree( p->vLits     );  // array of literals
@@ -382,6 +391,7 @@ void Pdr_ManStop( Pdr_Man_t * p )
     Vec_IntFree( p->vVisits   );  // intermediate
     Vec_IntFree( p->vCi2Rem   );  // CIs to be removed
     Vec_IntFree( p->vRes      );  // final result
+    Vec_IntFree( p->vMbox     );  // clause posted to the mailbox
     Vec_PtrFreeP( &p->vInfCubes );
     ABC_FREE( p->pTime4Outs );
     if ( p->vCexes )
@@ -0,0 +1,443 @@
+/**CFile****************************************************************
+
+  FileName    [pdrPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Property driven reachability.]
+
+  Synopsis    [Helper threads generalizing proof obligations.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - November 20, 2010.]
+
+  Revision    [$Id: pdrPar.c,v 1.00 2010/11/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "pdrInt.h"
+#include "misc/util/utilPool.h"
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The master thread runs the usual PDR loop. Each helper owns a private
+// copy of the AIG and a PDR manager whose frames lag behind the master:
+// before a job starts, the lemmas learned by the master since the previous
+// job of this helper are replayed into the helper's frames. The helper then
+// generalizes one obligation, either another one waiting in the master's
+// queue or the one the master is working on, in which case the helper uses
+// a different order of literals. The lemma is returned to the master, which
+// merges it before the next obligation is popped. Each clause in the frames
+// of the helper is also valid in the same frame of the master, so a lemma
+// that is relatively inductive for the helper is also valid for the master.
+
+#define PDR_PAR_CONF_LIMIT  10000   // the default conflict limit of a helper
+#define PDR_PAR_SCAN_LIMIT     16   // the number of queue entries to scan
+
+typedef struct Pdr_Hlp_t_ Pdr_Hlp_t;
+struct Pdr_Hlp_t_
+{
+    Pdr_Man_t *  pMan;       // the helper's manager
+    Pdr_Par_t    Pars;       // the helper's parameters
+    Abc_Task_t * pTask;      // the running job
+    int          iLog;       // the first log entry not seen by the helper
+    unsigned     Seed;       // the random seed
+    // job inputs
+    int          nFrames;    // the number of frames of the master
+    Vec_Ptr_t *  vSync;      // new lemmas (owned copies)
+    Vec_Int_t *  vSyncLevels;// levels of the new lemmas
+    Pdr_Set_t *  pOrig;      // the obligation state in the master (ref'd)
+    Pdr_Set_t *  pCube;      // the copy of the obligation state
+    int          iFrame;     // the obligation frame
+    abctime      nTimeLeft;  // the runtime left
+    // job outputs
+    Pdr_Set_t *  pCubeMin;   // the lemma or NULL
+    int          kLemma;     // the last frame where the lemma holds
+};
+
+extern int  Pdr_ManGeneralize( Pdr_Man_t * p, int k, Pdr_Set_t * pCube, Pdr_Set_t ** ppPred, Pdr_Set_t ** ppCubeMin );
+extern void Pdr_ManPostLemma( Pdr_Man_t * p, int k, Pdr_Set_t * pCube );
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Pseudo-random number generator of the helper.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline unsigned Pdr_HlpRandom( Pdr_Hlp_t * pHlp )
+{
+    pHlp->Seed = pHlp->Seed * 1103515245 + 12345;
+    return pHlp->Seed >> 16;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts helpers.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManParStart( Pdr_Man_t * p, int nHelpers )
+{
+    Pdr_Hlp_t * pHlp;
+    int i;
+    assert( p->vHelpers == NULL && nHelpers > 0 );
+    p->pPool      = Abc_PoolStart( nHelpers );
+    p->vHelpers   = Vec_PtrAlloc( nHelpers );
+    p->vLog       = Vec_PtrAlloc( 1000 );
+    p->vLogLevels = Vec_IntAlloc( 1000 );
+    for ( i = 0; i < nHelpers; i++ )
+    {
+        pHlp = ABC_CALLOC( Pdr_Hlp_t, 1 );
+        pHlp->Pars = *p->pPars;
+        pHlp->Pars.nThreads     = 1;
+        pHlp->Pars.fVerbose     = 0;
+        pHlp->Pars.fVeryVerbose = 0;
+        pHlp->Pars.fNotVerbose  = 1;
+        pHlp->Pars.fSilent      = 1;
+        pHlp->Pars.fSolveAll    = 0;
+        pHlp->Pars.fStoreCex    = 0;
+        pHlp->Pars.fDumpInv     = 0;
+        pHlp->Pars.fUseBridge   = 0;
+        pHlp->Pars.nTimeOut     = 0;
+        pHlp->Pars.nTimeOutGap  = 0;
+        pHlp->Pars.nTimeOutOne  = 0;
+        pHlp->Pars.pFuncStop    = NULL;
+        pHlp->Pars.pFuncOnFail  = NULL;
+        pHlp->Pars.pMbox        = NULL;
+        pHlp->Pars.vOutMap      = NULL;
+        pHlp->Pars.nRandomSeed += i + 1;
+        if ( pHlp->Pars.nConfLimit == 0 )
+            pHlp->Pars.nConfLimit = PDR_PAR_CONF_LIMIT;
+        pHlp->pMan        = Pdr_ManStart( Aig_ManDupSimple(p->pAig), &pHlp->Pars, NULL );
+        pHlp->pMan->iUseFrame = 1;
+        pHlp->vSync       = Vec_PtrAlloc( 100 );
+        pHlp->vSyncLevels = Vec_IntAlloc( 100 );
+        pHlp->Seed        = i;
+        Vec_PtrPush( p->vHelpers, pHlp );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records a lemma added to the master's frames.]
+
+  Description [If fPush is 1, the lemma was pushed into frame k and is
+  only added to this frame. Otherwise, it is added to frames 1..k.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManParLog( Pdr_Man_t * p, int k, Pdr_Set_t * pCube, int fPush )
+{
+    if ( p->vHelpers == NULL )
+        return;
+    Vec_PtrPush( p->vLog, Pdr_SetRef(pCube) );
+    Vec_IntPush( p->vLogLevels, Abc_Var2Lit(k, fPush) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one job of the helper.]
+
+  Description [Runs in the helper's thread and only touches the helper.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Pdr_ManParWorker( void * pArg )
+{
+    Pdr_Hlp_t * pHlp = (Pdr_Hlp_t *)pArg;
+    Pdr_Man_t * p = pHlp->pMan;
+    Pdr_Set_t * pCube, * pPred = NULL, * pCubeMin = NULL;
+    int i, k, Level, RetValue;
+    p->timeToStop = pHlp->nTimeLeft ? Abc_Clock() + pHlp->nTimeLeft : 0;
+    // extend the frames
+    if ( Vec_PtrSize(p->vSolvers) == 0 )
+        Pdr_ManCreateSolver( p, 0 );
+    while ( Vec_PtrSize(p->vSolvers) < pHlp->nFrames )
+    {
+        Pdr_ManSetPropertyOutput( p, Vec_PtrSize(p->vSolvers)-1 );
+        Pdr_ManCreateSolver( p, Vec_PtrSize(p->vSolvers) );
+    }
+    // replay the lemmas of the master
+    Vec_PtrForEachEntry( Pdr_Set_t *, pHlp->vSync, pCube, i )
+    {
+        Level = Vec_IntEntry( pHlp->vSyncLevels, i );
+        Vec_VecPush( p->vClauses, Abc_Lit2Var(Level), pCube ); // consume ref
+        for ( k = Abc_LitIsCompl(Level) ? Abc_Lit2Var(Level) : 1; k <= Abc_Lit2Var(Level); k++ )
+            Pdr_ManSolverAddClause( p, k, pCube );
+    }
+    Vec_PtrClear( pHlp->vSync );
+    Vec_IntClear( pHlp->vSyncLevels );
+    // block the obligation
+    p->nBlocks++;
+    RetValue = Pdr_ManGeneralize( p, pHlp->iFrame-1, pHlp->pCube, &pPred, &pCubeMin );
+    if ( RetValue == 1 )
+    {
+        // push the lemma as far as possible
+        for ( k = pHlp->iFrame; k < pHlp->nFrames-1; k++ )
+            if ( Pdr_ManCheckCube( p, k, pCubeMin, NULL, p->pPars->nConfLimit, 0, 1 ) != 1 )
+                break;
+        pHlp->pCubeMin = pCubeMin;
+        pHlp->kLemma   = k;
+        p->nCubes++;
+    }
+    else if ( RetValue == 0 )
+        Pdr_SetDeref( pPred );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the lemma derived by a helper to the master's frames.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Pdr_ManParAddLemma( Pdr_Man_t * p, int k, Pdr_Set_t * pCubeMin )
+{
+    int i;
+    if ( p->pPars->fVeryVerbose )
+    {
+        Abc_Print( 1, "Adding cube " );
+        Pdr_SetPrint( stdout, pCubeMin, Aig_ManRegNum(p->pAig), NULL );
+        Abc_Print( 1, " to frame %d (helper).\n", k );
+    }
+    for ( i = 0; i < pCubeMin->nLits; i++ )
+    {
+        assert( pCubeMin->Lits[i] >= 0 );
+        assert( (pCubeMin->Lits[i] / 2) < Aig_ManRegNum(p->pAig) );
+        if ( (Vec_IntEntry(p->vPrio, pCubeMin->Lits[i] / 2) >> p->nPrioShift) == 0 )
+            p->nAbsFlops++;
+        Vec_IntAddToEntry( p->vPrio, pCubeMin->Lits[i] / 2, 1 << p->nPrioShift );
+    }
+    Vec_VecPush( p->vClauses, k, pCubeMin );   // consume ref
+    p->nCubes++;
+    p->nParLemmas++;
+    for ( i = 1; i <= k; i++ )
+        Pdr_ManSolverAddClause( p, i, pCubeMin );
+    Pdr_ManPostLemma( p, k, pCubeMin );
+    Pdr_ManParLog( p, k, pCubeMin, 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finishes the job of the helper.]
+
+  Description [If fMerge is 1, adds the lemma to the master's frames
+  unless it is already subsumed there.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Pdr_ManParFinish( Pdr_Man_t * p, Pdr_Hlp_t * pHlp, int fMerge )
+{
+    assert( pHlp->pTask != NULL );
+    Abc_TaskWait( pHlp->pTask );
+    Abc_TaskFree( pHlp->pTask );
+    pHlp->pTask = NULL;
+    Pdr_SetDeref( pHlp->pOrig );
+    Pdr_SetDeref( pHlp->pCube );
+    pHlp->pOrig = pHlp->pCube = NULL;
+    if ( pHlp->pCubeMin == NULL )
+        return;
+    if ( fMerge && !Pdr_ManCheckContainment( p, pHlp->kLemma, pHlp->pCubeMin ) )
+        Pdr_ManParAddLemma( p, pHlp->kLemma, pHlp->pCubeMin );
+    else
+        Pdr_SetDeref( pHlp->pCubeMin );
+    pHlp->pCubeMin = NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Merges the lemmas derived by the helpers.]
+
+  Description [If fWait is 1, waits for all helpers. Otherwise, only
+  collects the jobs that are finished.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManParCollect( Pdr_Man_t * p, int fWait )
+{
+    Pdr_Hlp_t * pHlp;
+    int i;
+    if ( p->vHelpers == NULL )
+        return;
+    Vec_PtrForEachEntry( Pdr_Hlp_t *, p->vHelpers, pHlp, i )
+    {
+        if ( pHlp->pTask == NULL )
+            continue;
+        if ( fWait || Abc_TaskIsDone(pHlp->pTask) )
+            Pdr_ManParFinish( p, pHlp, 1 );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Gives obligations to the idle helpers.]
+
+  Description [The idle helpers first take the obligations waiting in
+  the queue, which are not being solved by other helpers. The remaining
+  idle helpers generalize pCur, the obligation of the master, if given.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Pdr_ManParIsBusy( Pdr_Man_t * p, Pdr_Obl_t * pObl )
+{
+    Pdr_Hlp_t * pHlp;
+    int i;
+    Vec_PtrForEachEntry( Pdr_Hlp_t *, p->vHelpers, pHlp, i )
+        if ( pHlp->pTask && pHlp->pOrig == pObl->pState && pHlp->iFrame == pObl->iFrame )
+            return 1;
+    return 0;
+}
+static void Pdr_ManParStartJob( Pdr_Man_t * p, Pdr_Hlp_t * pHlp, Pdr_Obl_t * pObl )
+{
+    int * pPrio = Vec_IntArray( p->vPrio );
+    int * pPrioHlp = Vec_IntArray( pHlp->pMan->vPrio );
+    int k, Mask = (1 << p->nPrioShift) - 1;
+    assert( pHlp->pTask == NULL );
+    // pass the new lemmas
+    for ( k = pHlp->iLog; k < Vec_PtrSize(p->vLog); k++ )
+    {
+        Vec_PtrPush( pHlp->vSync, Pdr_SetDup((Pdr_Set_t *)Vec_PtrEntry(p->vLog, k)) );
+        Vec_IntPush( pHlp->vSyncLevels, Vec_IntEntry(p->vLogLevels, k) );
+    }
+    pHlp->iLog = Vec_PtrSize(p->vLog);
+    // pass the flop priorities randomly breaking the ties
+    for ( k = 0; k < Vec_IntSize(p->vPrio); k++ )
+        pPrioHlp[k] = (pPrio[k] & ~Mask) | (Pdr_HlpRandom(pHlp) & Mask);
+    // start the job
+    pHlp->nFrames   = Vec_PtrSize(p->vSolvers);
+    pHlp->pOrig     = Pdr_SetRef( pObl->pState );
+    pHlp->pCube     = Pdr_SetDup( pObl->pState );
+    pHlp->iFrame    = pObl->iFrame;
+    pHlp->nTimeLeft = p->timeToStop ? Abc_MaxInt( (int)(p->timeToStop - Abc_Clock()), 1 ) : 0;
+    pHlp->pTask     = Abc_TaskStartBackground( (Abc_Pool_t *)p->pPool, Pdr_ManParWorker, pHlp );
+    p->nParJobs++;
+}
+void Pdr_ManParDispatch( Pdr_Man_t * p, Pdr_Obl_t * pCur )
+{
+    Pdr_Hlp_t * pHlp;
+    Pdr_Obl_t * pObl = p->pQueue;
+    Pdr_Set_t * pCube;
+    int i, k, nScan = 0, iLogMin, kMax = Vec_PtrSize(p->vSolvers)-1;
+    if ( p->vHelpers == NULL )
+        return;
+    Vec_PtrForEachEntry( Pdr_Hlp_t *, p->vHelpers, pHlp, i )
+    {
+        if ( pHlp->pTask )
+            continue;
+        // find an obligation that is not being solved
+        for ( ; pObl && nScan < PDR_PAR_SCAN_LIMIT; pObl = pObl->pLink, nScan++ )
+            if ( pObl->iFrame > 0 && pObl->iFrame <= kMax && !Pdr_ManParIsBusy(p, pObl) && !Pdr_SetIsInit(pObl->pState, -1) )
+                break;
+        if ( pObl && nScan < PDR_PAR_SCAN_LIMIT )
+        {
+            Pdr_ManParStartJob( p, pHlp, pObl );
+            pObl = pObl->pLink;
+            nScan++;
+        }
+        else if ( pCur )
+            Pdr_ManParStartJob( p, pHlp, pCur );
+        else
+            break;
+    }
+    // trim the log seen by all helpers
+    iLogMin = Vec_PtrSize(p->vLog);
+    Vec_PtrForEachEntry( Pdr_Hlp_t *, p->vHelpers, pHlp, i )
+        iLogMin = Abc_MinInt( iLogMin, pHlp->iLog );
+    if ( iLogMin == 0 || iLogMin < Vec_PtrSize(p->vLog) )
+        return;
+    Vec_PtrForEachEntry( Pdr_Set_t *, p->vLog, pCube, k )
+        Pdr_SetDeref( pCube );
+    Vec_PtrClear( p->vLog );
+    Vec_IntClear( p->vLogLevels );
+    Vec_PtrForEachEntry( Pdr_Hlp_t *, p->vHelpers, pHlp, i )
+        pHlp->iLog = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops helpers.]
+
+  Description [The lemmas derived by the running jobs are discarded.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManParStop( Pdr_Man_t * p )
+{
+    Pdr_Hlp_t * pHlp;
+    Pdr_Set_t * pCube;
+    Aig_Man_t * pAig;
+    int i, k;
+    if ( p->vHelpers == NULL )
+        return;
+    Vec_PtrForEachEntry( Pdr_Hlp_t *, p->vHelpers, pHlp, i )
+    {
+        if ( pHlp->pTask )
+            Pdr_ManParFinish( p, pHlp, 0 );
+        Vec_PtrForEachEntry( Pdr_Set_t *, pHlp->vSync, pCube, k )
+            Pdr_SetDeref( pCube );
+        Vec_PtrFree( pHlp->vSync );
+        Vec_IntFree( pHlp->vSyncLevels );
+        pAig = pHlp->pMan->pAig;
+        Pdr_ManStop( pHlp->pMan );
+        Aig_ManStop( pAig );
+        ABC_FREE( pHlp );
+    }
+    Vec_PtrFreeP( &p->vHelpers );
+    Vec_PtrForEachEntry( Pdr_Set_t *, p->vLog, pCube, k )
+        Pdr_SetDeref( pCube );
+    Vec_PtrFreeP( &p->vLog );
+    Vec_IntFreeP( &p->vLogLevels );
+    Abc_PoolStop( (Abc_Pool_t *)p->pPool );
+    p->pPool = NULL;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
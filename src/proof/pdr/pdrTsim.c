@@ -404,8 +404,39 @@ Pdr_ManPrintCex( p->pAig, vCiObjs, vCiVals, NULL );
     RetValue = Pdr_ManSimDataInit( p->pAig, vCiObjs, vCiVals, vNodes, vCoObjs, vCoVals, NULL );
     assert( RetValue );
 
+    // remove flops using bit-parallel simulation
+    if ( p->vTerSims )
+    {
+        // collect flops in the order in which they are tried
+        Vec_IntClear( vRes );
+        Aig_ManForEachObjVec( vCiObjs, p->pAig, pObj, i )
+        {
+            if ( !Saig_ObjIsLo( p->pAig, pObj ) )
+                continue;
+            Entry = Aig_ObjCioId(pObj) - Saig_ManPiNum(p->pAig);
+            if ( p->pPars->fFlopPrio || !Vec_IntEntry(vPrio, Entry) )
+                Vec_IntPush( vRes, Entry );
+        }
+        if ( p->pPars->fFlopPrio )
+            Vec_IntSelectSortCost( Vec_IntArray(vRes), Vec_IntSize(vRes), vPrio );
+        else
+        {
+            Aig_ManForEachObjVec( vCiObjs, p->pAig, pObj, i )
+            {
+                if ( !Saig_ObjIsLo( p->pAig, pObj ) )
+                    continue;
+                Entry = Aig_ObjCioId(pObj) - Saig_ManPiNum(p->pAig);
+                if ( Vec_IntEntry(vPrio, Entry) )
+                    Vec_IntPush( vRes, Entry );
+            }
+        }
+        Vec_IntForEachEntry( vRes, Entry, i )
+            Vec_IntWriteEntry( vRes, i, Aig_ObjId(Aig_ManCi(p->pAig, Saig_ManPiNum(p->pAig) + Entry)) );
+        p->nTerEvals += Pdr_ManTswExtend( p->pAig, p->vTerSims, p->pPars->nTerWords, 
+            vCiObjs, vCiVals, vNodes, vCoObjs, vCoVals, vRes, vVisits, vCi2Rem );
+    }
     // iteratively remove flops
-    if ( p->pPars->fFlopPrio )
+    else if ( p->pPars->fFlopPrio )
     {
         // collect flops and sort them by priority
         Vec_IntClear( vRes );
@@ -0,0 +1,353 @@
+/**CFile****************************************************************
+
+  FileName    [pdrTsim4.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Property driven reachability.]
+
+  Synopsis    [Bit-parallel dual-rail ternary simulation.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - November 20, 2010.]
+
+  Revision    [$Id: pdrTsim4.c,v 1.00 2010/11/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "pdrInt.h"
+#include "aig/gia/gia.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// Each object has two rails of nWords words each. A bit of the first rail
+// is 1 if the value in the pattern must be 1, a bit of the second rail is 1
+// if the value can be 1. Thus, 0 = (0,0), 1 = (1,1), and X = (0,1).
+// The AND of two ternary values is the AND of the rails, while the
+// complement swaps and complements the rails, so one ternary AND gate
+// is evaluated for 64 * nWords patterns by two calls to the word-level
+// AND kernel of the simulator (AVX2 or AVX-512 if available).
+
+static inline word * Pdr_TswMust( Vec_Wrd_t * vSims, int nWords, int Id ) { return Vec_WrdEntryP( vSims, 2 * nWords * Id );          }
+static inline word * Pdr_TswCan( Vec_Wrd_t * vSims, int nWords, int Id )  { return Vec_WrdEntryP( vSims, 2 * nWords * Id + nWords ); }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Sets the binary value of the object in all patterns.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Pdr_TswSetConst( Vec_Wrd_t * vSims, int nWords, int Id, int Value )
+{
+    word * pMust = Pdr_TswMust( vSims, nWords, Id );
+    word * pCan  = Pdr_TswCan( vSims, nWords, Id );
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pMust[w] = pCan[w] = Value ? ~(word)0 : 0;
+}
+static inline void Pdr_TswSetX( Vec_Wrd_t * vSims, int nWords, int Id, int iWord, word Mask )
+{
+    Pdr_TswMust( vSims, nWords, Id )[iWord] &= ~Mask;
+    Pdr_TswCan( vSims, nWords, Id )[iWord]  |=  Mask;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the nodes and the COs.]
+
+  Description [The simulation info of the CIs should be assigned.
+  Only the first nWordsUse words of each rail are simulated.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManTswSimulate( Aig_Man_t * pAig, Vec_Wrd_t * vSims, int nWords, int nWordsUse, Vec_Int_t * vNodes, Vec_Int_t * vCoObjs )
+{
+    Aig_Obj_t * pObj;
+    int i, Id, Id0, Id1, fCompl0, fCompl1;
+    Aig_ManForEachObjVec( vNodes, pAig, pObj, i )
+    {
+        Id = Aig_ObjId(pObj);
+        Id0 = Aig_ObjFaninId0(pObj); fCompl0 = Aig_ObjFaninC0(pObj);
+        Id1 = Aig_ObjFaninId1(pObj); fCompl1 = Aig_ObjFaninC1(pObj);
+        Gia_ManSimdAnd( Pdr_TswMust(vSims, nWords, Id),
+            fCompl0 ? Pdr_TswCan(vSims, nWords, Id0) : Pdr_TswMust(vSims, nWords, Id0),
+            fCompl1 ? Pdr_TswCan(vSims, nWords, Id1) : Pdr_TswMust(vSims, nWords, Id1),
+            fCompl0 ? ~(word)0 : 0, fCompl1 ? ~(word)0 : 0, nWordsUse );
+        Gia_ManSimdAnd( Pdr_TswCan(vSims, nWords, Id),
+            fCompl0 ? Pdr_TswMust(vSims, nWords, Id0) : Pdr_TswCan(vSims, nWords, Id0),
+            fCompl1 ? Pdr_TswMust(vSims, nWords, Id1) : Pdr_TswCan(vSims, nWords, Id1),
+            fCompl0 ? ~(word)0 : 0, fCompl1 ? ~(word)0 : 0, nWordsUse );
+    }
+    Aig_ManForEachObjVec( vCoObjs, pAig, pObj, i )
+    {
+        Id = Aig_ObjId(pObj);
+        Id0 = Aig_ObjFaninId0(pObj); fCompl0 = Aig_ObjFaninC0(pObj);
+        Gia_ManSimdCopy( Pdr_TswMust(vSims, nWords, Id), fCompl0 ? Pdr_TswCan(vSims, nWords, Id0) : Pdr_TswMust(vSims, nWords, Id0), fCompl0 ? ~(word)0 : 0, nWordsUse );
+        Gia_ManSimdCopy( Pdr_TswCan(vSims, nWords, Id),  fCompl0 ? Pdr_TswMust(vSims, nWords, Id0) : Pdr_TswCan(vSims, nWords, Id0), fCompl0 ? ~(word)0 : 0, nWordsUse );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the patterns where some CO is not equal to its value.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Pdr_ManTswFailed( Aig_Man_t * pAig, Vec_Wrd_t * vSims, int nWords, int nWordsUse, Vec_Int_t * vCoObjs, Vec_Int_t * vCoVals, word * pFail )
+{
+    Aig_Obj_t * pObj;
+    word * pSim;
+    int i, w;
+    for ( w = 0; w < nWordsUse; w++ )
+        pFail[w] = 0;
+    Aig_ManForEachObjVec( vCoObjs, pAig, pObj, i )
+    {
+        if ( Vec_IntEntry(vCoVals, i) )
+        {
+            pSim = Pdr_TswMust( vSims, nWords, Aig_ObjId(pObj) );
+            for ( w = 0; w < nWordsUse; w++ )
+                pFail[w] |= ~pSim[w];
+        }
+        else
+        {
+            pSim = Pdr_TswCan( vSims, nWords, Aig_ObjId(pObj) );
+            for ( w = 0; w < nWordsUse; w++ )
+                pFail[w] |= pSim[w];
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Assigns the CIs to their binary values.]
+
+  Description [The constant node and the CIs in vCi2Rem are also assigned.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Pdr_ManTswStart( Aig_Man_t * pAig, Vec_Wrd_t * vSims, int nWords, Vec_Int_t * vCiObjs, Vec_Int_t * vCiVals, Vec_Int_t * vCi2Rem )
+{
+    Aig_Obj_t * pObj;
+    int i, w;
+    Pdr_TswSetConst( vSims, nWords, Aig_ObjId(Aig_ManConst1(pAig)), 1 );
+    Aig_ManForEachObjVec( vCiObjs, pAig, pObj, i )
+        Pdr_TswSetConst( vSims, nWords, Aig_ObjId(pObj), Vec_IntEntry(vCiVals, i) );
+    Aig_ManForEachObjVec( vCi2Rem, pAig, pObj, i )
+        for ( w = 0; w < nWords; w++ )
+            Pdr_TswSetX( vSims, nWords, Aig_ObjId(pObj), w, ~(word)0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Tries to assign ternary values to the given CIs.]
+
+  Description [Takes the CIs in vCands (object IDs) in this order and
+  collects in vCi2Rem those that can be assigned X together with the
+  previously collected ones, so that the COs keep their values. The result
+  is the same as when trying the CIs one at a time. Each round of
+  simulation tries 64 * nWords candidates at once. First, pattern j
+  makes only candidate j an X. Because ternary simulation is monotone,
+  a candidate that fails alone is never collected. Next, pattern j makes
+  X the collected CIs and the first j+1 remaining candidates, so that the
+  first failing pattern of a round shows how many candidates are collected
+  before the next one fails. Returns the number of node evaluations.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+word Pdr_ManTswExtend( Aig_Man_t * pAig, Vec_Wrd_t * vSims, int nWords,
+    Vec_Int_t * vCiObjs, Vec_Int_t * vCiVals, Vec_Int_t * vNodes, Vec_Int_t * vCoObjs, Vec_Int_t * vCoVals,
+    Vec_Int_t * vCands, Vec_Int_t * vLive, Vec_Int_t * vCi2Rem )
+{
+    word pFail[64], nEvals = 0;
+    int nBits = 64 * nWords, nWordsUse, nRound, iStart, iFail, i, w, Id;
+    assert( nWords > 0 && nWords <= 64 );
+    Vec_IntClear( vCi2Rem );
+    // filter the candidates that cannot be removed alone
+    Vec_IntClear( vLive );
+    for ( iStart = 0; iStart < Vec_IntSize(vCands); iStart += nBits )
+    {
+        nRound = Abc_MinInt( nBits, Vec_IntSize(vCands) - iStart );
+        nWordsUse = Abc_Bit6WordNum( nRound );
+        Pdr_ManTswStart( pAig, vSims, nWords, vCiObjs, vCiVals, vCi2Rem );
+        for ( i = 0; i < nRound; i++ )
+            Pdr_TswSetX( vSims, nWords, Vec_IntEntry(vCands, iStart + i), i >> 6, (word)1 << (i & 63) );
+        Pdr_ManTswSimulate( pAig, vSims, nWords, nWordsUse, vNodes, vCoObjs );
+        Pdr_ManTswFailed( pAig, vSims, nWords, nWordsUse, vCoObjs, vCoVals, pFail );
+        nEvals += (word)Vec_IntSize(vNodes) * 64 * nWordsUse;
+        for ( i = 0; i < nRound; i++ )
+            if ( !Abc_InfoHasBit((unsigned *)pFail, i) )
+                Vec_IntPush( vLive, Vec_IntEntry(vCands, iStart + i) );
+    }
+    // collect the longest prefixes of the remaining candidates
+    for ( iStart = 0; iStart < Vec_IntSize(vLive); )
+    {
+        nRound = Abc_MinInt( nBits, Vec_IntSize(vLive) - iStart );
+        nWordsUse = Abc_Bit6WordNum( nRound );
+        Pdr_ManTswStart( pAig, vSims, nWords, vCiObjs, vCiVals, vCi2Rem );
+        for ( i = 0; i < nRound; i++ )
+        {
+            Id = Vec_IntEntry( vLive, iStart + i );
+            Pdr_TswSetX( vSims, nWords, Id, i >> 6, ~(word)0 << (i & 63) );
+            for ( w = (i >> 6) + 1; w < nWordsUse; w++ )
+                Pdr_TswSetX( vSims, nWords, Id, w, ~(word)0 );
+        }
+        Pdr_ManTswSimulate( pAig, vSims, nWords, nWordsUse, vNodes, vCoObjs );
+        Pdr_ManTswFailed( pAig, vSims, nWords, nWordsUse, vCoObjs, vCoVals, pFail );
+        nEvals += (word)Vec_IntSize(vNodes) * 64 * nWordsUse;
+        for ( iFail = 0; iFail < nRound; iFail++ )
+            if ( Abc_InfoHasBit((unsigned *)pFail, iFail) )
+                break;
+        for ( i = 0; i < iFail; i++ )
+            Vec_IntPush( vCi2Rem, Vec_IntEntry(vLive, iStart + i) );
+        iStart += Abc_MinInt( iFail + 1, nRound );
+    }
+    return nEvals;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Compares the scalar and the bit-parallel ternary simulation.]
+
+  Description [Simulates all nodes of the AIG for random patterns, in
+  which the CIs are X with probability 1/4, and prints the number of
+  node evaluations per second. Returns 0 if the results differ.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManTernaryBench( Aig_Man_t * pAig, int nWords, int nRounds, int fVerbose )
+{
+    Vec_Int_t * vCiObjs = Vec_IntAlloc( Aig_ManCiNum(pAig) );
+    Vec_Int_t * vCiVals = Vec_IntAlloc( Aig_ManCiNum(pAig) );
+    Vec_Int_t * vCi2Rem = Vec_IntAlloc( Aig_ManCiNum(pAig) );
+    Vec_Int_t * vCoObjs = Vec_IntAlloc( Aig_ManCoNum(pAig) );
+    Vec_Int_t * vCoVals = Vec_IntAlloc( Aig_ManCoNum(pAig) );
+    Vec_Int_t * vNodes  = Vec_IntAlloc( Aig_ManNodeNum(pAig) );
+    Vec_Wrd_t * vSims   = Vec_WrdStart( 2 * nWords * Aig_ManObjNumMax(pAig) );
+    unsigned * pTerSimData = pAig->pTerSimData;
+    Aig_Obj_t * pObj;
+    word * pMust, * pCan;
+    abctime clk;
+    double nEvals;
+    int i, r, b, Value, RetValue = 1;
+    int nPats = 64 * nWords, nScalarRounds = Abc_MaxInt( 1, nRounds / 100 );
+    double TimeScalar, TimeParal;
+    Aig_ManForEachCi( pAig, pObj, i )
+        Vec_IntPush( vCiObjs, Aig_ObjId(pObj) );
+    Aig_ManForEachNode( pAig, pObj, i )
+        Vec_IntPush( vNodes, Aig_ObjId(pObj) );
+    Aig_ManForEachCo( pAig, pObj, i )
+        Vec_IntPush( vCoObjs, Aig_ObjId(pObj) );
+    pAig->pTerSimData = ABC_CALLOC( unsigned, 1 + (Aig_ManObjNumMax(pAig) / 16) );
+    Abc_RandomW( 1 );
+    // bit-parallel simulation of random patterns
+    Pdr_TswSetConst( vSims, nWords, Aig_ObjId(Aig_ManConst1(pAig)), 1 );
+    Aig_ManForEachCi( pAig, pObj, i )
+    {
+        pMust = Pdr_TswMust( vSims, nWords, Aig_ObjId(pObj) );
+        pCan  = Pdr_TswCan( vSims, nWords, Aig_ObjId(pObj) );
+        for ( b = 0; b < nWords; b++ )
+        {
+            word Data = Abc_RandomW(0), Undef = Abc_RandomW(0) & Abc_RandomW(0);
+            pMust[b] = Data & ~Undef;
+            pCan[b]  = Data |  Undef;
+        }
+    }
+    clk = Abc_Clock();
+    for ( r = 0; r < nRounds; r++ )
+        Pdr_ManTswSimulate( pAig, vSims, nWords, nWords, vNodes, vCoObjs );
+    TimeParal = 1.0*(Abc_Clock() - clk)/CLOCKS_PER_SEC;
+    // scalar simulation of the same patterns
+    clk = Abc_Clock();
+    for ( r = 0; r < nScalarRounds; r++ )
+    for ( b = 0; b < nPats; b++ )
+    {
+        Vec_IntClear( vCiVals );
+        Vec_IntClear( vCi2Rem );
+        Aig_ManForEachCi( pAig, pObj, i )
+        {
+            pMust = Pdr_TswMust( vSims, nWords, Aig_ObjId(pObj) );
+            pCan  = Pdr_TswCan( vSims, nWords, Aig_ObjId(pObj) );
+            Vec_IntPush( vCiVals, Abc_InfoHasBit((unsigned *)pMust, b) );
+            if ( Abc_InfoHasBit((unsigned *)pCan, b) && !Abc_InfoHasBit((unsigned *)pMust, b) )
+                Vec_IntPush( vCi2Rem, Aig_ObjId(pObj) );
+        }
+        Vec_IntFill( vCoVals, Aig_ManCoNum(pAig), 0 );
+        Pdr_ManSimDataInit( pAig, vCiObjs, vCiVals, vNodes, vCoObjs, vCoVals, vCi2Rem );
+        if ( r > 0 )
+            continue;
+        // compare the results
+        Aig_ManForEachObjVec( vNodes, pAig, pObj, i )
+        {
+            Value = 3 & (pAig->pTerSimData[Aig_ObjId(pObj) >> 4] >> ((Aig_ObjId(pObj) & 15) << 1));
+            pMust = Pdr_TswMust( vSims, nWords, Aig_ObjId(pObj) );
+            pCan  = Pdr_TswCan( vSims, nWords, Aig_ObjId(pObj) );
+            if ( Value != (Abc_InfoHasBit((unsigned *)pMust, b) ? 2 : Abc_InfoHasBit((unsigned *)pCan, b) ? 3 : 1) )
+                RetValue = 0;
+        }
+    }
+    TimeScalar = 1.0*(Abc_Clock() - clk)/CLOCKS_PER_SEC;
+    ABC_FREE( pAig->pTerSimData );
+    pAig->pTerSimData = pTerSimData;
+    // report the results
+    nEvals = 1.0 * Vec_IntSize(vNodes) * nPats;
+    printf( "Ternary simulation of %d nodes for %d patterns (%s, %d words):\n", Vec_IntSize(vNodes), nPats, Gia_ManSimdName(), nWords );
+    printf( "Scalar     : %10.2f M node evaluations/sec  ", nEvals * nScalarRounds / 1000000 / Abc_MaxDouble(TimeScalar, 0.000001) );
+    ABC_PRT( "Time", (abctime)(TimeScalar * CLOCKS_PER_SEC) );
+    printf( "Dual-rail  : %10.2f M node evaluations/sec  ", nEvals * nRounds / 1000000 / Abc_MaxDouble(TimeParal, 0.000001) );
+    ABC_PRT( "Time", (abctime)(TimeParal * CLOCKS_PER_SEC) );
+    printf( "Speedup    : %10.2f\n", (TimeScalar / nScalarRounds) / Abc_MaxDouble(TimeParal / nRounds, 0.000000001) );
+    if ( !RetValue )
+        printf( "The results of scalar and bit-parallel ternary simulation are different.\n" );
+    else if ( fVerbose )
+        printf( "The results of scalar and bit-parallel ternary simulation are the same.\n" );
+    Vec_IntFree( vCiObjs );
+    Vec_IntFree( vCiVals );
+    Vec_IntFree( vCi2Rem );
+    Vec_IntFree( vCoObjs );
+    Vec_IntFree( vCoVals );
+    Vec_IntFree( vNodes );
+    Vec_WrdFree( vSims );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
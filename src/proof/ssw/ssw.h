@@ -109,6 +109,7 @@ struct Ssw_RarPars_t_
     int              fUseCex;
     int              fLatchOnly;
     int              fUseFfGrouping;
+    int              nThreads;
     int              nSolved;
     Abc_Cex_t *      pCex;
     int(*pFuncOnFail)(int,Abc_Cex_t*); // called for a failed output in MO mode
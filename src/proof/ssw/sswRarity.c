@@ -115,6 +115,7 @@ void Ssw_RarSetDefaultParams( Ssw_RarPars_t * p )
     p->fSetLastState =   0;
     p->fVerbose      =   0;
     p->fNotVerbose   =   0;
+    p->nThreads      =   1;
 }
 
 /**Function*************************************************************
@@ -637,6 +638,44 @@ int Ssw_RarManCheckNonConstOutputs( Ssw_RarMan_t * p, int iFrame, abctime Time )
         return 0;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Simulates the words wStart..wStop-1 of internal nodes and COs.]
+
+  Description [Called for disjoint blocks of words by different threads.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Ssw_RarManSimulateBlock( void * pArg, int wStart, int wStop )
+{
+    Ssw_RarMan_t * p = (Ssw_RarMan_t *)pArg;
+    Aig_Obj_t * pObj;
+    word * pSim, * pSim0, * pSim1;
+    word Flip, Flip0, Flip1;
+    int w, i;
+    Aig_ManForEachNode( p->pAig, pObj, i )
+    {
+        pSim  = Ssw_RarObjSim( p, Aig_ObjId(pObj) );
+        pSim0 = Ssw_RarObjSim( p, Aig_ObjFaninId0(pObj) );
+        pSim1 = Ssw_RarObjSim( p, Aig_ObjFaninId1(pObj) );
+        Flip0 = Aig_ObjFaninC0(pObj) ? ~(word)0 : 0;
+        Flip1 = Aig_ObjFaninC1(pObj) ? ~(word)0 : 0;
+        for ( w = wStart; w < wStop; w++ )
+            pSim[w] = (Flip0 ^ pSim0[w]) & (Flip1 ^ pSim1[w]);
+    }
+    Aig_ManForEachCo( p->pAig, pObj, i )
+    {
+        pSim  = Ssw_RarObjSim( p, Aig_ObjId(pObj) );
+        pSim0 = Ssw_RarObjSim( p, Aig_ObjFaninId0(pObj) );
+        Flip  = Aig_ObjFaninC0(pObj) ? ~(word)0 : 0;
+        for ( w = wStart; w < wStop; w++ )
+            pSim[w] = Flip ^ pSim0[w];
+    }
+}
+
 /**Function*************************************************************
 
   Synopsis    [Performs one round of simulation.]
@@ -651,9 +690,7 @@ int Ssw_RarManCheckNonConstOutputs( Ssw_RarMan_t * p, int iFrame, abctime Time )
 void Ssw_RarManSimulate( Ssw_RarMan_t * p, Vec_Int_t * vInit, int fUpdate, int fFirst )
 {
     Aig_Obj_t * pObj, * pRepr;
-    word * pSim, * pSim0, * pSim1;
-    word Flip, Flip0, Flip1;
-    int w, i;
+    int i;
     // initialize
     Ssw_RarManInitialize( p, vInit );
     Vec_PtrClear( p->vUpdConst );
@@ -677,44 +714,28 @@ void Ssw_RarManSimulate( Ssw_RarMan_t * p, Vec_Int_t * vInit, int fUpdate, int f
             Aig_ObjSetTravIdCurrent( p->pAig, pRepr );
         }
     }
-    // simulate
-    Aig_ManForEachNode( p->pAig, pObj, i )
+    // simulate internal nodes and COs
+    Gia_ManSimBlocksRun( p->pPars->nWords, 8, Abc_MaxInt(p->pPars->nThreads, 1), Ssw_RarManSimulateBlock, p );
+    // check classes
+    if ( fUpdate )
     {
-        pSim  = Ssw_RarObjSim( p, Aig_ObjId(pObj) );
-        pSim0 = Ssw_RarObjSim( p, Aig_ObjFaninId0(pObj) );
-        pSim1 = Ssw_RarObjSim( p, Aig_ObjFaninId1(pObj) );
-        Flip0 = Aig_ObjFaninC0(pObj) ? ~(word)0 : 0;
-        Flip1 = Aig_ObjFaninC1(pObj) ? ~(word)0 : 0;
-        for ( w = 0; w < p->pPars->nWords; w++ )
-            pSim[w] = (Flip0 ^ pSim0[w]) & (Flip1 ^ pSim1[w]);
-
-
-        if ( !fUpdate )
-            continue;
-        // check classes
-        pRepr = Aig_ObjRepr(p->pAig, pObj);
-        if ( pRepr == NULL || Aig_ObjIsTravIdCurrent( p->pAig, pRepr ) )
-            continue;
-        if ( Ssw_RarManObjsAreEqual( p, pObj, pRepr ) )
-            continue;
-        // save for update
-        if ( pRepr == Aig_ManConst1(p->pAig) )
-            Vec_PtrPush( p->vUpdConst, pObj );
-        else
+        Aig_ManForEachNode( p->pAig, pObj, i )
         {
-            Vec_PtrPush( p->vUpdClass, pRepr );
-            Aig_ObjSetTravIdCurrent( p->pAig, pRepr );
+            pRepr = Aig_ObjRepr(p->pAig, pObj);
+            if ( pRepr == NULL || Aig_ObjIsTravIdCurrent( p->pAig, pRepr ) )
+                continue;
+            if ( Ssw_RarManObjsAreEqual( p, pObj, pRepr ) )
+                continue;
+            // save for update
+            if ( pRepr == Aig_ManConst1(p->pAig) )
+                Vec_PtrPush( p->vUpdConst, pObj );
+            else
+            {
+                Vec_PtrPush( p->vUpdClass, pRepr );
+                Aig_ObjSetTravIdCurrent( p->pAig, pRepr );
+            }
         }
     }
-    // transfer to POs
-    Aig_ManForEachCo( p->pAig, pObj, i )
-    {
-        pSim  = Ssw_RarObjSim( p, Aig_ObjId(pObj) );
-        pSim0 = Ssw_RarObjSim( p, Aig_ObjFaninId0(pObj) );
-        Flip  = Aig_ObjFaninC0(pObj) ? ~(word)0 : 0;
-        for ( w = 0; w < p->pPars->nWords; w++ )
-            pSim[w] = Flip ^ pSim0[w];
-    }
     // refine classes
     if ( fUpdate )
     {
@@ -114,12 +114,14 @@ struct Saig_ParBmc_t_
     int         fNoRestarts;    // disables periodic restarts
     int         fUseSatoko;     // enables using Satoko
     int         fUseGlucose;    // enables using Glucose 3.0
+    int         nThreads;       // the number of Glucose solvers sharing learned clauses
     int         nLearnedStart;  // starting learned clause limit
     int         nLearnedDelta;  // delta of learned clause limit
     int         nLearnedPerce;  // ratio of learned clause limit
     int         fVerbose;       // verbose 
     int         fNotVerbose;    // skip line-by-line print-out 
     char *      pLogFileName;   // log file name
+    char *      pCacheFileName; // file with the unrolling data and proved depths
     int         fSilent;        // completely silent
     int         iFrame;         // explored up to this frame
     int         nFailOuts;      // the number of failed outputs
@@ -128,6 +130,8 @@ struct Saig_ParBmc_t_
     int(*pFuncOnFail)(int,Abc_Cex_t*); // called for a failed output in MO mode
     int         RunId;          // BMC id in this run 
     int(*pFuncStop)(int);       // callback to terminate
+    void *      pMbox;          // mailbox shared with other engines (Abc_Mbox_t)
+    int         MboxId;         // the ID of this engine in the mailbox
 };
 
  
@@ -176,10 +180,31 @@ struct Bmc_MulPar_t_
     int         TimeOutInc;
     int         TimeOutGap;
     int         TimePerOut;
+    int         nProcs;         // the number of threads solving clusters (0 = sequential flow)
+    int         nClustSize;     // the largest number of outputs in one cluster
+    int         nEngine;        // the engine used on clusters (0 = sim, 1 = bmc3, 2 = pdr)
     int         fUseSyn;
     int         fDumpFinal;
     int         fVerbose;
     int         fVeryVerbose;
+    Vec_Int_t * vOutMap;        // in the parallel mode, contains status for each PO (0 = sat; 1 = unsat; -1 = undecided)
+};
+
+typedef struct Bmc_PortPar_t_ Bmc_PortPar_t;
+struct Bmc_PortPar_t_
+{
+    int         nTimeOut;       // timeout in seconds for each output
+    int         nMboxSize;      // the mailbox size in megabytes
+    int         fUsePdr;        // run property directed reachability
+    int         fUseBmc;        // run bounded model checking
+    int         fUseInt;        // run interpolation
+    int         fUseShare;      // exchange clauses and bounds
+    int         fSolveAll;      // do not stop when an output fails
+    int         fVerbose;       // verbose output
+    int         iFrame;         // explored up to this frame
+    int         nFailOuts;      // the number of failed outputs
+    int         nProveOuts;     // the number of proved outputs
+    Vec_Int_t * vOutMap;        // output statuses (1 = proved; 0 = failed; -1 = undecided)
 };
 
 typedef struct Bmc_ParFf_t_ Bmc_ParFf_t;
@@ -223,6 +248,10 @@ extern void              Saig_ParBmcSetDefaultParams( Saig_ParBmc_t * p );
 extern int               Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars );
 /*=== bmcBmcAnd.c ==========================================================*/
 extern int               Gia_ManBmcPerform( Gia_Man_t * p, Bmc_AndPar_t * pPars );
+/*=== bmcCache.c ==========================================================*/
+extern word              Saig_ManBmcCacheHash( Aig_Man_t * p );
+extern int               Saig_ManBmcCacheRead( char * pFileName, Aig_Man_t * pAig, Vec_Int_t ** pvMapping, Vec_Int_t ** pvDepths );
+extern int               Saig_ManBmcCacheWrite( char * pFileName, Aig_Man_t * pAig, Vec_Int_t * vMapping, Vec_Int_t * vDepths );
 /*=== bmcCexCare.c ==========================================================*/
 extern Abc_Cex_t *       Bmc_CexCareExtendToObjects( Gia_Man_t * p, Abc_Cex_t * pCex, Abc_Cex_t * pCexCare );
 extern Abc_Cex_t *       Bmc_CexCareMinimize( Aig_Man_t * p, int nRealPis, Abc_Cex_t * pCex, int nTryCexes, int fCheck, int fVerbose );
@@ -241,6 +270,9 @@ extern int               Bmc_CexVerify( Gia_Man_t * p, Abc_Cex_t * pCex, Abc_Cex
 /*=== bmcICheck.c ==========================================================*/
 extern void              Bmc_PerformICheck( Gia_Man_t * p, int nFramesMax, int nTimeOut, int fEmpty, int fVerbose );
 extern Vec_Int_t *       Bmc_PerformISearch( Gia_Man_t * p, int nFramesMax, int nTimeOut, int fReverse, int fBackTopo, int fDump, int fVerbose );
+/*=== bmcPort.c ==========================================================*/
+extern void              Bmc_PortSetDefaultParams( Bmc_PortPar_t * pPars );
+extern int               Bmc_PortPerform( Gia_Man_t * p, Bmc_PortPar_t * pPars );
 /*=== bmcUnroll.c ==========================================================*/
 extern Unr_Man_t *       Unr_ManUnrollStart( Gia_Man_t * pGia, int fVerbose );
 extern Gia_Man_t *       Unr_ManUnrollFrame( Unr_Man_t * p, int f );
@@ -23,8 +23,10 @@
 #include "sat/bsat/satStore.h"
 #include "sat/satoko/satoko.h"
 #include "sat/glucose/AbcGlucose.h"
+#include "sat/glucose2/AbcGlucosePort2.h"
 #include "misc/vec/vecHsh.h"
 #include "misc/vec/vecWec.h"
+#include "misc/util/utilMbox.h"
 #include "bmc.h"
 
 ABC_NAMESPACE_IMPL_START
@@ -43,6 +45,7 @@ struct Gia_ManBmc_t_
     // intermediate data
     Vec_Int_t *       vMapping;    // mapping
     Vec_Int_t *       vMapRefs;    // mapping references
+    Vec_Int_t *       vDepths;     // the last frame proved for each output (when the cache is used)
 //    Vec_Vec_t *       vSects;      // sections
     Vec_Int_t *       vId2Num;     // number of each node 
     Vec_Ptr_t *       vTerInfo;    // ternary information
@@ -64,10 +67,17 @@ struct Gia_ManBmc_t_
     sat_solver *      pSat;        // SAT solver
     satoko_t *        pSat2;       // SAT solver
     bmcg_sat_solver * pSat3;       // SAT solver
+    bmcg2_sat_port *  pSat4;       // SAT solver portfolio
     int               nSatVars;    // SAT variables
     int               nObjNums;    // SAT objects
     int               nWordNum;    // unsigned words for ternary simulation
     char * pSopSizes, ** pSops;    // CNF representation
+    // exchange with other engines
+    int               iMboxCursor; // the next message to read
+    int               iFrameSafe;  // the last frame known to have no CEX
+    int               nLemmas;     // the number of imported clauses
+    Vec_Int_t *       vLemmas;     // clauses for the future frames (frame, size, literals)
+    Vec_Int_t *       vClause;     // temporary clause
 };
 
 extern int Gia_ManToBridgeResult( FILE * pFile, int Result, Abc_Cex_t * pCex, int iPoProved );
@@ -718,7 +728,7 @@ Vec_Int_t * Saig_ManBmcComputeMappingRefs( Aig_Man_t * p, Vec_Int_t * vMap )
   SeeAlso     []
 
 ***********************************************************************/
-Gia_ManBmc_t * Saig_Bmc3ManStart( Aig_Man_t * pAig, int nTimeOutOne, int nConfLimit, int fUseSatoko, int fUseGlucose )
+Gia_ManBmc_t * Saig_Bmc3ManStart( Aig_Man_t * pAig, Vec_Int_t * vMapping, int nTimeOutOne, int nConfLimit, int fUseSatoko, int fUseGlucose, int nThreads )
 {
     Gia_ManBmc_t * p;
     Aig_Obj_t * pObj;
@@ -726,8 +736,8 @@ Gia_ManBmc_t * Saig_Bmc3ManStart( Aig_Man_t * pAig, int nTimeOutOne, int nConfLi
 //    assert( Aig_ManRegNum(pAig) > 0 );
     p = ABC_CALLOC( Gia_ManBmc_t, 1 );
     p->pAig = pAig;
-    // create mapping
-    p->vMapping = Cnf_DeriveMappingArray( pAig );
+    // create mapping (or take the one read from the cache)
+    p->vMapping = vMapping ? vMapping : Cnf_DeriveMappingArray( pAig );
     p->vMapRefs = Saig_ManBmcComputeMappingRefs( pAig, p->vMapping );
     // create sections
 //    p->vSects = Saig_ManBmcSections( pAig );
@@ -756,6 +766,12 @@ Gia_ManBmc_t * Saig_Bmc3ManStart( Aig_Man_t * pAig, int nTimeOutOne, int nConfLi
         satoko_configure(p->pSat2, &opts);
         satoko_setnvars(p->pSat2, 1000);
     }
+    else if ( nThreads > 1 )
+    {
+        p->pSat4 = bmcg2_sat_port_start( nThreads );
+        for ( i = 0; i < 1000; i++ )
+            bmcg2_sat_port_addvar( p->pSat4 );
+    }
     else if ( fUseGlucose )
     {
         //opts.conf_limit = nConfLimit;
@@ -775,6 +791,10 @@ Gia_ManBmc_t * Saig_Bmc3ManStart( Aig_Man_t * pAig, int nTimeOutOne, int nConfLi
     p->vData = Vec_IntAlloc( 5 * 10000 );
     p->vHash = Hsh_IntManStart( p->vData, 5, 10000 );
     p->vId2Lit = Vec_IntAlloc( 10000 );
+    // exchange with other engines
+    p->iFrameSafe = -1;
+    p->vLemmas = Vec_IntAlloc( 0 );
+    p->vClause = Vec_IntAlloc( 0 );
     // time spent on each outputs
     if ( nTimeOutOne )
     {
@@ -806,9 +826,9 @@ void Saig_Bmc3ManStop( Gia_ManBmc_t * p )
             p->pSat ? p->pSat->nLearntDelta     : 0, 
             p->pSat ? p->pSat->nLearntRatio     : 0, 
             p->pSat ? p->pSat->nDBreduces       : 0, 
-            p->pSat ? sat_solver_nvars(p->pSat) : p->pSat3 ? bmcg_sat_solver_varnum(p->pSat3) : satoko_varnum(p->pSat2), 
+            p->pSat ? sat_solver_nvars(p->pSat) : p->pSat3 ? bmcg_sat_solver_varnum(p->pSat3) : p->pSat4 ? bmcg2_sat_port_varnum(p->pSat4) : satoko_varnum(p->pSat2), 
             nUsedVars, 
-            100.0*nUsedVars/(p->pSat ? sat_solver_nvars(p->pSat) : p->pSat3 ? bmcg_sat_solver_varnum(p->pSat3) : satoko_varnum(p->pSat2)) );
+            100.0*nUsedVars/(p->pSat ? sat_solver_nvars(p->pSat) : p->pSat3 ? bmcg_sat_solver_varnum(p->pSat3) : p->pSat4 ? bmcg2_sat_port_varnum(p->pSat4) : satoko_varnum(p->pSat2)) );
         Abc_Print( 1, "Buffs = %d. Dups = %d.   Hash hits = %d.  Hash misses = %d.  UniProps = %d.\n", 
             p->nBufNum, p->nDupNum, p->nHashHit, p->nHashMiss, p->nUniProps );
     }
@@ -823,6 +843,7 @@ void Saig_Bmc3ManStop( Gia_ManBmc_t * p )
     Vec_WecFree( p->vVisited );
     Vec_IntFree( p->vMapping );
     Vec_IntFree( p->vMapRefs );
+    Vec_IntFreeP( &p->vDepths );
 //    Vec_VecFree( p->vSects );
     Vec_IntFree( p->vId2Num );
     Vec_VecFree( (Vec_Vec_t *)p->vId2Var );
@@ -830,10 +851,13 @@ void Saig_Bmc3ManStop( Gia_ManBmc_t * p )
     if ( p->pSat )  sat_solver_delete( p->pSat );
     if ( p->pSat2 ) satoko_destroy( p->pSat2 );
     if ( p->pSat3 ) bmcg_sat_solver_stop( p->pSat3 );
+    if ( p->pSat4 ) bmcg2_sat_port_stop( p->pSat4 );
     ABC_FREE( p->pTime4Outs );
     Vec_IntFree( p->vData );
     Hsh_IntManStop( p->vHash );
     Vec_IntFree( p->vId2Lit );
+    Vec_IntFree( p->vLemmas );
+    Vec_IntFree( p->vClause );
     ABC_FREE( p->pSopSizes );
     ABC_FREE( p->pSops[1] );
     ABC_FREE( p->pSops );
@@ -1029,6 +1053,11 @@ static inline void Saig_ManBmcAddClauses( Gia_ManBmc_t * p, int uTruth, int Lits
                 if ( !bmcg_sat_solver_addclause( p->pSat3, ClaLits, nClaLits ) )
                     assert( 0 );
             }
+            else if ( p->pSat4 )
+            {
+                if ( !bmcg2_sat_port_addclause( p->pSat4, ClaLits, nClaLits ) )
+                    assert( 0 );
+            }
             else
             {
                 if ( !sat_solver_addclause( p->pSat, ClaLits, ClaLits+nClaLits ) )
@@ -1287,6 +1316,11 @@ int Saig_ManBmcCreateCnf( Gia_ManBmc_t * p, Aig_Obj_t * pObj, int iFrame )
         for ( i = bmcg_sat_solver_varnum(p->pSat3); i < p->nSatVars; i++ )
             bmcg_sat_solver_addvar( p->pSat3 );
     }
+    else if ( p->pSat4 )
+    {
+        for ( i = bmcg2_sat_port_varnum(p->pSat4); i < p->nSatVars; i++ )
+            bmcg2_sat_port_addvar( p->pSat4 );
+    }
     else
         sat_solver_setnvars( p->pSat, p->nSatVars );
     return Lit;
@@ -1347,6 +1381,7 @@ void Saig_ParBmcSetDefaultParams( Saig_ParBmc_t * p )
     p->nLearnedStart  = 10000;    // starting learned clause limit
     p->nLearnedDelta  =  2000;    // delta of learned clause limit
     p->nLearnedPerce  =    80;    // ratio of learned clause limit
+    p->nThreads       =     1;    // the number of Glucose solvers sharing learned clauses
     p->fVerbose       =     0;    // verbose 
     p->fNotVerbose    =     0;    // skip line-by-line print-out 
     p->iFrame         =    -1;    // explored up to this frame
@@ -1409,6 +1444,11 @@ Abc_Cex_t * Saig_ManGenerateCex( Gia_ManBmc_t * p, int f, int i )
                 if ( iLit != ~0 && bmcg_sat_solver_read_cex_varvalue(p->pSat3, lit_var(iLit)) )
                     Abc_InfoSetBit( pCex->pData, iBit + k );
             }
+            else if ( p->pSat4 )
+            {
+                if ( iLit != ~0 && bmcg2_sat_port_read_cex_varvalue(p->pSat4, lit_var(iLit)) )
+                    Abc_InfoSetBit( pCex->pData, iBit + k );
+            }
             else
             {
                 if ( iLit != ~0 && sat_solver_var_value(p->pSat, lit_var(iLit)) )
@@ -1443,10 +1483,134 @@ int Saig_ManCallSolver( Gia_ManBmc_t * p, int Lit )
         bmcg_sat_solver_set_conflict_budget( p->pSat3, p->pPars->nConfLimit );
         return bmcg_sat_solver_solve( p->pSat3, &Lit, 1 );
     }
+    else if ( p->pSat4 )
+    {
+        bmcg2_sat_port_set_conflict_budget( p->pSat4, p->pPars->nConfLimit );
+        return bmcg2_sat_port_solve( p->pSat4, &Lit, 1 );
+    }
     else
         return sat_solver_solve( p->pSat, &Lit, &Lit + 1, (ABC_INT64_T)p->pPars->nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Adds the unit clause stating that the output literal is 0.]
+
+  Description [Used for the outputs proved by the previous runs.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_ManBmcAddProved( Gia_ManBmc_t * p, int Lit )
+{
+    int RetValue;
+    assert( Lit != 1 );
+    if ( Lit == 0 )
+        return;
+    Lit = lit_neg( Lit );
+    if ( p->pSat2 )
+        RetValue = satoko_add_clause( p->pSat2, &Lit, 1 );
+    else if ( p->pSat3 )
+        RetValue = bmcg_sat_solver_addclause( p->pSat3, &Lit, 1 );
+    else if ( p->pSat4 )
+        RetValue = bmcg2_sat_port_addclause( p->pSat4, &Lit, 1 );
+    else
+        RetValue = sat_solver_addclause( p->pSat, &Lit, &Lit + 1 );
+    assert( RetValue );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the clause received from another engine to one frame.]
+
+  Description [The clause is given as literals of the flops. Returns 1
+  if the clause was added and 0 if it is satisfied by the constants.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Saig_ManBmcAddLemma( Gia_ManBmc_t * p, int * pLits, int nLits, int iFrame )
+{
+    int i, Lit;
+    assert( iFrame > 0 );
+    Vec_IntClear( p->vClause );
+    for ( i = 0; i < nLits; i++ )
+    {
+        Lit = Saig_ManBmcCreateCnf( p, Saig_ManLo(p->pAig, Abc_Lit2Var(pLits[i])), iFrame );
+        Lit = Abc_LitNotCond( Lit, Abc_LitIsCompl(pLits[i]) );
+        if ( Lit == 1 )
+            return 0;
+        if ( Lit != 0 )
+            Vec_IntPush( p->vClause, Lit );
+    }
+    // the clause holds in the reachable states, so it cannot be empty
+    assert( Vec_IntSize(p->vClause) > 0 );
+    if ( p->pSat2 )
+        satoko_add_clause( p->pSat2, Vec_IntArray(p->vClause), Vec_IntSize(p->vClause) );
+    else if ( p->pSat3 )
+        bmcg_sat_solver_addclause( p->pSat3, Vec_IntArray(p->vClause), Vec_IntSize(p->vClause) );
+    else if ( p->pSat4 )
+        bmcg2_sat_port_addclause( p->pSat4, Vec_IntArray(p->vClause), Vec_IntSize(p->vClause) );
+    else
+        sat_solver_addclause( p->pSat, Vec_IntArray(p->vClause), Vec_IntLimit(p->vClause) );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the messages of other engines before a new frame.]
+
+  Description [A clause that holds in frame k is added to the frames
+  from 1 to k already unrolled and is kept for the frames to come.
+  Also updates the last frame known to have no counter-example.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_ManBmcReadMbox( Gia_ManBmc_t * p, int iFrame )
+{
+    Abc_Mbox_t * pMbox = (Abc_Mbox_t *)p->pPars->pMbox;
+    int Type, Sender, Value, nData, * pData;
+    int i, k = 0, f, Level, Size;
+    // add the stored clauses to the new frame
+    for ( i = 0; i < Vec_IntSize(p->vLemmas); i += 2 + Size )
+    {
+        Level = Vec_IntEntry( p->vLemmas, i );
+        Size  = Vec_IntEntry( p->vLemmas, i+1 );
+        if ( iFrame > 0 )
+            p->nLemmas += Saig_ManBmcAddLemma( p, Vec_IntEntryP(p->vLemmas, i+2), Size, iFrame );
+        if ( Level <= iFrame )
+            continue;
+        memmove( Vec_IntEntryP(p->vLemmas, k), Vec_IntEntryP(p->vLemmas, i), sizeof(int) * (2 + Size) );
+        k += 2 + Size;
+    }
+    Vec_IntShrink( p->vLemmas, k );
+    // read the new messages
+    while ( (nData = Abc_MboxRead(pMbox, &p->iMboxCursor, &Type, &Sender, &Value, &pData)) >= 0 )
+    {
+        if ( Sender == p->pPars->MboxId )
+            continue;
+        if ( Type == ABC_MBOX_DEPTH )
+            p->iFrameSafe = Abc_MaxInt( p->iFrameSafe, Value );
+        else if ( Type == ABC_MBOX_LEMMA && nData > 0 )
+        {
+            for ( f = 1; f <= Abc_MinInt(Value, iFrame); f++ )
+                p->nLemmas += Saig_ManBmcAddLemma( p, pData, nData, f );
+            if ( Value <= iFrame )
+                continue;
+            Vec_IntPush( p->vLemmas, Value );
+            Vec_IntPush( p->vLemmas, nData );
+            Vec_IntPushArray( p->vLemmas, pData, nData );
+        }
+    }
+}
+
 /**Function*************************************************************
 
   Synopsis    [Bounded model checking engine.]
@@ -1471,6 +1635,7 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
     abctime clk, clk2, clkSatRun, clkOther = 0, clkTotal = Abc_Clock();
     abctime nTimeUnsat = 0, nTimeSat = 0, nTimeUndec = 0, clkOne = 0;
     abctime nTimeToStopNG, nTimeToStop;
+    Vec_Int_t * vMapping = NULL, * vDepths = NULL;
     if ( pPars->pLogFileName )
         pLogFile = fopen( pPars->pLogFileName, "wb" );
     if ( pPars->nTimeOutOne && pPars->nTimeOut == 0 )
@@ -1479,9 +1644,13 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
         pPars->nTimeOutOne = 0;
     nTimeToStopNG = pPars->nTimeOut ? pPars->nTimeOut * CLOCKS_PER_SEC + Abc_Clock(): 0;
     nTimeToStop   = Saig_ManBmcTimeToStop( pPars, nTimeToStopNG );
+    // read the unrolling data and the proved depths of the previous runs
+    if ( pPars->pCacheFileName && !Saig_ManBmcCacheRead( pPars->pCacheFileName, pAig, &vMapping, &vDepths ) )
+        vDepths = Vec_IntStartFull( Saig_ManPoNum(pAig) );
     // create BMC manager
-    p = Saig_Bmc3ManStart( pAig, pPars->nTimeOutOne, pPars->nConfLimit, pPars->fUseSatoko, pPars->fUseGlucose );
+    p = Saig_Bmc3ManStart( pAig, vMapping, pPars->nTimeOutOne, pPars->nConfLimit, pPars->fUseSatoko, pPars->fUseGlucose, pPars->nThreads );
     p->pPars = pPars;
+    p->vDepths = vDepths;
     if ( p->pSat )
     {
         p->pSat->nLearntStart = p->pPars->nLearnedStart;
@@ -1497,6 +1666,11 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
 //        satoko_set_runid(p->pSat3, p->pPars->RunId);
 //        satoko_set_stop_func(p->pSat3, p->pPars->pFuncStop);
     }
+    else if ( p->pSat4 )
+    {
+        bmcg2_sat_port_set_runid( p->pSat4, p->pPars->RunId );
+        bmcg2_sat_port_set_stop_func( p->pSat4, p->pPars->pFuncStop );
+    }
     else
     {
         satoko_set_runid(p->pSat2, p->pPars->RunId);
@@ -1511,6 +1685,8 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
             Aig_ManNodeNum(pAig), Aig_ManLevelNum(pAig), p->nObjNums );//, Vec_VecSize(p->vSects) );
         Abc_Print( 1, "Params: FramesMax = %d. Start = %d. ConfLimit = %d. TimeOut = %d. SolveAll = %d.\n", 
             pPars->nFramesMax, pPars->nStart, pPars->nConfLimit, pPars->nTimeOut, pPars->fSolveAll );
+        if ( vMapping )
+            Abc_Print( 1, "Using cache \"%s\". All outputs are proved up to frame %d.\n", pPars->pCacheFileName, Vec_IntFindMin(vDepths) );
     } 
     pPars->nFramesMax = pPars->nFramesMax ? pPars->nFramesMax : ABC_INFINITY;
     // set runtime limit
@@ -1520,6 +1696,8 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
             satoko_set_runtime_limit( p->pSat2, nTimeToStop );
         else if ( p->pSat3 )
             bmcg_sat_solver_set_runtime_limit( p->pSat3, nTimeToStop );
+        else if ( p->pSat4 )
+            bmcg2_sat_port_set_runtime_limit( p->pSat4, nTimeToStop );
         else
             sat_solver_set_runtime_limit( p->pSat, nTimeToStop );
     }
@@ -1549,6 +1727,9 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
         // consider the next timeframe
         if ( (RetValue == -1 || pPars->fSolveAll) && pPars->nStart == 0 && !nJumpFrame )
             pPars->iFrame = f-1;
+        // tell other engines that the previous frame has no CEX
+        if ( pPars->pMbox && !pPars->fSolveAll && RetValue == -1 && pPars->nStart == 0 && !nJumpFrame && f-1 > p->iFrameSafe )
+            Abc_MboxPost( (Abc_Mbox_t *)pPars->pMbox, ABC_MBOX_DEPTH, pPars->MboxId, f-1, NULL, 0 );
         // map nodes of this section
         Vec_PtrPush( p->vId2Var, Vec_IntStartFull(p->nObjNums) );
         Vec_PtrPush( p->vTerInfo, (pInfo = ABC_CALLOC(unsigned, p->nWordNum)) );
@@ -1575,6 +1756,18 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
                 Saig_ManBmcSimInfoSet( pInfo, pObj, SAIG_TER_ZER );
             }
         }
+        // import clauses from other engines and skip the frames they proved
+        if ( pPars->pMbox )
+        {
+            Saig_ManBmcReadMbox( p, f );
+            // the frames proved by other engines are proved for all outputs
+            if ( p->vDepths )
+                for ( k = 0; k < Vec_IntSize(p->vDepths); k++ )
+                    if ( Vec_IntEntry(p->vDepths, k) < p->iFrameSafe )
+                        Vec_IntWriteEntry( p->vDepths, k, p->iFrameSafe );
+            if ( !pPars->fSolveAll && f <= p->iFrameSafe )
+                continue;
+        }
         if ( (pPars->nStart && f < pPars->nStart) || (nJumpFrame && f < nJumpFrame) )
             continue;
         // create CNF upfront
@@ -1602,6 +1795,9 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
                 // skip output whose time has run out
                 if ( p->pTime4Outs && p->pTime4Outs[i] == 0 )
                     continue;
+                // skip output proved in this frame by a previous run
+                if ( p->vDepths && f <= Vec_IntEntry(p->vDepths, i) )
+                    continue;
                 // add constraints for this output
 clk2 = Abc_Clock();
                 Saig_ManBmcCreateCnf( p, pObj, f );
@@ -1638,6 +1834,14 @@ clkOther += Abc_Clock() - clk2;
             // skip output whose time has run out
             if ( p->pTime4Outs && p->pTime4Outs[i] == 0 )
                 continue;
+            // assert that the output proved in this frame by a previous run is 0
+            if ( p->vDepths && f <= Vec_IntEntry(p->vDepths, i) )
+            {
+clk2 = Abc_Clock();
+                Saig_ManBmcAddProved( p, Saig_ManBmcCreateCnf(p, pObj, f) );
+clkOther += Abc_Clock() - clk2;
+                continue;
+            }
             // add constraints for this output
 clk2 = Abc_Clock();
             Lit = Saig_ManBmcCreateCnf( p, pObj, f );
@@ -1653,6 +1857,8 @@ clkOther += Abc_Clock() - clk2;
                     satoko_set_runtime_limit( p->pSat2, p->pTime4Outs[i] + Abc_Clock() );
                 else if ( p->pSat3 )
                     bmcg_sat_solver_set_runtime_limit( p->pSat3, p->pTime4Outs[i] + Abc_Clock() );
+                else if ( p->pSat4 )
+                    bmcg2_sat_port_set_runtime_limit( p->pSat4, p->pTime4Outs[i] + Abc_Clock() );
                 else
                     sat_solver_set_runtime_limit( p->pSat, p->pTime4Outs[i] + Abc_Clock() );
             }
@@ -1674,6 +1880,8 @@ clkSatRun = Abc_Clock() - clk2;
             if ( status == l_False )
             {
 nTimeUnsat += clkSatRun;
+                if ( p->vDepths && Vec_IntEntry(p->vDepths, i) == f-1 )
+                    Vec_IntWriteEntry( p->vDepths, i, f );
                 if ( Lit != 0 )
                 {
                     // add final unit clause
@@ -1682,6 +1890,8 @@ nTimeUnsat += clkSatRun;
                         status = satoko_add_clause( p->pSat2, &Lit, 1 );
                     else if ( p->pSat3 )
                         status = bmcg_sat_solver_addclause( p->pSat3, &Lit, 1 );
+                    else if ( p->pSat4 )
+                        status = bmcg2_sat_port_addclause( p->pSat4, &Lit, 1 );
                     else
                         status = sat_solver_addclause( p->pSat, &Lit, &Lit + 1 );
                     assert( status );
@@ -1713,12 +1923,12 @@ nTimeSat += clkSatRun;
                     {
                         Abc_Print( 1, "%4d %s : ", f,  fUnfinished ? "-" : "+" );
                         Abc_Print( 1, "Var =%8.0f. ",  (double)p->nSatVars );
-                        Abc_Print( 1, "Cla =%9.0f. ",  (double)(p->pSat ? p->pSat->stats.clauses   : p->pSat3 ? bmcg_sat_solver_clausenum(p->pSat3)   : satoko_clausenum(p->pSat2)) );
-                        Abc_Print( 1, "Conf =%7.0f. ", (double)(p->pSat ? p->pSat->stats.conflicts : p->pSat3 ? bmcg_sat_solver_conflictnum(p->pSat3) : satoko_conflictnum(p->pSat2)) );
+                        Abc_Print( 1, "Cla =%9.0f. ",  (double)(p->pSat ? p->pSat->stats.clauses   : p->pSat3 ? bmcg_sat_solver_clausenum(p->pSat3) : p->pSat4 ? bmcg2_sat_port_clausenum(p->pSat4) : satoko_clausenum(p->pSat2)) );
+                        Abc_Print( 1, "Conf =%7.0f. ", (double)(p->pSat ? p->pSat->stats.conflicts : p->pSat3 ? bmcg_sat_solver_conflictnum(p->pSat3) : p->pSat4 ? bmcg2_sat_port_conflictnum(p->pSat4) : satoko_conflictnum(p->pSat2)) );
 //                        Abc_Print( 1, "Imp =%10.0f. ", (double)p->pSat->stats.propagations );
 //                        Abc_Print( 1, "Uni =%7.0f. ",(double)(p->pSat ? sat_solver_count_assigned(p->pSat) : 0) );
 //                        ABC_PRT( "Time", Abc_Clock() - clk );
-                        Abc_Print( 1, "Learn =%7.0f. ", (double)(p->pSat ? p->pSat->stats.learnts : p->pSat3 ? bmcg_sat_solver_learntnum(p->pSat3) : satoko_learntnum(p->pSat2)) );
+                        Abc_Print( 1, "Learn =%7.0f. ", (double)(p->pSat ? p->pSat->stats.learnts : p->pSat3 ? bmcg_sat_solver_learntnum(p->pSat3) : p->pSat4 ? bmcg2_sat_port_learntnum(p->pSat4) : satoko_learntnum(p->pSat2)) );
                         Abc_Print( 1, "%4.0f MB",      4.25*(f+1)*p->nObjNums /(1<<20) );
                         Abc_Print( 1, "%4.0f MB",      1.0*(p->pSat ? sat_solver_memory(p->pSat) : 0)/(1<<20) );
                         Abc_Print( 1, "%9.2f sec  ",   (float)(Abc_Clock() - clkTotal)/(float)(CLOCKS_PER_SEC) );
@@ -1765,6 +1975,8 @@ nTimeSat += clkSatRun;
                         satoko_set_runtime_limit( p->pSat2, nTimeToStop );
                     else if ( p->pSat3 )
                         bmcg_sat_solver_set_runtime_limit( p->pSat3, nTimeToStop );
+                    else if ( p->pSat4 )
+                        bmcg2_sat_port_set_runtime_limit( p->pSat4, nTimeToStop );
                     else
                         sat_solver_set_runtime_limit( p->pSat, nTimeToStop );
                 }
@@ -1790,6 +2002,11 @@ nTimeSat += clkSatRun;
                         if ( bmcg_sat_solver_read_cex_varvalue(p->pSat3, lit_var(Lit)) == Abc_LitIsCompl(Lit) )
                             continue;
                     }
+                    else if ( p->pSat4 )
+                    {
+                        if ( bmcg2_sat_port_read_cex_varvalue(p->pSat4, lit_var(Lit)) == Abc_LitIsCompl(Lit) )
+                            continue;
+                    }
                     else
                     {
                         if ( sat_solver_var_value(p->pSat, lit_var(Lit)) == Abc_LitIsCompl(Lit) )
@@ -1833,7 +2050,7 @@ nTimeUndec += clkSatRun;
         }
         if ( pPars->fVerbose ) 
         {
-            if ( fFirst == 1 && f > 0 && (p->pSat ? p->pSat->stats.conflicts : p->pSat3 ? bmcg_sat_solver_conflictnum(p->pSat3) : satoko_conflictnum(p->pSat2)) > 1 )
+            if ( fFirst == 1 && f > 0 && (p->pSat ? p->pSat->stats.conflicts : p->pSat3 ? bmcg_sat_solver_conflictnum(p->pSat3) : p->pSat4 ? bmcg2_sat_port_conflictnum(p->pSat4) : satoko_conflictnum(p->pSat2)) > 1 )
             {
                 fFirst = 0;
 //                Abc_Print( 1, "Outputs of frames up to %d are trivially UNSAT.\n", f );
@@ -1841,11 +2058,11 @@ nTimeUndec += clkSatRun;
             Abc_Print( 1, "%4d %s : ", f, fUnfinished ? "-" : "+" );
             Abc_Print( 1, "Var =%8.0f. ", (double)p->nSatVars );
 //            Abc_Print( 1, "Used =%8.0f. ", (double)sat_solver_count_usedvars(p->pSat) );
-            Abc_Print( 1, "Cla =%9.0f. ", (double)(p->pSat ? p->pSat->stats.clauses   : p->pSat3 ? bmcg_sat_solver_clausenum(p->pSat3)   : satoko_clausenum(p->pSat2))   );
-            Abc_Print( 1, "Conf =%7.0f. ",(double)(p->pSat ? p->pSat->stats.conflicts : p->pSat3 ? bmcg_sat_solver_conflictnum(p->pSat3) : satoko_conflictnum(p->pSat2)) );
+            Abc_Print( 1, "Cla =%9.0f. ", (double)(p->pSat ? p->pSat->stats.clauses   : p->pSat3 ? bmcg_sat_solver_clausenum(p->pSat3) : p->pSat4 ? bmcg2_sat_port_clausenum(p->pSat4) : satoko_clausenum(p->pSat2))   );
+            Abc_Print( 1, "Conf =%7.0f. ",(double)(p->pSat ? p->pSat->stats.conflicts : p->pSat3 ? bmcg_sat_solver_conflictnum(p->pSat3) : p->pSat4 ? bmcg2_sat_port_conflictnum(p->pSat4) : satoko_conflictnum(p->pSat2)) );
 //            Abc_Print( 1, "Imp =%10.0f. ", (double)p->pSat->stats.propagations );
 //            Abc_Print( 1, "Uni =%7.0f. ", (double)(p->pSat ? sat_solver_count_assigned(p->pSat) : 0) );
-            Abc_Print( 1, "Learn =%7.0f. ", (double)(p->pSat ? p->pSat->stats.learnts : p->pSat3 ? bmcg_sat_solver_learntnum(p->pSat3) : satoko_learntnum(p->pSat2)) );
+            Abc_Print( 1, "Learn =%7.0f. ", (double)(p->pSat ? p->pSat->stats.learnts : p->pSat3 ? bmcg_sat_solver_learntnum(p->pSat3) : p->pSat4 ? bmcg2_sat_port_learntnum(p->pSat4) : satoko_learntnum(p->pSat2)) );
             if ( pPars->fSolveAll )
                 Abc_Print( 1, "CEX =%5d. ", pPars->nFailOuts );
             if ( pPars->nTimeOutOne )
@@ -1880,7 +2097,11 @@ finish:
         Abc_Print( 1, "SAT = %.1f sec (%.1f %%)  ",   1.0*nTimeSat/CLOCKS_PER_SEC,   100.0*nTimeSat/(Abc_Clock() - clkTotal)   );
         Abc_Print( 1, "UNDEC = %.1f sec (%.1f %%)",   1.0*nTimeUndec/CLOCKS_PER_SEC, 100.0*nTimeUndec/(Abc_Clock() - clkTotal) );
         Abc_Print( 1, "\n" );
+        if ( p->pSat )
+            Sat_SolverPrintMemory( stdout, p->pSat );
     }
+    if ( pPars->pCacheFileName )
+        Saig_ManBmcCacheWrite( pPars->pCacheFileName, pAig, p->vMapping, p->vDepths );
     Saig_Bmc3ManStop( p );
     fflush( stdout );
     if ( pLogFile )
@@ -46,16 +46,8 @@
 
 
 
-#ifdef ABC_USE_PTHREADS
-
-#ifdef _WIN32
-    #include "../lib/pthread.h"
-#else
-    #include <pthread.h>
-    #include <unistd.h>
-#endif
-
-#endif
+#include "misc/util/utilPool.h"
+#include "misc/util/utilAtomic.h"
 
 
 ABC_NAMESPACE_IMPL_START
@@ -735,75 +727,56 @@ typedef struct Par_ThData_t_
     bmc_sat_solver *  pSat;
     int         iLit;
     int         iThread;
-    int         fWorking;
     int         status;
+    volatile int * pfStopNow;   // the stop flag shared by the solvers
+    volatile int * piWinner;    // the first solver to finish
 } Par_ThData_t;
 
 void * Bmcs_ManWorkerThread( void * pArg )
 {
     Par_ThData_t * pThData = (Par_ThData_t *)pArg;
-    volatile int * pPlace = &pThData->fWorking;
-    while ( 1 )
-    {
-        while ( *pPlace == 0 );
-        assert( pThData->fWorking );
-        if ( pThData->pSat == NULL )
-        {
-            pthread_exit( NULL );
-            assert( 0 );
-            return NULL;
-        }
-
-        pThData->status = bmc_sat_solver_solve( pThData->pSat, &pThData->iLit, 1 );
-
-        //printf( "Thread %d finished with status %d\n", pThData->iThread, pThData->status );
-
-        pThData->fWorking = 0;
-    }
-    assert( 0 );
+    pThData->status = bmc_sat_solver_solve( pThData->pSat, &pThData->iLit, 1 );
+    //printf( "Thread %d finished with status %d\n", pThData->iThread, pThData->status );
+    // the first solver to finish stops the others
+    if ( Abc_AtomicCasInt( pThData->piWinner, -1, pThData->iThread ) )
+        Abc_AtomicStoreInt( pThData->pfStopNow, 1 );
     return NULL;
 }
 
-int Bmcs_ManPerform_Solve( Bmcs_Man_t * p, int iLit, pthread_t * WorkerThread, Par_ThData_t * ThData, int nProcs, int * pSolver )
+int Bmcs_ManPerform_Solve( Bmcs_Man_t * p, int iLit, Abc_Pool_t * pPool, Par_ThData_t * ThData, int nProcs, int * pSolver )
 {
+    Abc_Task_t * pTasks[PAR_THR_MAX];
+    volatile int iWinner = -1;
     int i, status = -1;
-    // set new problem
+    // start solvers on a new problem; they run as background tasks,
+    // so that the waiting thread never executes one of them itself
     for ( i = 0; i < nProcs; i++ )
     {
         ThData[i].iLit = iLit;
-        assert( ThData[i].fWorking == 0 );
+        ThData[i].status = -1;
+        ThData[i].pfStopNow = (volatile int *)&p->fStopNow;
+        ThData[i].piWinner = &iWinner;
+        pTasks[i] = Abc_TaskStartBackground( pPool, Bmcs_ManWorkerThread, (void *)(ThData + i) );
     }
-    // start solvers on a new problem
+    // wait for the first solver to finish; it has already set the stop request
+    i = Abc_TaskWaitAny( pTasks, nProcs );
+    assert( i >= 0 && i < nProcs );
+    // the solvers that did not start are not needed
     for ( i = 0; i < nProcs; i++ )
-        ThData[i].fWorking = 1;
-    // check if any of the solvers finished
-    while ( i == nProcs )
-    {
-        for ( i = 0; i < nProcs; i++ )
-        {
-            if ( ThData[i].fWorking )
-                continue;
-            // set stop request
-            p->fStopNow = 1;
-            // remember status
-            status = ThData[i].status;
-            //printf( "Solver %d returned status %d.\n", i, status );
-            *pSolver = i;
-            break;
-        }
-    }
-    // wait till threads finish
-    while ( i < nProcs )
-    {
-        for ( i = 0; i < nProcs; i++ )
-            if ( ThData[i].fWorking )
-                break;
-    }
+        Abc_TaskCancel( pTasks[i] );
+    // wait till the running solvers finish
     for ( i = 0; i < nProcs; i++ )
     {
+        Abc_TaskWait( pTasks[i] );
+        Abc_TaskFree( pTasks[i] );
         ThData[i].iLit = -1;
-        assert( ThData[i].fWorking == 0 );
     }
+    // remember status of the winner
+    i = iWinner;
+    assert( i >= 0 && i < nProcs );
+    status = ThData[i].status;
+    //printf( "Solver %d returned status %d.\n", i, status );
+    *pSolver = i;
     // reset stop request
     p->fStopNow = 0;
     return status;
@@ -812,20 +785,18 @@ int Bmcs_ManPerform_Solve( Bmcs_Man_t * p, int iLit, pthread_t * WorkerThread, P
 int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
 {
     abctime clkStart = Abc_Clock();
-    pthread_t WorkerThread[PAR_THR_MAX];
+    Abc_Pool_t * pPool = Abc_PoolStart( pPars->nProcs ); // one worker per solver
     Par_ThData_t ThData[PAR_THR_MAX];
     Bmcs_Man_t * p = Bmcs_ManStart( pGia, pPars );
     int f, k = 0, i = Gia_ManPoNum(pGia), status, RetValue = -1, nClauses = 0, Solver = 0;
     Abc_CexFreeP( &pGia->pCexSeq );
-    // start threads
+    // prepare solver data
     for ( i = 0; i < pPars->nProcs; i++ )
     {
         ThData[i].pSat     = p->pSats[i];
         ThData[i].iLit     = -1;
         ThData[i].iThread  =  i;
-        ThData[i].fWorking =  0;
         ThData[i].status   = -1;
-        status = pthread_create( WorkerThread + i, NULL, Bmcs_ManWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
     }
     // solve properties in each timeframe
     for ( f = 0; !pPars->nFramesMax || f < pPars->nFramesMax; f += pPars->nFramesAdd )
@@ -857,7 +828,7 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
                 int iLit = Abc_Var2Lit( Vec_IntEntry(&p->vFr2Sat, iObj), 0 );
                 if ( pPars->nTimeOut && (Abc_Clock() - clkStart)/CLOCKS_PER_SEC >= pPars->nTimeOut )
                     break;
-                status = Bmcs_ManPerform_Solve( p, iLit, WorkerThread, ThData, pPars->nProcs, &Solver );
+                status = Bmcs_ManPerform_Solve( p, iLit, pPool, ThData, pPars->nProcs, &Solver );
                 p->timeSat += Abc_Clock() - clk;
                 if ( status == l_False ) // unsat
                 {
@@ -892,19 +863,13 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
         if ( k < pPars->nFramesAdd )
             break;
     }
-    // stop threads
-    for ( i = 0; i < pPars->nProcs; i++ )
-    {
-        assert( !ThData[i].fWorking );
-        ThData[i].pSat = NULL;
-        ThData[i].fWorking = 1;
-    }
     p->timeOth = Abc_Clock() - clkStart - p->timeUnf - p->timeCnf - p->timeSat;
     if ( RetValue == -1 && !pPars->fNotVerbose )
         printf( "No output failed in %d frames.  ", f + (k < pPars->nFramesAdd ? k+1 : 0) );
     Abc_PrintTime( 1, "Time", Abc_Clock() - clkStart );
     Bmcs_ManPrintTime( p );
     Bmcs_ManStop( p );
+    Abc_PoolStop( pPool );
     return RetValue;
 }
 
@@ -0,0 +1,255 @@
+/**CFile****************************************************************
+
+  FileName    [bmcCache.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT-based bounded model checking.]
+
+  Synopsis    [On-disk cache of the unrolling data used by bmc3.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: bmcCache.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "bmc.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The cache file stores the data that bmc3 derives from the AIG before
+// unrolling it, together with the outcome of the previous runs:
+//   - the header (magic string, version, AIG hash, object and output counts,
+//     size and hash of the data)
+//   - the cut mapping with the truth tables of the cuts, which serve as the
+//     clause templates instantiated in each time frame
+//   - for each output, the last frame such that the output is proved to be
+//     unsatisfiable in all frames up to this one (-1 if none)
+// The AIG hash depends on the object IDs, so the mapping can be reused as is.
+// The cache is not used if the data does not match its hash or if the
+// mapping does not fit the AIG.
+
+#define BMC_CACHE_MAGIC   "ABCBMC3C"
+#define BMC_CACHE_VERSION 2
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the structural hash of the AIG.]
+
+  Description [The hash depends on the object IDs and the fanins.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline word Saig_ManBmcCacheMix( word Hash, int Value )
+{
+    Hash ^= (word)(unsigned)Value;
+    return Hash * ABC_CONST(0x100000001b3);
+}
+word Saig_ManBmcCacheHash( Aig_Man_t * p )
+{
+    Aig_Obj_t * pObj;
+    word Hash = ABC_CONST(0xcbf29ce484222325);
+    int i;
+    Hash = Saig_ManBmcCacheMix( Hash, Aig_ManCiNum(p) );
+    Hash = Saig_ManBmcCacheMix( Hash, Aig_ManCoNum(p) );
+    Hash = Saig_ManBmcCacheMix( Hash, Aig_ManRegNum(p) );
+    Hash = Saig_ManBmcCacheMix( Hash, Aig_ManObjNumMax(p) );
+    Aig_ManForEachObj( p, pObj, i )
+    {
+        Hash = Saig_ManBmcCacheMix( Hash, i );
+        Hash = Saig_ManBmcCacheMix( Hash, pObj->Type );
+        if ( Aig_ObjFanin0(pObj) )
+            Hash = Saig_ManBmcCacheMix( Hash, Abc_Var2Lit(Aig_ObjFaninId0(pObj), Aig_ObjFaninC0(pObj)) );
+        if ( Aig_ObjFanin1(pObj) )
+            Hash = Saig_ManBmcCacheMix( Hash, Abc_Var2Lit(Aig_ObjFaninId1(pObj), Aig_ObjFaninC1(pObj)) );
+    }
+    return Hash;
+}
+static word Saig_ManBmcCacheHashData( Vec_Int_t * vMapping, Vec_Int_t * vDepths )
+{
+    word Hash = ABC_CONST(0xcbf29ce484222325);
+    int i, Entry;
+    Vec_IntForEachEntry( vMapping, Entry, i )
+        Hash = Saig_ManBmcCacheMix( Hash, Entry );
+    Vec_IntForEachEntry( vDepths, Entry, i )
+        Hash = Saig_ManBmcCacheMix( Hash, Entry );
+    return Hash;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks that the mapping read from the cache fits the AIG.]
+
+  Description [Each mapped node should point to a record of five entries
+  (the truth table and four fanins padded with -1) inside the array. The
+  fanins should be the objects preceding the node.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Saig_ManBmcCacheCheckMapping( Aig_Man_t * p, Vec_Int_t * vMapping )
+{
+    Aig_Obj_t * pObj;
+    int i, k, Offset, * pData, nObjs = Aig_ManObjNumMax(p);
+    if ( (Vec_IntSize(vMapping) - nObjs) % 5 )
+        return 0;
+    for ( i = 0; i < nObjs; i++ )
+    {
+        Offset = Vec_IntEntry( vMapping, i );
+        if ( Offset == 0 )
+            continue;
+        pObj = Aig_ManObj( p, i );
+        if ( pObj == NULL || !Aig_ObjIsNode(pObj) || Offset < nObjs || Offset > Vec_IntSize(vMapping) - 5 || (Offset - nObjs) % 5 )
+            return 0;
+        pData = Vec_IntEntryP( vMapping, Offset );
+        for ( k = 0; k < 4 && pData[k+1] >= 0; k++ )
+            if ( pData[k+1] >= i || Aig_ManObj(p, pData[k+1]) == NULL )
+                return 0;
+        for ( ; k < 4; k++ )
+            if ( pData[k+1] != -1 )
+                return 0;
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the cache.]
+
+  Description [Returns 1 if the file exists, was written for this AIG,
+  and its data is not corrupted. In this case, returns the mapping and
+  the proved depths of the outputs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Saig_ManBmcCacheReadInts( FILE * pFile, int * pInts, int nInts )
+{
+    return (int)fread( pInts, sizeof(int), (size_t)nInts, pFile ) == nInts;
+}
+int Saig_ManBmcCacheRead( char * pFileName, Aig_Man_t * pAig, Vec_Int_t ** pvMapping, Vec_Int_t ** pvDepths )
+{
+    Vec_Int_t * vMapping = NULL, * vDepths = NULL;
+    char pMagic[8];
+    word Hash, DataHash;
+    int pHead[4], nMapping, Depth, i;
+    FILE * pFile = fopen( pFileName, "rb" );
+    *pvMapping = *pvDepths = NULL;
+    if ( pFile == NULL )
+        return 0;
+    if ( fread(pMagic, 1, 8, pFile) != 8 || memcmp(pMagic, BMC_CACHE_MAGIC, 8) )
+        goto fail;
+    if ( !Saig_ManBmcCacheReadInts(pFile, pHead, 1) || pHead[0] != BMC_CACHE_VERSION )
+        goto fail;
+    if ( fread(&Hash, sizeof(word), 1, pFile) != 1 || Hash != Saig_ManBmcCacheHash(pAig) )
+        goto fail;
+    if ( !Saig_ManBmcCacheReadInts(pFile, pHead, 3) || pHead[0] != Aig_ManObjNumMax(pAig) || pHead[1] != Saig_ManPoNum(pAig) )
+        goto fail;
+    nMapping = pHead[2];
+    if ( nMapping < Aig_ManObjNumMax(pAig) || fread(&DataHash, sizeof(word), 1, pFile) != 1 )
+        goto fail;
+    vMapping = Vec_IntStart( nMapping );
+    vDepths  = Vec_IntStart( Saig_ManPoNum(pAig) );
+    if ( !Saig_ManBmcCacheReadInts(pFile, Vec_IntArray(vMapping), nMapping) )
+        goto fail;
+    if ( !Saig_ManBmcCacheReadInts(pFile, Vec_IntArray(vDepths), Saig_ManPoNum(pAig)) )
+        goto fail;
+    if ( Saig_ManBmcCacheHashData(vMapping, vDepths) != DataHash || !Saig_ManBmcCacheCheckMapping(pAig, vMapping) )
+        goto fail;
+    Vec_IntForEachEntry( vDepths, Depth, i )
+        if ( Depth < -1 )
+            goto fail;
+    fclose( pFile );
+    *pvMapping = vMapping;
+    *pvDepths  = vDepths;
+    return 1;
+fail:
+    Vec_IntFreeP( &vMapping );
+    Vec_IntFreeP( &vDepths );
+    fclose( pFile );
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the cache.]
+
+  Description [The data is written into a temporary file, which then
+  replaces the cache, so that an interrupted run does not leave behind
+  a partially written cache. On POSIX systems, rename() replaces the
+  cache atomically. On Windows, rename() fails if the target exists,
+  so the old cache is removed first.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Saig_ManBmcCacheWrite( char * pFileName, Aig_Man_t * pAig, Vec_Int_t * vMapping, Vec_Int_t * vDepths )
+{
+    char * pFileTemp = ABC_ALLOC( char, strlen(pFileName) + 5 );
+    word Hash = Saig_ManBmcCacheHash( pAig );
+    word DataHash = Saig_ManBmcCacheHashData( vMapping, vDepths );
+    int pHead[4] = { BMC_CACHE_VERSION, Aig_ManObjNumMax(pAig), Saig_ManPoNum(pAig), Vec_IntSize(vMapping) };
+    int RetValue = 1;
+    FILE * pFile;
+    assert( Vec_IntSize(vDepths) == Saig_ManPoNum(pAig) );
+    sprintf( pFileTemp, "%s.tmp", pFileName );
+    pFile = fopen( pFileTemp, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open file \"%s\" for writing.\n", pFileTemp );
+        ABC_FREE( pFileTemp );
+        return 0;
+    }
+    RetValue &= fwrite( BMC_CACHE_MAGIC, 1, 8, pFile ) == 8;
+    RetValue &= fwrite( pHead, sizeof(int), 1, pFile ) == 1;
+    RetValue &= fwrite( &Hash, sizeof(word), 1, pFile ) == 1;
+    RetValue &= fwrite( pHead + 1, sizeof(int), 3, pFile ) == 3;
+    RetValue &= fwrite( &DataHash, sizeof(word), 1, pFile ) == 1;
+    RetValue &= (int)fwrite( Vec_IntArray(vMapping), sizeof(int), (size_t)Vec_IntSize(vMapping), pFile ) == Vec_IntSize(vMapping);
+    RetValue &= (int)fwrite( Vec_IntArray(vDepths), sizeof(int), (size_t)Vec_IntSize(vDepths), pFile ) == Vec_IntSize(vDepths);
+    RetValue &= fclose( pFile ) == 0;
+    if ( RetValue )
+    {
+#ifdef _WIN32
+        remove( pFileName );
+#endif
+        RetValue = rename( pFileTemp, pFileName ) == 0;
+    }
+    if ( !RetValue )
+    {
+        printf( "Cannot write the BMC cache into file \"%s\".\n", pFileName );
+        remove( pFileTemp );
+    }
+    ABC_FREE( pFileTemp );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -23,6 +23,9 @@
 #include "misc/extra/extra.h"
 #include "aig/gia/giaAig.h"
 #include "aig/ioa/ioa.h"
+#include "proof/pdr/pdr.h"
+#include "misc/util/utilPool.h"
+#include "misc/util/utilTruth.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -31,6 +34,19 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define BMC_MUL_SIG  4   // the number of words in the cone signature
+
+typedef struct Bmc_MulJob_t_ Bmc_MulJob_t;
+struct Bmc_MulJob_t_
+{
+    Bmc_MulPar_t *   pPars;      // parameters
+    Aig_Man_t *      pAig;       // the cones of the outputs in the cluster
+    int              iClu;       // the cluster
+    int              TimeOut;    // the time budget in seconds
+    Vec_Int_t *      vStatus;    // the status of each output (1 = unsat; 0 = sat; -1 = undec)
+    abctime          clkTotal;   // the runtime
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -276,15 +292,359 @@ Vec_Ptr_t * Gia_ManMultiProveAig( Aig_Man_t * p, Bmc_MulPar_t * pPars )
     Aig_ManStop( p );
     return vCexes;
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Groups the outputs into clusters with overlapping cones.]
+
+  Description [Each object gets a signature of the combinational inputs
+  in its cone. The outputs are assigned greedily to the cluster whose
+  signature is the most similar, while a new cluster is opened if the
+  similarity is below one half and the number of clusters allows.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline word * Bmc_MulSig( Vec_Wrd_t * vSigs, int i ) { return Vec_WrdEntryP( vSigs, BMC_MUL_SIG * i ); }
+Vec_Wec_t * Gia_ManMultiCluster( Gia_Man_t * p, Vec_Int_t * vOuts, int nClustSize )
+{
+    Vec_Wrd_t * vSigs = Vec_WrdStart( BMC_MUL_SIG * Gia_ManObjNum(p) );
+    Vec_Wrd_t * vClus = Vec_WrdAlloc( 100 );
+    Vec_Wec_t * vRes  = Vec_WecAlloc( 100 );
+    int nClusMax = (Vec_IntSize(vOuts) + nClustSize - 1) / nClustSize;
+    int i, k, c, iOut, Id, iBest, nAnd, nOr, nAndBest, nOrBest;
+    Gia_Obj_t * pObj;
+    word * pSig, * pSig0, * pSig1;
+    Gia_ManForEachCi( p, pObj, i )
+    {
+        Id = Gia_ObjCioId(pObj) % (64 * BMC_MUL_SIG);
+        Abc_InfoSetBit( (unsigned *)Bmc_MulSig(vSigs, Gia_ObjId(p, pObj)), Id );
+    }
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        pSig  = Bmc_MulSig( vSigs, i );
+        pSig0 = Bmc_MulSig( vSigs, Gia_ObjFaninId0(pObj, i) );
+        pSig1 = Bmc_MulSig( vSigs, Gia_ObjFaninId1(pObj, i) );
+        for ( k = 0; k < BMC_MUL_SIG; k++ )
+            pSig[k] = pSig0[k] | pSig1[k];
+    }
+    Vec_IntForEachEntry( vOuts, iOut, i )
+    {
+        pSig0 = Bmc_MulSig( vSigs, Gia_ObjFaninId0p(p, Gia_ManPo(p, iOut)) );
+        iBest = -1; nAndBest = 0; nOrBest = 1;
+        for ( c = 0; c < Vec_WecSize(vRes); c++ )
+        {
+            if ( Vec_IntSize(Vec_WecEntry(vRes, c)) >= nClustSize )
+                continue;
+            pSig1 = Vec_WrdEntryP( vClus, BMC_MUL_SIG * c );
+            for ( nAnd = nOr = k = 0; k < BMC_MUL_SIG; k++ )
+            {
+                nAnd += Abc_TtCountOnes( pSig0[k] & pSig1[k] );
+                nOr  += Abc_TtCountOnes( pSig0[k] | pSig1[k] );
+            }
+            if ( iBest == -1 || nAnd * nOrBest > nAndBest * nOr )
+                iBest = c, nAndBest = nAnd, nOrBest = Abc_MaxInt(nOr, 1);
+        }
+        if ( Vec_WecSize(vRes) < nClusMax && (iBest == -1 || 2 * nAndBest < nOrBest) )
+        {
+            iBest = Vec_WecSize(vRes);
+            Vec_WecPushLevel( vRes );
+            for ( k = 0; k < BMC_MUL_SIG; k++ )
+                Vec_WrdPush( vClus, 0 );
+        }
+        assert( iBest >= 0 );
+        Vec_WecPush( vRes, iBest, iOut );
+        pSig1 = Vec_WrdEntryP( vClus, BMC_MUL_SIG * iBest );
+        for ( k = 0; k < BMC_MUL_SIG; k++ )
+            pSig1[k] |= pSig0[k];
+    }
+    Vec_WrdFree( vSigs );
+    Vec_WrdFree( vClus );
+    return vRes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the outputs of one cluster.]
+
+  Description [Runs in a worker thread on a private copy of the cones.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Gia_ManMultiWorker( void * pArg )
+{
+    Bmc_MulJob_t * p = (Bmc_MulJob_t *)pArg;
+    Abc_Cex_t * pCex;
+    abctime clk = Abc_Clock();
+    int i;
+    p->vStatus = Vec_IntStartFull( Saig_ManPoNum(p->pAig) );
+    if ( p->pPars->nEngine == 0 )
+    {
+        Ssw_RarPars_t Pars, * pPars = &Pars;
+        Ssw_RarSetDefaultParams( pPars );
+        pPars->fSolveAll   = 1;
+        pPars->fNotVerbose = 1;
+        pPars->fSilent     = 1;
+        pPars->TimeOut     = p->TimeOut;
+        pPars->nRandSeed   = (p->iClu * 17) % 500;
+        pPars->nWords      = 5;
+        Ssw_RarSimulate( p->pAig, pPars );
+    }
+    else if ( p->pPars->nEngine == 1 )
+    {
+        Saig_ParBmc_t Pars, * pPars = &Pars;
+        Saig_ParBmcSetDefaultParams( pPars );
+        pPars->fSolveAll   = 1;
+        pPars->fNotVerbose = 1;
+        pPars->fSilent     = 1;
+        pPars->fStoreCex   = 1;
+        pPars->nTimeOut    = p->TimeOut;
+        pPars->nTimeOutOne = p->pPars->TimePerOut;
+        Saig_ManBmcScalable( p->pAig, pPars );
+    }
+    else
+    {
+        Pdr_Par_t Pars, * pPars = &Pars;
+        Pdr_ManSetDefaultParams( pPars );
+        pPars->fSolveAll   = 1;
+        pPars->fNotVerbose = 1;
+        pPars->fSilent     = 1;
+        pPars->fStoreCex   = 1;
+        pPars->nTimeOut    = p->TimeOut;
+        pPars->nTimeOutOne = p->pPars->TimePerOut;
+        Pdr_ManSolve( p->pAig, pPars );
+        if ( pPars->vOutMap )
+        {
+            for ( i = 0; i < Vec_IntSize(p->vStatus); i++ )
+                if ( Vec_IntEntry(pPars->vOutMap, i) == 1 )
+                    Vec_IntWriteEntry( p->vStatus, i, 1 );
+            Vec_IntFree( pPars->vOutMap );
+        }
+    }
+    if ( p->pAig->vSeqModelVec )
+        Vec_PtrForEachEntry( Abc_Cex_t *, p->pAig->vSeqModelVec, pCex, i )
+            if ( pCex && i < Vec_IntSize(p->vStatus) )
+                Vec_IntWriteEntry( p->vStatus, i, 0 );
+    p->clkTotal = Abc_Clock() - clk;
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Transfers the CEX of a cone to the original AIG.]
+
+  Description [The cones keep all primary inputs in the original order
+  and a subset of the flops, whose initial values are zero.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Cex_t * Gia_ManMultiCexRemap( Abc_Cex_t * pCex, int nRegs, int iPo )
+{
+    Abc_Cex_t * pNew = Abc_CexAlloc( nRegs, pCex->nPis, pCex->iFrame + 1 );
+    int f, i;
+    pNew->iPo    = iPo;
+    pNew->iFrame = pCex->iFrame;
+    for ( f = 0; f <= pCex->iFrame; f++ )
+        for ( i = 0; i < pCex->nPis; i++ )
+            if ( Abc_InfoHasBit(pCex->pData, pCex->nRegs + pCex->nPis * f + i) )
+                Abc_InfoSetBit( pNew->pData, nRegs + pNew->nPis * f + i );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the outputs in clusters on several threads.]
+
+  Description [Each round groups the unsolved outputs into clusters with
+  overlapping cones and dispatches them to the worker threads, with at
+  most one cluster per thread in flight, so that the cones are extracted
+  just before they are solved. The time budget of a cluster grows from
+  round to round as in the sequential flow. Returns the array of CEXes
+  and sets the status of each output in pPars->vOutMap.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Gia_ManMultiProvePar( Gia_Man_t * p, Bmc_MulPar_t * pPars )
+{
+    char * pEngines[3] = { "sim", "bmc3", "pdr" };
+    Bmc_MulJob_t * pJobs = ABC_CALLOC( Bmc_MulJob_t, pPars->nProcs );
+    Abc_Task_t ** pTasks = ABC_CALLOC( Abc_Task_t *, pPars->nProcs );
+    Abc_Pool_t * pPool = Abc_PoolStart( pPars->nProcs );
+    Vec_Ptr_t * vCexes = Vec_PtrStart( Gia_ManPoNum(p) );
+    Vec_Int_t * vOuts  = Vec_IntAlloc( Gia_ManPoNum(p) ), * vLevel;
+    Vec_Wec_t * vClus;
+    Gia_Man_t * pCone;
+    Gia_Obj_t * pObj;
+    Abc_Cex_t * pCex;
+    abctime clkStart = Abc_ClockWall(), clkRound;
+    abctime nTimeToStop = pPars->TimeOutGlo ? clkStart + pPars->TimeOutGlo * CLOCKS_PER_SEC : 0;
+    int TimeOutLoc = pPars->TimeOutLoc, TimeOut, fTimeOut = 0;
+    int nProved = 0, nFailed = 0, nSolved, nClusDone, Round, i, k, iNext, iOut, nRun;
+    if ( pPars->fVerbose )
+        printf( "MultiProve parameters: Global timeout = %d sec.  Local timeout = %d sec.  Time increase = %d %%.\n", 
+            pPars->TimeOutGlo, pPars->TimeOutLoc, pPars->TimeOutInc );
+    if ( pPars->fVerbose )
+        printf( "Threads = %d. Cluster size = %d. Engine = %s. Per-output timeout = %d msec.\n", 
+            pPars->nProcs, pPars->nClustSize, pEngines[pPars->nEngine], pPars->TimePerOut );
+    // outputs driven by constant 0 are proved
+    Vec_IntFreeP( &pPars->vOutMap );
+    pPars->vOutMap = Vec_IntStartFull( Gia_ManPoNum(p) );
+    Gia_ManForEachPo( p, pObj, i )
+        if ( Gia_ObjFaninLit0p(p, pObj) == 0 )
+            Vec_IntWriteEntry( pPars->vOutMap, i, 1 ), nProved++;
+        else
+            Vec_IntPush( vOuts, i );
+    for ( Round = 0; Round < 1000 && Vec_IntSize(vOuts) > 0 && !fTimeOut; Round++ )
+    {
+        nSolved   = nProved + nFailed;
+        nClusDone = 0;
+        clkRound  = Abc_ClockWall();
+        vClus     = Gia_ManMultiCluster( p, vOuts, pPars->nClustSize );
+        if ( pPars->fVerbose )
+            printf( "Round %d : Solving %d outputs in %d clusters with %d sec per cluster.\n", 
+                Round, Vec_IntSize(vOuts), Vec_WecSize(vClus), TimeOutLoc );
+        for ( iNext = nRun = 0; iNext < Vec_WecSize(vClus) || nRun > 0; )
+        {
+            // dispatch clusters while there are idle threads
+            for ( k = 0; k < pPars->nProcs && iNext < Vec_WecSize(vClus) && !fTimeOut; k++ )
+            {
+                if ( pTasks[k] )
+                    continue;
+                TimeOut = TimeOutLoc;
+                if ( nTimeToStop )
+                {
+                    TimeOut = Abc_MinInt( TimeOut, (int)((nTimeToStop - Abc_ClockWall()) / CLOCKS_PER_SEC) );
+                    if ( TimeOut <= 0 )
+                    {
+                        fTimeOut = 1;
+                        break;
+                    }
+                }
+                vLevel = Vec_WecEntry( vClus, iNext );
+                pCone  = Gia_ManDupCones( p, Vec_IntArray(vLevel), Vec_IntSize(vLevel), 0 );
+                memset( pJobs + k, 0, sizeof(Bmc_MulJob_t) );
+                pJobs[k].pPars   = pPars;
+                pJobs[k].pAig    = Gia_ManToAigSimple( pCone );
+                pJobs[k].iClu    = iNext++;
+                pJobs[k].TimeOut = TimeOut;
+                Gia_ManStop( pCone );
+                pTasks[k] = Abc_TaskStartBackground( pPool, Gia_ManMultiWorker, pJobs + k );
+                nRun++;
+            }
+            if ( nRun == 0 )
+                break;
+            // collect the results of the next finished cluster
+            k = Abc_TaskWaitAny( pTasks, pPars->nProcs );
+            assert( k >= 0 );
+            Abc_TaskFree( pTasks[k] );
+            pTasks[k] = NULL;
+            nRun--;
+            nClusDone++;
+            vLevel = Vec_WecEntry( vClus, pJobs[k].iClu );
+            Vec_IntForEachEntry( vLevel, iOut, i )
+            {
+                Vec_IntWriteEntry( pPars->vOutMap, iOut, Vec_IntEntry(pJobs[k].vStatus, i) );
+                if ( Vec_IntEntry(pJobs[k].vStatus, i) == 1 )
+                    nProved++;
+                else if ( Vec_IntEntry(pJobs[k].vStatus, i) == 0 )
+                {
+                    // simulation marks the failed outputs without deriving CEXes
+                    pCex = (Abc_Cex_t *)Vec_PtrEntry( pJobs[k].pAig->vSeqModelVec, i );
+                    if ( pCex == (Abc_Cex_t *)(ABC_PTRINT_T)1 )
+                        Vec_PtrWriteEntry( pJobs[k].pAig->vSeqModelVec, i, NULL );
+                    else
+                        pCex = Gia_ManMultiCexRemap( pCex, Gia_ManRegNum(p), iOut );
+                    Vec_PtrWriteEntry( vCexes, iOut, pCex );
+                    nFailed++;
+                }
+            }
+            if ( pPars->fVeryVerbose )
+            {
+                printf( "Cluster %5d : PO =%6d  FF =%7d  ND =%8d  ", pJobs[k].iClu, 
+                    Saig_ManPoNum(pJobs[k].pAig), Saig_ManRegNum(pJobs[k].pAig), Aig_ManNodeNum(pJobs[k].pAig) );
+                printf( "UNSAT =%6d  SAT =%6d  ", Vec_IntCountEntry(pJobs[k].vStatus, 1), Vec_IntCountEntry(pJobs[k].vStatus, 0) );
+                Abc_PrintTime( 1, "Time", pJobs[k].clkTotal );
+            }
+            if ( pPars->fVerbose )
+            {
+                double Time = 1.0*(Abc_ClockWall() - clkStart)/CLOCKS_PER_SEC;
+                printf( "Clusters =%6d /%6d  Solved =%7d (%5.1f %%)  UNSAT =%7d  SAT =%7d  Rate =%9.2f props/sec  Time =%9.2f sec\r", 
+                    nClusDone, Vec_WecSize(vClus), nProved + nFailed, 100.0*(nProved + nFailed)/Abc_MaxInt(1, Gia_ManPoNum(p)), 
+                    nProved, nFailed, (nProved + nFailed)/Abc_MaxDouble(0.001, Time), Time );
+                fflush( stdout );
+            }
+            Vec_IntFree( pJobs[k].vStatus );
+            Aig_ManStop( pJobs[k].pAig );
+        }
+        if ( pPars->fVerbose )
+            printf( "\n" );
+        Vec_WecFree( vClus );
+        // collect the unsolved outputs
+        k = 0;
+        Vec_IntForEachEntry( vOuts, iOut, i )
+            if ( Vec_IntEntry(pPars->vOutMap, iOut) == -1 )
+                Vec_IntWriteEntry( vOuts, k++, iOut );
+        Vec_IntShrink( vOuts, k );
+        if ( pPars->fVerbose )
+        {
+            printf( "Round %d : Solved %d outputs.  ", Round, nProved + nFailed - nSolved );
+            Abc_PrintTime( 1, "Time", Abc_ClockWall() - clkRound );
+        }
+        if ( fTimeOut || (nTimeToStop && Abc_ClockWall() >= nTimeToStop) )
+        {
+            printf( "Global timeout (%d sec) is reached.\n", pPars->TimeOutGlo );
+            break;
+        }
+        // check gap timeout
+        if ( pPars->TimeOutGap && pPars->TimeOutGap <= TimeOutLoc && nSolved == nProved + nFailed )
+        {
+            printf( "Gap timeout (%d sec) is reached.\n", pPars->TimeOutGap );
+            break;
+        }
+        // increase timeout
+        TimeOutLoc += TimeOutLoc * pPars->TimeOutInc / 100;
+    }
+    if ( pPars->fVerbose )
+    {
+        printf( "Properties = %d.  UNSAT = %d.  SAT = %d.  UNDEC = %d.  ", Gia_ManPoNum(p), nProved, nFailed, Gia_ManPoNum(p) - nProved - nFailed );
+        Abc_PrintTime( 1, "Time", Abc_ClockWall() - clkStart );
+    }
+    Abc_PoolStop( pPool );
+    Vec_IntFree( vOuts );
+    ABC_FREE( pTasks );
+    ABC_FREE( pJobs );
+    return vCexes;
+}
+
 int Gia_ManMultiProve( Gia_Man_t * p, Bmc_MulPar_t * pPars )
 {
     Aig_Man_t * pAig;
     if ( p->vSeqModelVec )
         Vec_PtrFreeFree( p->vSeqModelVec ), p->vSeqModelVec = NULL;
-    pAig = Gia_ManToAig( p, 0 );
-    p->vSeqModelVec = Gia_ManMultiProveAig( pAig, pPars ); // deletes pAig
+    if ( pPars->nProcs > 0 )
+        p->vSeqModelVec = Gia_ManMultiProvePar( p, pPars );
+    else
+    {
+        pAig = Gia_ManToAig( p, 0 );
+        p->vSeqModelVec = Gia_ManMultiProveAig( pAig, pPars ); // deletes pAig
+    }
     assert( Vec_PtrSize(p->vSeqModelVec) == Gia_ManPoNum(p) );
-    return Vec_PtrCountZero(p->vSeqModelVec) == Vec_PtrSize(p->vSeqModelVec) ? -1 : 0;
+    if ( Vec_PtrCountZero(p->vSeqModelVec) < Vec_PtrSize(p->vSeqModelVec) )
+        return 0;
+    if ( pPars->vOutMap && Vec_IntCountEntry(pPars->vOutMap, 1) == Vec_IntSize(pPars->vOutMap) )
+        return 1;
+    return -1;
 }
 
 ////////////////////////////////////////////////////////////////////////
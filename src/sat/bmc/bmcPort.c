@@ -0,0 +1,369 @@
+/**CFile****************************************************************
+
+  FileName    [bmcPort.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT-based bounded model checking.]
+
+  Synopsis    [Portfolio of concurrent engines sharing clauses and bounds.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: bmcPort.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "bmc.h"
+#include "aig/gia/giaAig.h"
+#include "proof/pdr/pdr.h"
+#include "proof/int/int.h"
+#include "misc/util/utilAtomic.h"
+#include "misc/util/utilMbox.h"
+#include "misc/util/utilPool.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// engines of the portfolio
+#define BMC_PORT_PDR    0
+#define BMC_PORT_BMC    1
+#define BMC_PORT_INT    2
+#define BMC_PORT_NUM    3
+
+static char * s_PortNames[BMC_PORT_NUM] = { "pdr", "bmc3", "int" };
+
+typedef struct Bmc_PortEng_t_ Bmc_PortEng_t;
+struct Bmc_PortEng_t_
+{
+    Bmc_PortPar_t *  pPars;      // parameters
+    Aig_Man_t *      pAig;       // the copy of the design with one output
+    Abc_Mbox_t *     pMbox;      // the mailbox (or NULL)
+    int              Engine;     // the engine
+    int              RunId;      // the race of this engine
+    int              RetValue;   // 1 = proved; 0 = failed; -1 = undecided
+    int              iFrame;     // the last frame without CEX
+    int              fWinner;    // this engine stopped the race
+    abctime          clkTotal;   // elapsed time of the engine
+};
+
+// the current race; the engines of the earlier races are stopped
+static volatile int s_nPortRunIds = 0;
+
+// call back procedure for the engines
+int Bmc_PortCallBackToStop( int RunId ) { return RunId < Abc_AtomicLoadInt(&s_nPortRunIds); }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Sets default parameters.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_PortSetDefaultParams( Bmc_PortPar_t * pPars )
+{
+    memset( pPars, 0, sizeof(Bmc_PortPar_t) );
+    pPars->nTimeOut   =     0;  // timeout in seconds for each output
+    pPars->nMboxSize  =    16;  // the mailbox size in megabytes
+    pPars->fUsePdr    =     1;  // run property directed reachability
+    pPars->fUseBmc    =     1;  // run bounded model checking
+    pPars->fUseInt    =     1;  // run interpolation
+    pPars->fUseShare  =     1;  // exchange clauses and bounds
+    pPars->fSolveAll  =     0;  // do not stop when an output fails
+    pPars->fVerbose   =     0;  // verbose output
+    pPars->iFrame     =    -1;  // explored up to this frame
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one engine.]
+
+  Description [The first engine coming back with a definite answer
+  advances the race counter, which stops the other engines.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Bmc_PortWorker( void * pArg )
+{
+    Bmc_PortEng_t * p = (Bmc_PortEng_t *)pArg;
+    abctime clk = Abc_ClockWall();
+    if ( p->Engine == BMC_PORT_PDR )
+    {
+        Pdr_Par_t Pars, * pPars = &Pars;
+        Pdr_ManSetDefaultParams( pPars );
+        pPars->nTimeOut    = p->pPars->nTimeOut;
+        pPars->fNotVerbose = 1;
+        pPars->fSilent     = 1;
+        pPars->RunId       = p->RunId;
+        pPars->pFuncStop   = Bmc_PortCallBackToStop;
+        pPars->pMbox       = p->pMbox;
+        pPars->MboxId      = p->Engine;
+        p->RetValue = Pdr_ManSolve( p->pAig, pPars );
+    }
+    else if ( p->Engine == BMC_PORT_BMC )
+    {
+        Saig_ParBmc_t Pars, * pPars = &Pars;
+        Saig_ParBmcSetDefaultParams( pPars );
+        pPars->nTimeOut    = p->pPars->nTimeOut;
+        pPars->fNotVerbose = 1;
+        pPars->fSilent     = 1;
+        pPars->RunId       = p->RunId;
+        pPars->pFuncStop   = Bmc_PortCallBackToStop;
+        pPars->pMbox       = p->pMbox;
+        pPars->MboxId      = p->Engine;
+        p->RetValue = Saig_ManBmcScalable( p->pAig, pPars );
+        p->iFrame   = pPars->iFrame;
+    }
+    else if ( p->Engine == BMC_PORT_INT )
+    {
+        Inter_ManParams_t Pars, * pPars = &Pars;
+        int iFrame;
+        Inter_ManSetDefaultParams( pPars );
+        pPars->nSecLimit   = p->pPars->nTimeOut;
+        pPars->RunId       = p->RunId;
+        pPars->pFuncStop   = Bmc_PortCallBackToStop;
+        p->RetValue = Inter_ManPerformInterpolation( p->pAig, pPars, &iFrame );
+        // the failure in the initial state is reported without a CEX
+        if ( p->RetValue == 0 && p->pAig->pSeqModel == NULL )
+            p->RetValue = -1;
+    }
+    else assert( 0 );
+    p->clkTotal = Abc_ClockWall() - clk;
+    if ( p->RetValue == 0 || p->RetValue == 1 )
+        p->fWinner = Abc_AtomicCasInt( &s_nPortRunIds, p->RunId, p->RunId + 1 );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Copies the clauses into a new mailbox.]
+
+  Description [The clauses describe the reachable states of the design,
+  rather than the property, so they remain valid for the next output.
+  The bounds are specific to the property and are not copied.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_PortCopyLemmas( Abc_Mbox_t * pOld, Abc_Mbox_t * pNew )
+{
+    int iCursor = 0, Type, Sender, Value, nData, * pData;
+    while ( (nData = Abc_MboxRead(pOld, &iCursor, &Type, &Sender, &Value, &pData)) >= 0 )
+        if ( Type == ABC_MBOX_LEMMA )
+            Abc_MboxPost( pNew, Type, Sender, Value, pData, nData );
+}
+int Bmc_PortReadDepth( Abc_Mbox_t * p )
+{
+    int iCursor = 0, Type, Value, iFrame = -1;
+    while ( Abc_MboxRead(p, &iCursor, &Type, NULL, &Value, NULL) >= 0 )
+        if ( Type == ABC_MBOX_DEPTH )
+            iFrame = Abc_MaxInt( iFrame, Value );
+    return iFrame;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves one output by racing the engines.]
+
+  Description [Returns 1 if proved, 0 if failed (the CEX is returned
+  in ppCex), and -1 if undecided.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_PortSolveOne( Aig_Man_t * pOne, Bmc_PortPar_t * pPars, Abc_Pool_t * pPool, Abc_Mbox_t * pMbox, int iOut, Abc_Cex_t ** ppCex, int * piFrame )
+{
+    Bmc_PortEng_t Engs[BMC_PORT_NUM], * pWin = NULL;
+    Abc_Task_t * pTasks[BMC_PORT_NUM];
+    int fUse[BMC_PORT_NUM] = { pPars->fUsePdr, pPars->fUseBmc, pPars->fUseInt };
+    int k, RunId = Abc_AtomicLoadInt( &s_nPortRunIds ), RetValue = -1;
+    // interpolation needs primary inputs and flops
+    if ( Saig_ManPiNum(pOne) == 0 || Saig_ManRegNum(pOne) == 0 )
+        fUse[BMC_PORT_INT] = 0;
+    // start the engines
+    memset( Engs, 0, sizeof(Engs) );
+    for ( k = 0; k < BMC_PORT_NUM; k++ )
+    {
+        pTasks[k] = NULL;
+        if ( !fUse[k] )
+            continue;
+        Engs[k].pPars    = pPars;
+        Engs[k].pAig     = Aig_ManDupSimple( pOne );
+        Engs[k].pMbox    = pMbox;
+        Engs[k].Engine   = k;
+        Engs[k].RunId    = RunId;
+        Engs[k].RetValue = -1;
+        Engs[k].iFrame   = -1;
+        pTasks[k] = Abc_TaskStartBackground( pPool, Bmc_PortWorker, Engs + k );
+    }
+    // wait till all engines are finished
+    while ( (k = Abc_TaskWaitAny(pTasks, BMC_PORT_NUM)) >= 0 )
+    {
+        Abc_TaskFree( pTasks[k] );
+        pTasks[k] = NULL;
+        if ( Engs[k].fWinner )
+            pWin = Engs + k;
+    }
+    // collect the results
+    *piFrame = Engs[BMC_PORT_BMC].iFrame;
+    if ( pMbox )
+        *piFrame = Abc_MaxInt( *piFrame, Bmc_PortReadDepth(pMbox) );
+    if ( pWin )
+    {
+        RetValue = pWin->RetValue;
+        if ( RetValue == 0 )
+        {
+            *ppCex = pWin->pAig->pSeqModel;  pWin->pAig->pSeqModel = NULL;
+            (*ppCex)->iPo = iOut;
+        }
+    }
+    if ( pPars->fVerbose )
+    {
+        printf( "Output %5d : ", iOut );
+        if ( RetValue == 1 )
+            printf( "Proved by %-4s        ", s_PortNames[pWin->Engine] );
+        else if ( RetValue == 0 )
+            printf( "Failed by %-4s in %4d ", s_PortNames[pWin->Engine], (*ppCex)->iFrame );
+        else
+            printf( "Undecided up to %4d ", *piFrame );
+        for ( k = 0; k < BMC_PORT_NUM; k++ )
+            if ( fUse[k] )
+                printf( "  %s = %6.2f sec", s_PortNames[k], 1.0*((double)(Engs[k].clkTotal))/((double)CLOCKS_PER_SEC) );
+        if ( pMbox )
+            printf( "  Msgs = %d (%d dropped)", Abc_MboxPostNum(pMbox), Abc_MboxDropNum(pMbox) );
+        printf( "\n" );
+    }
+    for ( k = 0; k < BMC_PORT_NUM; k++ )
+        if ( Engs[k].pAig )
+            Aig_ManStop( Engs[k].pAig );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Proves the outputs using a portfolio of engines.]
+
+  Description [For each output, PDR, BMC and interpolation run at the
+  same time. PDR posts the clauses blocking unreachable states and the
+  frames it has proved; BMC adds these clauses to its unrolling, skips
+  the proved frames and posts the frames it has checked. The first
+  definite answer stops the other engines. Returns 1 if all outputs are
+  proved, 0 if some output failed, and -1 otherwise.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_PortPerform( Gia_Man_t * pGia, Bmc_PortPar_t * pPars )
+{
+    abctime clkTotal = Abc_ClockWall();
+    Abc_Pool_t * pPool = Abc_PoolStart( BMC_PORT_NUM );
+    Abc_Mbox_t * pMbox = NULL, * pMboxNew;
+    Aig_Man_t * pAig = Gia_ManToAigSimple( pGia ), * pOne;
+    Abc_Cex_t * pCex;
+    int i, Status, iFrame, nUndecided = 0;
+    assert( Gia_ManRegNum(pGia) > 0 );
+    Abc_CexFreeP( &pGia->pCexSeq );
+    if ( pGia->vSeqModelVec )
+        Vec_PtrFreeFree( pGia->vSeqModelVec ), pGia->vSeqModelVec = NULL;
+    if ( pPars->fSolveAll )
+        pGia->vSeqModelVec = Vec_PtrStart( Gia_ManPoNum(pGia) );
+    Vec_IntFreeP( &pPars->vOutMap );
+    pPars->vOutMap = Vec_IntStartFull( Gia_ManPoNum(pGia) );
+    pPars->nFailOuts = pPars->nProveOuts = 0;
+    pPars->iFrame = ABC_INFINITY;
+    for ( i = 0; i < Saig_ManPoNum(pAig); i++ )
+    {
+        pOne = Aig_ManDupOneOutput( pAig, i, 1 );
+        if ( Aig_ObjChild0(Aig_ManCo(pOne, 0)) == Aig_ManConst0(pOne) )
+        {
+            Aig_ManStop( pOne );
+            Vec_IntWriteEntry( pPars->vOutMap, i, 1 );
+            pPars->nProveOuts++;
+            continue;
+        }
+        // the clauses found for the previous outputs are kept
+        if ( pPars->fUseShare )
+        {
+            pMboxNew = Abc_MboxStart( pPars->nMboxSize << 18 );
+            if ( pMbox )
+            {
+                Bmc_PortCopyLemmas( pMbox, pMboxNew );
+                Abc_MboxStop( pMbox );
+            }
+            pMbox = pMboxNew;
+        }
+        pCex = NULL;
+        Status = Bmc_PortSolveOne( pOne, pPars, pPool, pMbox, i, &pCex, &iFrame );
+        Aig_ManStop( pOne );
+        Vec_IntWriteEntry( pPars->vOutMap, i, Status );
+        if ( Status == 1 )
+            pPars->nProveOuts++;
+        else if ( Status == -1 )
+        {
+            pPars->iFrame = Abc_MinInt( pPars->iFrame, iFrame );
+            nUndecided++;
+        }
+        else
+        {
+            pPars->nFailOuts++;
+            if ( !Gia_ManVerifyCex( pGia, pCex, 0 ) )
+                Abc_Print( 1, "Output %d: The counter-example does not fail the output.\n", i );
+            if ( !pPars->fSolveAll )
+            {
+                pGia->pCexSeq = pCex;
+                break;
+            }
+            Vec_PtrWriteEntry( pGia->vSeqModelVec, i, pCex );
+        }
+    }
+    if ( pPars->iFrame == ABC_INFINITY )
+        pPars->iFrame = -1;
+    if ( pMbox )
+        Abc_MboxStop( pMbox );
+    Abc_PoolStop( pPool );
+    Aig_ManStop( pAig );
+    // report the results
+    if ( pPars->nFailOuts && !pPars->fSolveAll )
+        Abc_Print( 1, "Output %d of miter \"%s\" was asserted in frame %d.  ", pGia->pCexSeq->iPo, pGia->pName, pGia->pCexSeq->iFrame );
+    else if ( nUndecided )
+        Abc_Print( 1, "Proved = %d. Failed = %d. Undecided = %d (no CEX up to frame %d).  ", pPars->nProveOuts, pPars->nFailOuts, nUndecided, pPars->iFrame );
+    else
+        Abc_Print( 1, "Proved = %d. Failed = %d. Undecided = %d.  ", pPars->nProveOuts, pPars->nFailOuts, nUndecided );
+    Abc_PrintTime( 1, "Time", Abc_ClockWall() - clkTotal );
+    if ( pPars->nFailOuts )
+        return 0;
+    return nUndecided ? -1 : 1;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
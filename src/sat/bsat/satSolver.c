@@ -132,6 +132,31 @@ int sat_solver_get_var_value(sat_solver* s, int v)
 static inline int      sat_solver_dl(sat_solver* s)                { return veci_size(&s->trail_lim); }
 static inline veci*    sat_solver_read_wlist(sat_solver* s, lit l) { return &s->wlists[l];            }
 
+// The watch list of a literal contains the two-literal clauses watching it,
+// represented by the other literal (an odd entry), and the larger clauses,
+// represented by the clause handle (an even entry) followed by the blocker,
+// one of the other literals of the clause. If the blocker is true, the clause
+// is satisfied and propagation skips it without reading the clause memory.
+// The capacity of long watch lists grows in units of 64-byte cache lines.
+
+static inline void sat_solver_wlist_grow(veci* v, int nInts)
+{
+    if (v->size + nInts > v->cap) {
+        int newsize = Abc_MaxInt( v->size + nInts, (v->cap < 4) ? 4 : (v->cap / 2) * 3 );
+        if ( newsize > 16 )
+            newsize = (newsize + 15) & ~15;
+        v->ptr = ABC_REALLOC( int, v->ptr, newsize );
+        v->cap = newsize; }
+}
+static inline void     sat_solver_wlist_push(sat_solver* s, lit l, int h, lit blocker)
+{
+    veci* v = sat_solver_read_wlist(s, l);
+    sat_solver_wlist_grow( v, 1 + !clause_is_lit(h) );
+    v->ptr[v->size++] = h;
+    if ( !clause_is_lit(h) )
+        v->ptr[v->size++] = blocker;
+}
+
 //=================================================================================================
 // Variable order functions:
 
@@ -542,8 +567,8 @@ int sat_solver_clause_new(sat_solver* s, lit* begin, lit* end, int learnt)
     // do not allocate memory for the two-literal problem clause
     if ( fUseBinaryClauses && size == 2 && !learnt )
     {
-        veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),(clause_from_lit(begin[1])));
-        veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),(clause_from_lit(begin[0])));
+        sat_solver_wlist_push(s,lit_neg(begin[0]),clause_from_lit(begin[1]),0);
+        sat_solver_wlist_push(s,lit_neg(begin[1]),clause_from_lit(begin[0]),0);
         s->stats.clauses++;
         s->stats.clauses_literals += size;
         return 0;
@@ -585,8 +610,8 @@ int sat_solver_clause_new(sat_solver* s, lit* begin, lit* end, int learnt)
 
     //veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),c);
     //veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),c);
-    veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),(size > 2 ? h : clause_from_lit(begin[1])));
-    veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),(size > 2 ? h : clause_from_lit(begin[0])));
+    sat_solver_wlist_push(s,lit_neg(begin[0]),(size > 2 ? h : clause_from_lit(begin[1])),begin[1]);
+    sat_solver_wlist_push(s,lit_neg(begin[1]),(size > 2 ? h : clause_from_lit(begin[0])),begin[0]);
 
     return h;
 }
@@ -1077,7 +1102,15 @@ int sat_solver_propagate(sat_solver* s)
                 }
             }else{
 
-                clause* c = clause_read(s,*i);
+                clause* c;
+                // If the blocker is true, then clause is already satisfied.
+                if (var_value(s, lit_var(i[1])) == lit_sign(i[1])){
+                    *j++ = *i++;
+                    *j++ = *i++;
+                    continue;
+                }
+
+                c = clause_read(s,*i);
                 lits = clause_begin(c);
 
                 // Make sure the false literal is data[1]:
@@ -1089,8 +1122,10 @@ int sat_solver_propagate(sat_solver* s)
                 assert(lits[1] == false_lit);
 
                 // If 0th watch is true, then clause is already satisfied.
-                if (var_value(s, lit_var(lits[0])) == lit_sign(lits[0]))
+                if (var_value(s, lit_var(lits[0])) == lit_sign(lits[0])){
                     *j++ = *i;
+                    *j++ = lits[0];
+                }
                 else{
                     // Look for new watch:
                     lit* stop = lits + clause_size(c);
@@ -1099,23 +1134,28 @@ int sat_solver_propagate(sat_solver* s)
                         if (var_value(s, lit_var(*k)) != !lit_sign(*k)){
                             lits[1] = *k;
                             *k = false_lit;
-                            veci_push(sat_solver_read_wlist(s,lit_neg(lits[1])),*i);
+                            sat_solver_wlist_push(s,lit_neg(lits[1]),*i,lits[0]);
                             goto next; }
                     }
 
                     *j++ = *i;
+                    *j++ = lits[0];
                     // Clause is unit under assignment:
                     if ( c->lrn )
                         c->lbd = sat_clause_compute_lbd(s, c);
                     if (!sat_solver_enqueue(s,lits[0], *i)){
-                        hConfl = *i++;
+                        hConfl = *i;
+                        i += 2;
                         // Copy the remaining watches:
                         while (i < end)
                             *j++ = *i++;
+                        continue;
                     }
                 }
+            next:
+                i += 2;
+                continue;
             }
-        next:
             i++;
         }
 
@@ -1611,12 +1651,19 @@ void sat_solver_reducedb(sat_solver* s)
             if ( clause_is_lit(pArray[k]) ) // 2-lit clause
                 pArray[j++] = pArray[k];
             else if ( !clause_learnt_h(pMem, pArray[k]) ) // problem clause
+            {
                 pArray[j++] = pArray[k];
+                pArray[j++] = pArray[++k]; // blocker
+            }
             else 
             {
                 c = clause_read(s, pArray[k]);
                 if ( !c->mark ) // useful learned clause
+                {
                    pArray[j++] = clause_id(c); // updating handle here!!!
+                   pArray[j++] = pArray[k+1]; // blocker
+                }
+                k++;
             }
         }
         veci_resize(&s->wlists[i],j);
@@ -1677,8 +1724,11 @@ void sat_solver_rollback( sat_solver* s )
                 if ( clause_read_lit(pArray[k]) < s->iVarPivot*2 )
                     pArray[j++] = pArray[k];
             }
-            else if ( Sat_MemClauseUsed(pMem, pArray[k]) )
-                pArray[j++] = pArray[k];
+            else if ( Sat_MemClauseUsed(pMem, pArray[k++]) )
+            {
+                pArray[j++] = pArray[k-1];
+                pArray[j++] = pArray[k]; // blocker
+            }
         }
         veci_resize(&s->wlists[i],j);
     }
@@ -72,6 +72,7 @@ extern void        sat_solver_set_var_activity(sat_solver* s, int * pVars, int n
 
 extern void        Sat_SolverWriteDimacs( sat_solver * p, char * pFileName, lit* assumptionsBegin, lit* assumptionsEnd, int incrementVars );
 extern void        Sat_SolverPrintStats( FILE * pFile, sat_solver * p );
+extern void        Sat_SolverPrintMemory( FILE * pFile, sat_solver * p );
 extern int *       Sat_SolverGetModel( sat_solver * p, int * pVars, int nVars );
 extern void        Sat_SolverDoubleClauses( sat_solver * p, int iVar );
 
@@ -200,6 +200,48 @@ void Sat_SolverPrintStats( FILE * pFile, sat_solver * p )
 //    printf( "inspects2     : %10d\n", (int)p->stats.inspects2 );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Prints the memory used by the clauses and the watch lists.]
+
+  Description [Two-literal problem clauses are stored only in the watch
+  lists. Other clauses are stored in the clause memory and watched by 
+  two-word entries (the clause handle and the blocker literal).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sat_SolverPrintMemory( FILE * pFile, sat_solver * p )
+{
+    double nWatchCap = 0, nWatchUsed = 0, nBinWatches = 0;
+    double nArenaUsed = Sat_MemMemoryAllUsed( &p->Mem );
+    double nArenaAll  = Sat_MemMemoryAll( &p->Mem );
+    double nClauses   = Sat_Wrd2Dbl(p->stats.clauses) + Sat_Wrd2Dbl(p->stats.learnts);
+    int i, k;
+    for ( i = 0; i < 2 * p->size; i++ )
+    {
+        veci * v = p->wlists + i;
+        nWatchCap  += v->cap;
+        nWatchUsed += v->size;
+        for ( k = 0; k < v->size; k++ )
+            if ( v->ptr[k] & 1 )
+                nBinWatches++;
+            else
+                k++;
+    }
+    nClauses = Abc_MaxDouble( nClauses, 1 );
+    fprintf( pFile, "clauses       : %16.0f  (learned %.0f, two-literal in watch lists %.0f)\n", 
+        nClauses, Sat_Wrd2Dbl(p->stats.learnts), nBinWatches / 2 );
+    fprintf( pFile, "literals      : %16.0f  (learned %.0f)\n", 
+        Sat_Wrd2Dbl(p->stats.clauses_literals) + Sat_Wrd2Dbl(p->stats.learnts_literals), Sat_Wrd2Dbl(p->stats.learnts_literals) );
+    fprintf( pFile, "clause memory : %13.2f MB  (allocated %.2f MB)\n", nArenaUsed / (1<<20), nArenaAll / (1<<20) );
+    fprintf( pFile, "watch lists   : %13.2f MB  (allocated %.2f MB)\n", 4.0 * nWatchUsed / (1<<20), 4.0 * nWatchCap / (1<<20) );
+    fprintf( pFile, "bytes/clause  : %16.2f  (clause memory %.2f, watch lists %.2f)\n", 
+        (nArenaUsed + 4.0 * nWatchUsed) / nClauses, nArenaUsed / nClauses, 4.0 * nWatchUsed / nClauses );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Writes the given clause in a file in DIMACS format.]
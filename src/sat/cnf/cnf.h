@@ -174,6 +174,8 @@ extern int             Cnf_ManMapForCnf( Cnf_Man_t * p );
 extern void            Cnf_ManTransferCuts( Cnf_Man_t * p );
 extern void            Cnf_ManFreeCuts( Cnf_Man_t * p );
 extern void            Cnf_ManPostprocess( Cnf_Man_t * p );
+/*=== cnfPre.c ========================================================*/
+extern int             Cnf_DataPreprocess( Cnf_Dat_t * pCnf, Vec_Int_t * vFrozen, int fVerbose );
 /*=== cnfUtil.c ========================================================*/
 extern Vec_Ptr_t *     Aig_ManScanMapping( Cnf_Man_t * p, int fCollect );
 extern Vec_Ptr_t *     Cnf_ManScanMapping( Cnf_Man_t * p, int fCollect, int fPreorder );
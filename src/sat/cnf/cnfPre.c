@@ -0,0 +1,712 @@
+/**CFile****************************************************************
+
+  FileName    [cnfPre.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [AIG-to-CNF conversion.]
+
+  Synopsis    [Preprocessing of the CNF before loading it into a solver.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - April 28, 2007.]
+
+  Revision    [$Id: cnfPre.c,v 1.00 2007/04/28 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "cnf.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The preprocessor applies the following transformations in a loop:
+//   - unit propagation
+//   - substitution of equivalent literals, detected as the strongly
+//     connected components of the binary implication graph
+//   - backward subsumption and self-subsuming resolution
+//   - bounded variable elimination (the variable is eliminated if the
+//     number of non-tautological resolvents does not exceed the number
+//     of clauses containing the variable)
+// The frozen variables are neither eliminated nor substituted, so that
+// the clauses can be added for them and they can be used as assumptions.
+// The values of other variables in the satisfying assignment are not
+// meaningful, except for those assigned by unit propagation.
+
+typedef struct Cnf_Pre_t_ Cnf_Pre_t;
+struct Cnf_Pre_t_
+{
+    // parameters
+    int             nVars;        // the number of variables
+    int             nLimitOcc;    // the limit on the occurrences of an eliminated literal
+    int             nLimitRes;    // the limit on the resolvent size
+    int             nLimitSub;    // the limit on the occurrences in subsumption
+    // problem
+    Vec_Wec_t *     vClauses;     // clauses (empty if deleted)
+    Vec_Wec_t *     vOccurs;      // clauses containing each literal
+    Vec_Int_t *     vValues;      // variable values (-1 if unassigned)
+    Vec_Str_t *     vFrozen;      // frozen variables
+    Vec_Str_t *     vElim;        // eliminated or substituted variables
+    Vec_Int_t *     vQueue;       // literals to propagate
+    Vec_Str_t *     vMarks;       // literal marks
+    int             fUnsat;       // the problem is unsatisfiable
+    // temporary
+    Vec_Int_t *     vTemp;        // literals
+    Vec_Int_t *     vTemp2;       // clauses
+    Vec_Int_t *     vTemp3;       // clauses
+    Vec_Int_t *     vRes;         // resolvents
+    // statistics
+    int             nElimVars;    // eliminated variables
+    int             nEquivVars;   // substituted variables
+    int             nSubsumed;    // subsumed clauses
+    int             nStrength;    // strengthened clauses
+    int             nUnits;       // assigned variables
+};
+
+static inline int    Cnf_PreValue( Cnf_Pre_t * p, int v )        { return Vec_IntEntry(p->vValues, v);      }
+static inline int    Cnf_PreLitValue( Cnf_Pre_t * p, int Lit )   { int Value = Cnf_PreValue(p, Abc_Lit2Var(Lit)); return Value == -1 ? -1 : Value ^ Abc_LitIsCompl(Lit); }
+static inline int    Cnf_PreIsFrozen( Cnf_Pre_t * p, int v )     { return Vec_StrEntry(p->vFrozen, v);      }
+static inline int    Cnf_PreIsElim( Cnf_Pre_t * p, int v )       { return Vec_StrEntry(p->vElim, v);        }
+static inline int    Cnf_PreOccNum( Cnf_Pre_t * p, int Lit )     { return Vec_IntSize(Vec_WecEntry(p->vOccurs, Lit)); }
+static inline int    Cnf_PreVarOccNum( Cnf_Pre_t * p, int v )    { return Cnf_PreOccNum(p, Abc_Var2Lit(v, 0)) + Cnf_PreOccNum(p, Abc_Var2Lit(v, 1)); }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the preprocessor.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Cnf_Pre_t * Cnf_PreStart( int nVars )
+{
+    Cnf_Pre_t * p = ABC_CALLOC( Cnf_Pre_t, 1 );
+    p->nVars     = nVars;
+    p->nLimitOcc = 16;
+    p->nLimitRes = 20;
+    p->nLimitSub = 1000;
+    p->vClauses  = Vec_WecAlloc( 1000 );
+    p->vOccurs   = Vec_WecStart( 2 * nVars );
+    p->vValues   = Vec_IntStartFull( nVars );
+    p->vFrozen   = Vec_StrStart( nVars );
+    p->vElim     = Vec_StrStart( nVars );
+    p->vQueue    = Vec_IntAlloc( 100 );
+    p->vMarks    = Vec_StrStart( 2 * nVars );
+    p->vTemp     = Vec_IntAlloc( 100 );
+    p->vTemp2    = Vec_IntAlloc( 100 );
+    p->vTemp3    = Vec_IntAlloc( 100 );
+    p->vRes      = Vec_IntAlloc( 100 );
+    return p;
+}
+static void Cnf_PreStop( Cnf_Pre_t * p )
+{
+    Vec_WecFree( p->vClauses );
+    Vec_WecFree( p->vOccurs );
+    Vec_IntFree( p->vValues );
+    Vec_StrFree( p->vFrozen );
+    Vec_StrFree( p->vElim );
+    Vec_IntFree( p->vQueue );
+    Vec_StrFree( p->vMarks );
+    Vec_IntFree( p->vTemp );
+    Vec_IntFree( p->vTemp2 );
+    Vec_IntFree( p->vTemp3 );
+    Vec_IntFree( p->vRes );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Assigns the literal to be true.]
+
+  Description [Records the conflict if the literal is already false.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cnf_PreAssign( Cnf_Pre_t * p, int Lit )
+{
+    int Value = Cnf_PreLitValue( p, Lit );
+    if ( Value == 1 )
+        return;
+    if ( Value == 0 )
+    {
+        p->fUnsat = 1;
+        return;
+    }
+    Vec_IntWriteEntry( p->vValues, Abc_Lit2Var(Lit), !Abc_LitIsCompl(Lit) );
+    Vec_IntPush( p->vQueue, Lit );
+    p->nUnits++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds and removes clauses.]
+
+  Description [The new clause is simplified using the current assignment.
+  Tautologies are skipped and unit clauses are assigned.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cnf_PreClauseAdd( Cnf_Pre_t * p, int * pLits, int nLits )
+{
+    Vec_Int_t * vClause;
+    int i, k, Lit, iClause;
+    Vec_IntClear( p->vTemp );
+    for ( i = 0; i < nLits; i++ )
+    {
+        int Value = Cnf_PreLitValue( p, pLits[i] );
+        if ( Value == 1 )
+            return;
+        if ( Value == -1 )
+            Vec_IntPush( p->vTemp, pLits[i] );
+    }
+    Vec_IntSort( p->vTemp, 0 );
+    Vec_IntUniqify( p->vTemp );
+    for ( i = 1; i < Vec_IntSize(p->vTemp); i++ )
+        if ( Vec_IntEntry(p->vTemp, i-1) == Abc_LitNot(Vec_IntEntry(p->vTemp, i)) )
+            return;
+    if ( Vec_IntSize(p->vTemp) == 0 )
+    {
+        p->fUnsat = 1;
+        return;
+    }
+    if ( Vec_IntSize(p->vTemp) == 1 )
+    {
+        Cnf_PreAssign( p, Vec_IntEntry(p->vTemp, 0) );
+        return;
+    }
+    iClause = Vec_WecSize( p->vClauses );
+    vClause = Vec_WecPushLevel( p->vClauses );
+    Vec_IntForEachEntry( p->vTemp, Lit, k )
+    {
+        assert( !Cnf_PreIsElim(p, Abc_Lit2Var(Lit)) );
+        Vec_IntPush( vClause, Lit );
+        Vec_WecPush( p->vOccurs, Lit, iClause );
+    }
+}
+static void Cnf_PreClauseRemove( Cnf_Pre_t * p, int iClause )
+{
+    Vec_Int_t * vClause = Vec_WecEntry( p->vClauses, iClause );
+    int k, Lit;
+    Vec_IntForEachEntry( vClause, Lit, k )
+        Vec_IntRemove( Vec_WecEntry(p->vOccurs, Lit), iClause );
+    Vec_IntErase( vClause );
+}
+static void Cnf_PreClauseRemoveLit( Cnf_Pre_t * p, int iClause, int Lit )
+{
+    Vec_Int_t * vClause = Vec_WecEntry( p->vClauses, iClause );
+    Vec_IntRemove( vClause, Lit );
+    Vec_IntRemove( Vec_WecEntry(p->vOccurs, Lit), iClause );
+    if ( Vec_IntSize(vClause) == 1 )
+    {
+        Cnf_PreAssign( p, Vec_IntEntry(vClause, 0) );
+        Cnf_PreClauseRemove( p, iClause );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs unit propagation.]
+
+  Description [Removes the satisfied clauses and the false literals.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cnf_PrePropagate( Cnf_Pre_t * p )
+{
+    int i, k, Lit, iClause;
+    for ( i = 0; i < Vec_IntSize(p->vQueue) && !p->fUnsat; i++ )
+    {
+        Lit = Vec_IntEntry( p->vQueue, i );
+        Vec_IntClear( p->vTemp2 );
+        Vec_IntAppend( p->vTemp2, Vec_WecEntry(p->vOccurs, Lit) );
+        Vec_IntForEachEntry( p->vTemp2, iClause, k )
+            Cnf_PreClauseRemove( p, iClause );
+        Vec_IntClear( p->vTemp2 );
+        Vec_IntAppend( p->vTemp2, Vec_WecEntry(p->vOccurs, Abc_LitNot(Lit)) );
+        Vec_IntForEachEntry( p->vTemp2, iClause, k )
+            Cnf_PreClauseRemoveLit( p, iClause, Abc_LitNot(Lit) );
+    }
+    Vec_IntClear( p->vQueue );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Substitutes equivalent literals.]
+
+  Description [The equivalences are the strongly connected components of
+  the binary implication graph, which are computed by the iterative version
+  of Tarjan's algorithm. The representative of each class is a frozen
+  variable, if the class has one, or the smallest variable otherwise.
+  Returns the number of substituted variables.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cnf_PreSccNext( Cnf_Pre_t * p, int Lit, int * piOcc )
+{
+    // the implication Lit -> Other comes from the binary clause (!Lit + Other)
+    Vec_Int_t * vOccs = Vec_WecEntry( p->vOccurs, Abc_LitNot(Lit) );
+    for ( ; *piOcc < Vec_IntSize(vOccs); (*piOcc)++ )
+    {
+        Vec_Int_t * vClause = Vec_WecEntry( p->vClauses, Vec_IntEntry(vOccs, *piOcc) );
+        if ( Vec_IntSize(vClause) == 2 )
+            return Vec_IntEntry(vClause, 0) ^ Vec_IntEntry(vClause, 1) ^ Abc_LitNot(Lit);
+    }
+    return -1;
+}
+static int Cnf_PreSubstitute( Cnf_Pre_t * p )
+{
+    int nLits = 2 * p->nVars, nComps = 0, Counter = 0, nClauses;
+    Vec_Int_t * vIndex = Vec_IntStartFull( nLits );
+    Vec_Int_t * vLow   = Vec_IntStart( nLits );
+    Vec_Int_t * vComp  = Vec_IntStartFull( nLits );
+    Vec_Int_t * vStack = Vec_IntAlloc( 100 );
+    Vec_Int_t * vCall  = Vec_IntAlloc( 100 ); // pairs (literal, occurrence index)
+    Vec_Int_t * vRepr, * vMap, * vClause;
+    int i, k, v, Lit, iNext = 0;
+    for ( i = 0; i < nLits; i++ )
+    {
+        if ( Vec_IntEntry(vIndex, i) >= 0 || Cnf_PreValue(p, Abc_Lit2Var(i)) >= 0 || Cnf_PreIsElim(p, Abc_Lit2Var(i)) )
+            continue;
+        Vec_IntWriteEntry( vIndex, i, iNext );
+        Vec_IntWriteEntry( vLow, i, iNext++ );
+        Vec_IntPush( vStack, i );
+        Vec_IntPushTwo( vCall, i, 0 );
+        while ( Vec_IntSize(vCall) > 0 )
+        {
+            int Node = Vec_IntEntry( vCall, Vec_IntSize(vCall)-2 );
+            int iOcc = Vec_IntEntry( vCall, Vec_IntSize(vCall)-1 );
+            int Succ = Cnf_PreSccNext( p, Node, &iOcc );
+            if ( Succ >= 0 )
+            {
+                Vec_IntWriteEntry( vCall, Vec_IntSize(vCall)-1, iOcc+1 );
+                if ( Vec_IntEntry(vIndex, Succ) == -1 )
+                {
+                    Vec_IntWriteEntry( vIndex, Succ, iNext );
+                    Vec_IntWriteEntry( vLow, Succ, iNext++ );
+                    Vec_IntPush( vStack, Succ );
+                    Vec_IntPushTwo( vCall, Succ, 0 );
+                }
+                else if ( Vec_IntEntry(vComp, Succ) == -1 ) // on the stack
+                    Vec_IntWriteEntry( vLow, Node, Abc_MinInt(Vec_IntEntry(vLow, Node), Vec_IntEntry(vIndex, Succ)) );
+                continue;
+            }
+            Vec_IntShrink( vCall, Vec_IntSize(vCall)-2 );
+            if ( Vec_IntSize(vCall) > 0 )
+            {
+                int Parent = Vec_IntEntry( vCall, Vec_IntSize(vCall)-2 );
+                Vec_IntWriteEntry( vLow, Parent, Abc_MinInt(Vec_IntEntry(vLow, Parent), Vec_IntEntry(vLow, Node)) );
+            }
+            if ( Vec_IntEntry(vLow, Node) != Vec_IntEntry(vIndex, Node) )
+                continue;
+            do {
+                Lit = Vec_IntPop( vStack );
+                Vec_IntWriteEntry( vComp, Lit, nComps );
+            } while ( Lit != Node );
+            nComps++;
+        }
+    }
+    Vec_IntFree( vIndex );
+    Vec_IntFree( vLow );
+    Vec_IntFree( vStack );
+    Vec_IntFree( vCall );
+    // choose the representatives, first among the frozen variables
+    vRepr = Vec_IntStartFull( nComps );
+    for ( k = 0; k < 2; k++ )
+    for ( v = 0; v < p->nVars; v++ )
+    {
+        int iComp = Vec_IntEntry( vComp, Abc_Var2Lit(v, 0) );
+        if ( iComp == -1 || (k == 0 && !Cnf_PreIsFrozen(p, v)) )
+            continue;
+        if ( iComp == Vec_IntEntry(vComp, Abc_Var2Lit(v, 1)) )
+        {
+            p->fUnsat = 1;
+            Vec_IntFree( vComp );
+            Vec_IntFree( vRepr );
+            return 0;
+        }
+        if ( Vec_IntEntry(vRepr, iComp) >= 0 )
+            continue;
+        Vec_IntWriteEntry( vRepr, iComp, Abc_Var2Lit(v, 0) );
+        Vec_IntWriteEntry( vRepr, Vec_IntEntry(vComp, Abc_Var2Lit(v, 1)), Abc_Var2Lit(v, 1) );
+    }
+    // derive the literal map
+    vMap = Vec_IntStartNatural( nLits );
+    for ( v = 0; v < p->nVars; v++ )
+    {
+        int iComp = Vec_IntEntry( vComp, Abc_Var2Lit(v, 0) );
+        if ( iComp == -1 || Cnf_PreIsFrozen(p, v) || Vec_IntEntry(vRepr, iComp) == Abc_Var2Lit(v, 0) )
+            continue;
+        Vec_IntWriteEntry( vMap, Abc_Var2Lit(v, 0), Vec_IntEntry(vRepr, iComp) );
+        Vec_IntWriteEntry( vMap, Abc_Var2Lit(v, 1), Abc_LitNot(Vec_IntEntry(vRepr, iComp)) );
+        Vec_StrWriteEntry( p->vElim, v, 1 );
+        Counter++;
+    }
+    Vec_IntFree( vComp );
+    Vec_IntFree( vRepr );
+    // rewrite the clauses
+    if ( Counter > 0 )
+    {
+        Vec_Wec_t * vOld = p->vClauses;
+        nClauses = Vec_WecSize( vOld );
+        p->vClauses = Vec_WecAlloc( nClauses );
+        Vec_WecForEachLevel( p->vOccurs, vClause, i )
+            Vec_IntClear( vClause );
+        Vec_WecForEachLevel( vOld, vClause, i )
+        {
+            if ( Vec_IntSize(vClause) == 0 )
+                continue;
+            Vec_IntForEachEntry( vClause, Lit, k )
+                Vec_IntWriteEntry( vClause, k, Vec_IntEntry(vMap, Lit) );
+            Cnf_PreClauseAdd( p, Vec_IntArray(vClause), Vec_IntSize(vClause) );
+        }
+        Vec_WecFree( vOld );
+        Cnf_PrePropagate( p );
+    }
+    Vec_IntFree( vMap );
+    p->nEquivVars += Counter;
+    return Counter;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs subsumption and self-subsuming resolution.]
+
+  Description [For each clause, the other clauses are collected from the
+  occurrence lists of its variable with the fewest occurrences. Returns
+  the number of subsumed and strengthened clauses.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cnf_PreSubsume( Cnf_Pre_t * p )
+{
+    Vec_Int_t * vClause, * vOther;
+    int i, k, n, c, Lit, Best, iOther, nSubsumed = p->nSubsumed, nStrength = p->nStrength;
+    for ( i = 0; i < Vec_WecSize(p->vClauses) && !p->fUnsat; i++ )
+    {
+        vClause = Vec_WecEntry( p->vClauses, i );
+        if ( Vec_IntSize(vClause) == 0 )
+            continue;
+        // find the variable with the fewest occurrences
+        Best = Vec_IntEntry( vClause, 0 );
+        Vec_IntForEachEntryStart( vClause, Lit, k, 1 )
+            if ( Cnf_PreVarOccNum(p, Abc_Lit2Var(Lit)) < Cnf_PreVarOccNum(p, Abc_Lit2Var(Best)) )
+                Best = Lit;
+        if ( Cnf_PreVarOccNum(p, Abc_Lit2Var(Best)) > p->nLimitSub )
+            continue;
+        Vec_IntForEachEntry( vClause, Lit, k )
+            Vec_StrWriteEntry( p->vMarks, Lit, 1 );
+        // collect the subsumed clauses (vTemp2) and the literals to remove (vTemp3)
+        Vec_IntClear( p->vTemp2 );
+        Vec_IntClear( p->vTemp3 );
+        for ( n = 0; n < 2; n++ )
+        Vec_IntForEachEntry( Vec_WecEntry(p->vOccurs, Abc_LitNotCond(Best, n)), iOther, k )
+        {
+            int nSame = 0, nFlip = 0, LitFlip = -1;
+            vOther = Vec_WecEntry( p->vClauses, iOther );
+            if ( iOther == i || Vec_IntSize(vOther) < Vec_IntSize(vClause) )
+                continue;
+            Vec_IntForEachEntry( vOther, Lit, c )
+                if ( Vec_StrEntry(p->vMarks, Lit) )
+                    nSame++;
+                else if ( Vec_StrEntry(p->vMarks, Abc_LitNot(Lit)) )
+                    nFlip++, LitFlip = Lit;
+            if ( nSame + nFlip < Vec_IntSize(vClause) || nFlip > 1 )
+                continue;
+            if ( nFlip == 0 )
+                Vec_IntPush( p->vTemp2, iOther );
+            else
+                Vec_IntPushTwo( p->vTemp3, iOther, LitFlip );
+        }
+        Vec_IntForEachEntry( vClause, Lit, k )
+            Vec_StrWriteEntry( p->vMarks, Lit, 0 );
+        // update the clauses
+        Vec_IntForEachEntry( p->vTemp2, iOther, k )
+            Cnf_PreClauseRemove( p, iOther );
+        p->nSubsumed += Vec_IntSize( p->vTemp2 );
+        Vec_IntForEachEntryDouble( p->vTemp3, iOther, Lit, k )
+            if ( Vec_IntSize(Vec_WecEntry(p->vClauses, iOther)) > 0 )
+                Cnf_PreClauseRemoveLit( p, iOther, Lit ), p->nStrength++;
+        Cnf_PrePropagate( p );
+    }
+    return p->nSubsumed - nSubsumed + p->nStrength - nStrength;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs bounded variable elimination.]
+
+  Description [The variables are tried in the order of increasing product
+  of the positive and negative occurrences. Returns the number of
+  eliminated variables.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cnf_PreResolve( Cnf_Pre_t * p, Vec_Int_t * vPos, Vec_Int_t * vNeg, int Var, int nLimit )
+{
+    int i, k, c, Lit, nRes = 0;
+    Vec_IntClear( p->vRes );
+    for ( i = 0; i < Vec_IntSize(vPos); i++ )
+    {
+        Vec_Int_t * vClause = Vec_WecEntry( p->vClauses, Vec_IntEntry(vPos, i) );
+        Vec_IntForEachEntry( vClause, Lit, c )
+            Vec_StrWriteEntry( p->vMarks, Lit, 1 );
+        for ( k = 0; k < Vec_IntSize(vNeg); k++ )
+        {
+            Vec_Int_t * vOther = Vec_WecEntry( p->vClauses, Vec_IntEntry(vNeg, k) );
+            int iStart = Vec_IntSize( p->vRes ), nSize = Vec_IntSize(vClause) - 1;
+            Vec_IntPush( p->vRes, 0 );
+            Vec_IntForEachEntry( vClause, Lit, c )
+                if ( Abc_Lit2Var(Lit) != Var )
+                    Vec_IntPush( p->vRes, Lit );
+            Vec_IntForEachEntry( vOther, Lit, c )
+            {
+                if ( Abc_Lit2Var(Lit) == Var || Vec_StrEntry(p->vMarks, Lit) )
+                    continue;
+                if ( Vec_StrEntry(p->vMarks, Abc_LitNot(Lit)) )
+                    break;
+                Vec_IntPush( p->vRes, Lit );
+                nSize++;
+            }
+            if ( c < Vec_IntSize(vOther) ) // tautology
+            {
+                Vec_IntShrink( p->vRes, iStart );
+                continue;
+            }
+            Vec_IntWriteEntry( p->vRes, iStart, nSize );
+            if ( ++nRes > nLimit || nSize > p->nLimitRes )
+                break;
+        }
+        Vec_IntForEachEntry( vClause, Lit, c )
+            Vec_StrWriteEntry( p->vMarks, Lit, 0 );
+        if ( k < Vec_IntSize(vNeg) )
+            return 0;
+    }
+    return 1;
+}
+static int Cnf_PreEliminate( Cnf_Pre_t * p )
+{
+    Vec_Int_t * vVars = Vec_IntAlloc( p->nVars );
+    Vec_Int_t * vCosts = Vec_IntAlloc( p->nVars );
+    int * pOrder, i, k, v, nSize, iClause, Counter = 0;
+    for ( v = 0; v < p->nVars; v++ )
+    {
+        int nPos = Cnf_PreOccNum( p, Abc_Var2Lit(v, 0) );
+        int nNeg = Cnf_PreOccNum( p, Abc_Var2Lit(v, 1) );
+        if ( Cnf_PreIsFrozen(p, v) || Cnf_PreIsElim(p, v) || Cnf_PreValue(p, v) >= 0 )
+            continue;
+        if ( nPos + nNeg == 0 || nPos > p->nLimitOcc || nNeg > p->nLimitOcc )
+            continue;
+        Vec_IntPush( vVars, v );
+        Vec_IntPush( vCosts, nPos * nNeg );
+    }
+    pOrder = Abc_MergeSortCost( Vec_IntArray(vCosts), Vec_IntSize(vCosts) );
+    for ( i = 0; i < Vec_IntSize(vVars) && !p->fUnsat; i++ )
+    {
+        Vec_Int_t * vPos, * vNeg;
+        v = Vec_IntEntry( vVars, pOrder[i] );
+        if ( Cnf_PreValue(p, v) >= 0 )
+            continue;
+        vPos = Vec_WecEntry( p->vOccurs, Abc_Var2Lit(v, 0) );
+        vNeg = Vec_WecEntry( p->vOccurs, Abc_Var2Lit(v, 1) );
+        if ( Vec_IntSize(vPos) > p->nLimitOcc || Vec_IntSize(vNeg) > p->nLimitOcc )
+            continue;
+        if ( !Cnf_PreResolve( p, vPos, vNeg, v, Vec_IntSize(vPos) + Vec_IntSize(vNeg) ) )
+            continue;
+        // replace the clauses by the resolvents
+        Vec_IntClear( p->vTemp3 );
+        Vec_IntAppend( p->vTemp3, vPos );
+        Vec_IntAppend( p->vTemp3, vNeg );
+        Vec_IntForEachEntry( p->vTemp3, iClause, k )
+            Cnf_PreClauseRemove( p, iClause );
+        Vec_StrWriteEntry( p->vElim, v, 1 );
+        for ( k = 0; k < Vec_IntSize(p->vRes); k += nSize + 1 )
+        {
+            nSize = Vec_IntEntry( p->vRes, k );
+            Cnf_PreClauseAdd( p, Vec_IntEntryP(p->vRes, k + 1), nSize );
+        }
+        Cnf_PrePropagate( p );
+        Counter++;
+    }
+    ABC_FREE( pOrder );
+    Vec_IntFree( vVars );
+    Vec_IntFree( vCosts );
+    p->nElimVars += Counter;
+    return Counter;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Preprocesses the CNF.]
+
+  Description [The CNF is updated in place. The variables in vFrozen are
+  preserved. If vFrozen is NULL and the CNF has the AIG manager, the
+  variables of the combinational inputs and outputs are preserved, so that
+  the output clauses can be added and the CEX can be derived as usual.
+  Returns 0 if the CNF is proved unsatisfiable; in this case, the CNF is
+  replaced by a pair of contradictory unit clauses, so that loading it
+  into the solver fails.]
+
+  SideEffects [The clause-to-object mappings are freed.]
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cnf_DataPreprocess( Cnf_Dat_t * pCnf, Vec_Int_t * vFrozen, int fVerbose )
+{
+    Cnf_Pre_t * p;
+    Vec_Int_t * vClause;
+    Aig_Obj_t * pObj;
+    abctime clk = Abc_Clock();
+    int nVarsOld = 0, nClausesOld = pCnf->nClauses, nLiteralsOld = pCnf->nLiterals;
+    int i, k, v, Lit, nClauses, nLiterals, Round, nRounds = 0, RetValue;
+    int * pBeg, * pEnd;
+    p = Cnf_PreStart( pCnf->nVars );
+    // mark the frozen variables
+    if ( vFrozen )
+    {
+        Vec_IntForEachEntry( vFrozen, v, i )
+            Vec_StrWriteEntry( p->vFrozen, v, 1 );
+    }
+    else if ( pCnf->pMan && pCnf->pVarNums )
+    {
+        Aig_ManForEachCi( pCnf->pMan, pObj, i )
+            if ( pCnf->pVarNums[pObj->Id] >= 0 )
+                Vec_StrWriteEntry( p->vFrozen, pCnf->pVarNums[pObj->Id], 1 );
+        Aig_ManForEachCo( pCnf->pMan, pObj, i )
+            if ( pCnf->pVarNums[pObj->Id] >= 0 )
+                Vec_StrWriteEntry( p->vFrozen, pCnf->pVarNums[pObj->Id], 1 );
+    }
+    // load the clauses
+    Cnf_CnfForClause( pCnf, pBeg, pEnd, i )
+    {
+        for ( k = 0; k < (int)(pEnd - pBeg); k++ )
+            Vec_StrWriteEntry( p->vMarks, Abc_LitRegular(pBeg[k]), 1 );
+        Cnf_PreClauseAdd( p, pBeg, pEnd - pBeg );
+    }
+    for ( v = 0; v < pCnf->nVars; v++ )
+        nVarsOld += Vec_StrEntry( p->vMarks, Abc_Var2Lit(v, 0) );
+    Vec_StrFill( p->vMarks, 2 * pCnf->nVars, 0 );
+    Cnf_PrePropagate( p );
+    // simplify
+    for ( Round = 1; Round <= 3 && !p->fUnsat; Round++ )
+    {
+        int nChanges = 0;
+        nRounds++;
+        nChanges += Cnf_PreSubstitute( p );
+        if ( !p->fUnsat )
+            nChanges += Cnf_PreSubsume( p );
+        if ( !p->fUnsat )
+            nChanges += Cnf_PreEliminate( p );
+        if ( nChanges == 0 )
+            break;
+    }
+    // count the remaining clauses
+    nClauses = nLiterals = 0;
+    if ( p->fUnsat )
+        nClauses = nLiterals = 2;
+    else
+    {
+        Vec_WecForEachLevel( p->vClauses, vClause, i )
+            if ( Vec_IntSize(vClause) > 0 )
+                nClauses++, nLiterals += Vec_IntSize(vClause);
+        for ( v = 0; v < p->nVars; v++ )
+            if ( Cnf_PreValue(p, v) >= 0 )
+                nClauses++, nLiterals++;
+    }
+    // write the clauses back
+    ABC_FREE( pCnf->pClaPols );
+    ABC_FREE( pCnf->pObj2Clause );
+    ABC_FREE( pCnf->pObj2Count );
+    ABC_FREE( pCnf->pClauses[0] );
+    ABC_FREE( pCnf->pClauses );
+    pCnf->nClauses  = nClauses;
+    pCnf->nLiterals = nLiterals;
+    pCnf->pClauses  = ABC_ALLOC( int *, nClauses + 1 );
+    pCnf->pClauses[0] = ABC_ALLOC( int, nLiterals + 1 );
+    pCnf->pClauses[nClauses] = pCnf->pClauses[0] + nLiterals;
+    pBeg = pCnf->pClauses[0];
+    nClauses = 0;
+    if ( p->fUnsat )
+    {
+        pCnf->pClauses[nClauses++] = pBeg;
+        *pBeg++ = 0;
+        pCnf->pClauses[nClauses++] = pBeg;
+        *pBeg++ = 1;
+    }
+    else
+    {
+        for ( v = 0; v < p->nVars; v++ )
+            if ( Cnf_PreValue(p, v) >= 0 )
+            {
+                pCnf->pClauses[nClauses++] = pBeg;
+                *pBeg++ = Abc_Var2Lit( v, !Cnf_PreValue(p, v) );
+            }
+        Vec_WecForEachLevel( p->vClauses, vClause, i )
+        {
+            if ( Vec_IntSize(vClause) == 0 )
+                continue;
+            pCnf->pClauses[nClauses++] = pBeg;
+            Vec_IntForEachEntry( vClause, Lit, k )
+                *pBeg++ = Lit;
+        }
+    }
+    assert( nClauses == pCnf->nClauses );
+    assert( pBeg == pCnf->pClauses[nClauses] );
+    if ( fVerbose )
+    {
+        int nVarsNew = 0;
+        for ( v = 0; v < p->nVars; v++ )
+            nVarsNew += !Cnf_PreIsElim(p, v) && Cnf_PreValue(p, v) == -1 && Cnf_PreVarOccNum(p, v) > 0;
+        printf( "CNF preprocessing: Vars = %d -> %d (%.1f %%)  Clauses = %d -> %d (%.1f %%)  Literals = %d -> %d (%.1f %%)\n",
+            nVarsOld, nVarsNew, 100.0*(nVarsOld-nVarsNew)/Abc_MaxInt(nVarsOld, 1),
+            nClausesOld, pCnf->nClauses, 100.0*(nClausesOld-pCnf->nClauses)/Abc_MaxInt(nClausesOld, 1),
+            nLiteralsOld, pCnf->nLiterals, 100.0*(nLiteralsOld-pCnf->nLiterals)/Abc_MaxInt(nLiteralsOld, 1) );
+        printf( "Eliminated = %d.  Equivalent = %d.  Units = %d.  Subsumed = %d.  Strengthened = %d.  Rounds = %d.  ",
+            p->nElimVars, p->nEquivVars, p->nUnits, p->nSubsumed, p->nStrength, nRounds );
+        if ( p->fUnsat )
+            printf( "UNSAT.  " );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    RetValue = !p->fUnsat;
+    Cnf_PreStop( p );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -856,6 +856,18 @@ void Glucose2_SolveCnf( char * pFileName, Glucose2_Pars * pPars )
 //    gzFile in = gzopen(pFilename, "rb");
 //    parse_DIMACS(in, S);
 //    gzclose(in);
+    if ( pPars->nThreads > 1 )
+    {
+        extern int Glucose2_SolveCnfPort( Cnf_Dat_t * pCnf, Glucose2_Pars * pPars, Vec_Int_t * vModel );
+        Cnf_Dat_t * pCnf = Cnf_DataReadFromFile( pFileName );
+        if ( pCnf == NULL )
+            return;
+        int status = Glucose2_SolveCnfPort( pCnf, pPars, NULL );
+        Cnf_DataFree( pCnf );
+        printf(status == 1 ? "SATISFIABLE" : status == -1 ? "UNSATISFIABLE" : "INDETERMINATE");
+        Abc_PrintTime( 1, "      Time", Abc_Clock() - clk );
+        return;
+    }
     Glucose_ReadDimacs( pFileName, S );
 
     if ( pPars->verb )
@@ -1493,18 +1505,49 @@ void Glucose2_CheckTwoNodesTest( Gia_Man_t * p )
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Solves the combinational miter.]
 
-  Description []
+  Description [If the number of threads is more than one, the CNF is
+  solved by the portfolio of solvers sharing learned clauses, which does
+  not use variable elimination.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
+int Glucose2_SolveAigPort(Gia_Man_t * p, Glucose2_Pars * pPars)
+{  
+    extern int Glucose2_SolveCnfPort( Cnf_Dat_t * pCnf, Glucose2_Pars * pPars, Vec_Int_t * vModel );
+    abctime clk = Abc_Clock();
+    Cnf_Dat_t * pCnf = (Cnf_Dat_t *)Mf_ManGenerateCnf( p, 8 /*nLutSize*/, 0 /*fCnfObjIds*/, 1/*fAddOrCla*/, 0, 0/*verbose*/ );
+    Vec_Int_t * vModel = Vec_IntAlloc( pCnf->nVars );
+    printf( "CNF stats: Vars = %6d. Clauses = %7d. Literals = %8d. ", pCnf->nVars, pCnf->nClauses, pCnf->nLiterals );
+    Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    int status = Glucose2_SolveCnfPort( pCnf, pPars, vModel );
+    printf(status == 1 ? "SATISFIABLE" : status == -1 ? "UNSATISFIABLE" : "INDETERMINATE");
+    Abc_PrintTime( 1, "      Time", Abc_Clock() - clk );
+    // port counterexample
+    if (status == 1)
+    {
+        Gia_Obj_t * pObj;  int i;
+        p->pCexComb = Abc_CexAlloc(0,Gia_ManCiNum(p),1);
+        Gia_ManForEachCi( p, pObj, i )
+        {
+            assert(pCnf->pVarNums[Gia_ObjId(p, pObj)]!=-1);
+            if (Vec_IntEntry(vModel, pCnf->pVarNums[Gia_ObjId(p, pObj)]))
+                Abc_InfoSetBit( p->pCexComb->pData, i);
+        }
+    }
+    Vec_IntFree( vModel );
+    Cnf_DataFree( pCnf );
+    return (status == 1 ? 10 : status == -1 ? 20 : 0);
+}
 int Glucose2_SolveAig(Gia_Man_t * p, Glucose2_Pars * pPars)
 {  
     abctime clk = Abc_Clock();
+    if ( pPars->nThreads > 1 )
+        return Glucose2_SolveAigPort( p, pPars );
 
     SimpSolver S;
     S.verbosity = pPars->verb;
@@ -48,6 +48,7 @@ struct Glucose2_Pars_ {
     int verb;    // verbosity
     int cust;    // customizable
     int nConfls; // conflict limit (0 = no limit)
+    int nThreads; // the number of solvers in the portfolio (1 = no portfolio)
 };
 
 static inline Glucose2_Pars Glucose_CreatePars(int p, int v, int c, int nConfls)
@@ -57,6 +58,7 @@ static inline Glucose2_Pars Glucose_CreatePars(int p, int v, int c, int nConfls)
     pars.verb    = v;
     pars.cust    = c;
     pars.nConfls = nConfls;
+    pars.nThreads = 1;
     return pars;
 }
 
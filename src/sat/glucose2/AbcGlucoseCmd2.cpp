@@ -81,10 +81,11 @@ int Abc_CommandGlucose( Abc_Frame_t * pAbc, int argc, char ** argv )
     int pre     = 1;
     int verb    = 0;
     int nConfls = 0;
+    int nThreads = 1;
 
     Glucose2_Pars pPars;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "Cpvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "CPpvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -99,6 +100,17 @@ int Abc_CommandGlucose( Abc_Frame_t * pAbc, int argc, char ** argv )
                 if ( nConfls < 0 )
                     goto usage;
                 break;
+            case 'P':
+                if ( globalUtilOptind >= argc )
+                {
+                    Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                    goto usage;
+                }
+                nThreads = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if ( nThreads < 1 )
+                    goto usage;
+                break;
             case 'p':
                 pre ^= 1;
                 break;
@@ -113,6 +125,7 @@ int Abc_CommandGlucose( Abc_Frame_t * pAbc, int argc, char ** argv )
     }
 
     pPars = Glucose_CreatePars(pre,verb,0,nConfls);
+    pPars.nThreads = nThreads;
 
     if ( argc == globalUtilOptind + 1 )
     {
@@ -132,9 +145,10 @@ int Abc_CommandGlucose( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
     
 usage:
-    Abc_Print( -2, "usage: &glucose2 [-C num] [-pvh] <file.cnf>\n" );
+    Abc_Print( -2, "usage: &glucose2 [-CP num] [-pvh] <file.cnf>\n" );
     Abc_Print( -2, "\t             run Glucose 3.0 by Gilles Audemard and Laurent Simon\n" );
     Abc_Print( -2, "\t-C num     : conflict limit [default = %d]\n",  nConfls );
+    Abc_Print( -2, "\t-P num     : the number of solvers sharing learned clauses (disables -p) [default = %d]\n", nThreads );
     Abc_Print( -2, "\t-p         : enable preprocessing [default = %d]\n",pre);
     Abc_Print( -2, "\t-v         : verbosity [default = %d]\n",verb);
     Abc_Print( -2, "\t-h         : print the command usage\n");
@@ -0,0 +1,473 @@
+/**CFile****************************************************************
+
+  FileName    [AbcGlucosePort2.cpp]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT solver Glucose 3.0 by Gilles Audemard and Laurent Simon.]
+
+  Synopsis    [Portfolio of Glucose solvers sharing learned clauses.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - September 6, 2017.]
+
+  Revision    [$Id: AbcGlucosePort2.cpp,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "sat/glucose2/System.h"
+#include "sat/glucose2/SimpSolver.h"
+
+#include "sat/glucose2/AbcGlucose2.h"
+#include "sat/glucose2/AbcGlucosePort2.h"
+
+#include "aig/gia/gia.h"
+#include "sat/cnf/cnf.h"
+#include "misc/util/utilAtomic.h"
+#include "misc/util/utilPool.h"
+
+ABC_NAMESPACE_IMPL_START
+
+using namespace Gluco2;
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The solvers of the portfolio receive the same clauses and solve the same
+// problem with different seeds and restart constants. The first solver is
+// run by the calling thread and is the only one checking the runtime limit
+// and the stop callback. The first solver to return, for whatever reason,
+// stops the others. Each solver exports the learned clauses with
+// small LBD into its own ring buffer, which is written only by this solver
+// and read by all other solvers. A clause is written as (size, LBD, lits)
+// and published by advancing the head of the ring. The readers import the
+// clauses at level 0 and skip the clauses that may have been overwritten
+// while they were read, so neither side ever waits for the other.
+
+#define GLUCOSE_PORT_RING  (1 << 16)    // the ring size in words
+#define GLUCOSE_PORT_MASK  (GLUCOSE_PORT_RING - 1)
+
+typedef struct Gluco2_Port_t_    Gluco2_Port_t;
+typedef struct Gluco2_PortSol_t_ Gluco2_PortSol_t;
+
+struct Gluco2_PortSol_t_
+{
+    Gluco2_Port_t *   pPort;        // the portfolio
+    SimpSolver *      pSat;         // the solver
+    int               iSol;         // the solver number
+    int               Status;       // the result of the last run
+    volatile word     nHead;        // the number of words written into the ring
+    int *             pRing;        // the clauses exported by this solver
+    word *            pCursors;     // the read positions in the rings of other solvers
+    vec<Lit>          vLits;        // the clause being imported
+    word              nExported;    // the number of exported clauses
+    word              nImported;    // the number of imported clauses
+    word              nSkipped;     // the number of overwritten clauses
+    int               nWins;        // the number of runs finished first
+};
+
+struct Gluco2_Port_t_
+{
+    int               nSols;        // the number of solvers
+    Gluco2_PortSol_t *pSols;        // the solvers
+    Abc_Pool_t *      pPool;        // the threads running all solvers but the first one
+    volatile int      Stop;         // set when a solver returns
+    volatile int      iWinner;      // the first solver that found the answer
+    int *             pLits;        // the assumptions of the current run
+    int               nLits;        // the number of assumptions
+};
+
+// the restart constants used by the solvers (the first one is the default)
+static double s_PortK[5] = { 0.8, 0.7, 0.9, 0.75, 0.85 };
+static double s_PortR[5] = { 1.4, 1.2, 1.6, 1.3,  1.5  };
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Exports and imports the learned clauses.]
+
+  Description [The export is called by the solver owning the ring.
+  The import adds the new clauses of other solvers at level 0. If fCheck
+  is 1, returns 1 if there are new clauses, without adding them.
+  Otherwise, returns 0 if the problem was found to be UNSAT.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gluco2_PortExport( void * pArg, const Lit * pLits, int nLits, int lbd )
+{
+    Gluco2_PortSol_t * p = (Gluco2_PortSol_t *)pArg;
+    word nHead = p->nHead;
+    int i;
+    p->pRing[nHead & GLUCOSE_PORT_MASK] = nLits;
+    p->pRing[(nHead + 1) & GLUCOSE_PORT_MASK] = lbd;
+    for ( i = 0; i < nLits; i++ )
+        p->pRing[(nHead + 2 + i) & GLUCOSE_PORT_MASK] = toInt(pLits[i]);
+    Abc_AtomicStoreWord( &p->nHead, nHead + 2 + nLits );
+    p->nExported++;
+}
+static int Gluco2_PortImport( void * pArg, Solver * S, int fCheck )
+{
+    Gluco2_PortSol_t * p = (Gluco2_PortSol_t *)pArg, * q;
+    Gluco2_Port_t * pPort = p->pPort;
+    // the largest distance from the head at which a clause is not overwritten
+    word nSafe = GLUCOSE_PORT_RING - 2 * (2 + S->nShareSize);
+    word nHead, iPos;
+    int k, i, nLits, Lbd;
+    for ( k = 0; k < pPort->nSols; k++ )
+    {
+        if ( k == p->iSol )
+            continue;
+        q = pPort->pSols + k;
+        nHead = Abc_AtomicLoadWord( &q->nHead );
+        if ( fCheck )
+        {
+            if ( nHead != p->pCursors[k] )
+                return 1;
+            continue;
+        }
+        iPos = p->pCursors[k];
+        if ( nHead - iPos > nSafe )
+            p->nSkipped++, iPos = nHead;
+        while ( iPos < nHead )
+        {
+            nLits = q->pRing[iPos & GLUCOSE_PORT_MASK];
+            Lbd   = q->pRing[(iPos + 1) & GLUCOSE_PORT_MASK];
+            if ( nLits < 1 || nLits > S->nShareSize || iPos + 2 + nLits > nHead )
+            {
+                p->nSkipped++, iPos = nHead;
+                break;
+            }
+            p->vLits.clear();
+            for ( i = 0; i < nLits; i++ )
+                p->vLits.push( toLit(q->pRing[(iPos + 2 + i) & GLUCOSE_PORT_MASK]) );
+            // make sure the writer did not reach this clause while it was copied
+            Abc_AtomicFence();
+            if ( Abc_AtomicLoadWord(&q->nHead) - iPos > nSafe )
+            {
+                p->nSkipped++, iPos = nHead;
+                break;
+            }
+            iPos += 2 + nLits;
+            p->nImported++;
+            if ( !S->addSharedClause( (const Lit *)p->vLits, nLits, Lbd ) )
+            {
+                p->pCursors[k] = iPos;
+                return 0;
+            }
+        }
+        p->pCursors[k] = iPos;
+    }
+    return !fCheck;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the portfolio.]
+
+  Description [The first solver uses the default settings. The other
+  solvers use different random seeds, randomized initial activities and
+  different restart constants.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+bmcg2_sat_port * bmcg2_sat_port_start( int nSols )
+{
+    Gluco2_Port_t * p = ABC_CALLOC( Gluco2_Port_t, 1 );
+    int k;
+    p->nSols   = Abc_MaxInt( nSols, 1 );
+    p->pSols   = new Gluco2_PortSol_t[p->nSols];
+    p->iWinner = -1;
+    for ( k = 0; k < p->nSols; k++ )
+    {
+        Gluco2_PortSol_t * pSol = p->pSols + k;
+        SimpSolver * S = new SimpSolver;
+        S->setIncrementalMode();
+        S->pstop = (int *)&p->Stop;
+        if ( k > 0 )
+        {
+            S->random_seed     = 91648253 + 1000003 * k;
+            S->rnd_init_act    = true;
+            S->random_var_freq = (k & 1) ? 0.01 : 0.0;
+            S->K               = s_PortK[k % 5];
+            S->R               = s_PortR[k % 5];
+        }
+        pSol->pPort     = p;
+        pSol->pSat      = S;
+        pSol->iSol      = k;
+        pSol->Status    = 0;
+        pSol->nHead     = 0;
+        pSol->pRing     = NULL;
+        pSol->pCursors  = NULL;
+        pSol->nExported = pSol->nImported = pSol->nSkipped = 0;
+        pSol->nWins     = 0;
+        if ( p->nSols == 1 )
+            continue;
+        pSol->pRing     = ABC_CALLOC( int, GLUCOSE_PORT_RING );
+        pSol->pCursors  = ABC_CALLOC( word, p->nSols );
+        S->pShareMan    = pSol;
+        S->pShareExport = Gluco2_PortExport;
+        S->pShareImport = Gluco2_PortImport;
+    }
+    if ( p->nSols > 1 )
+        p->pPool = Abc_PoolStart( p->nSols - 1 );
+    return p;
+}
+void bmcg2_sat_port_stop( bmcg2_sat_port * pArg )
+{
+    Gluco2_Port_t * p = (Gluco2_Port_t *)pArg;
+    int k;
+    if ( p->pPool )
+        Abc_PoolStop( p->pPool );
+    for ( k = 0; k < p->nSols; k++ )
+    {
+        delete p->pSols[k].pSat;
+        ABC_FREE( p->pSols[k].pRing );
+        ABC_FREE( p->pSols[k].pCursors );
+    }
+    delete [] p->pSols;
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds variables and clauses to all solvers.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int bmcg2_sat_port_addvar( bmcg2_sat_port * pArg )
+{
+    Gluco2_Port_t * p = (Gluco2_Port_t *)pArg;
+    int k;
+    for ( k = 0; k < p->nSols; k++ )
+        p->pSols[k].pSat->newVar();
+    return p->pSols[0].pSat->nVars() - 1;
+}
+int bmcg2_sat_port_addclause( bmcg2_sat_port * pArg, int * plits, int nlits )
+{
+    Gluco2_Port_t * p = (Gluco2_Port_t *)pArg;
+    int k, i, RetValue = 1;
+    for ( k = 0; k < p->nSols; k++ )
+    {
+        SimpSolver * S = p->pSols[k].pSat;
+        S->user_lits.clear();
+        for ( i = 0; i < nlits; i++ )
+        {
+            while ( plits[i] / 2 >= S->nVars() )
+                S->newVar();
+            S->user_lits.push( toLit(plits[i]) );
+        }
+        RetValue &= S->addClause( S->user_lits );
+    }
+    return RetValue; // returns 0 if the problem is UNSAT
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the problem under assumptions.]
+
+  Description [The first solver is run by the calling thread. Returns
+  the result of the solver that found the answer first (1 = SAT,
+  -1 = UNSAT), or 0 if the run was stopped before any solver found it.
+  The model is taken from the solver that found the answer.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Gluco2_PortWorker( void * pArg )
+{
+    Gluco2_PortSol_t * p = (Gluco2_PortSol_t *)pArg;
+    Gluco2_Port_t * pPort = p->pPort;
+    p->Status = p->pSat->solveLimited( pPort->pLits, pPort->nLits, 0 );
+    if ( p->Status != 0 )
+        Abc_AtomicCasInt( &pPort->iWinner, -1, p->iSol );
+    // the solver returned because of the answer, a limit or a stop request
+    Abc_AtomicStoreInt( &pPort->Stop, 1 );
+    return NULL;
+}
+int bmcg2_sat_port_solve( bmcg2_sat_port * pArg, int * plits, int nlits )
+{
+    Gluco2_Port_t * p = (Gluco2_Port_t *)pArg;
+    Abc_Task_t ** pTasks = ABC_CALLOC( Abc_Task_t *, p->nSols );
+    int k;
+    p->pLits   = plits;
+    p->nLits   = nlits;
+    p->Stop    = 0;
+    p->iWinner = -1;
+    for ( k = 1; k < p->nSols; k++ )
+        pTasks[k] = Abc_TaskStartBackground( p->pPool, Gluco2_PortWorker, p->pSols + k );
+    Gluco2_PortWorker( p->pSols );
+    for ( k = 1; k < p->nSols; k++ )
+    {
+        Abc_TaskWait( pTasks[k] );
+        Abc_TaskFree( pTasks[k] );
+    }
+    ABC_FREE( pTasks );
+    if ( p->iWinner == -1 )
+        return 0;
+    p->pSols[p->iWinner].nWins++;
+    return p->pSols[p->iWinner].Status;
+}
+int bmcg2_sat_port_read_cex_varvalue( bmcg2_sat_port * pArg, int ivar )
+{
+    Gluco2_Port_t * p = (Gluco2_Port_t *)pArg;
+    assert( p->iWinner >= 0 && p->pSols[p->iWinner].Status == 1 );
+    return p->pSols[p->iWinner].pSat->model[ivar] == l_True;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sets the resource limits and the stop callback.]
+
+  Description [The conflict limit applies to each solver separately.
+  The runtime limit is the deadline in terms of Abc_Clock() of the calling
+  thread, so it is checked by the first solver only, which runs in this
+  thread; when this solver returns, it stops the others. The same holds
+  for the stop callback.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+abctime bmcg2_sat_port_set_runtime_limit( bmcg2_sat_port * pArg, abctime Limit )
+{
+    Gluco2_Port_t * p = (Gluco2_Port_t *)pArg;
+    abctime nRuntimeLimit = p->pSols[0].pSat->nRuntimeLimit;
+    p->pSols[0].pSat->nRuntimeLimit = Limit;
+    return nRuntimeLimit;
+}
+void bmcg2_sat_port_set_conflict_budget( bmcg2_sat_port * pArg, int Limit )
+{
+    Gluco2_Port_t * p = (Gluco2_Port_t *)pArg;
+    int k;
+    for ( k = 0; k < p->nSols; k++ )
+        if ( Limit > 0 )
+            p->pSols[k].pSat->setConfBudget( (int64_t)Limit );
+        else
+            p->pSols[k].pSat->budgetOff();
+}
+void bmcg2_sat_port_set_runid( bmcg2_sat_port * pArg, int RunId )
+{
+    ((Gluco2_Port_t *)pArg)->pSols[0].pSat->RunId = RunId;
+}
+void bmcg2_sat_port_set_stop_func( bmcg2_sat_port * pArg, int (*fnct)(int) )
+{
+    ((Gluco2_Port_t *)pArg)->pSols[0].pSat->pFuncStop = fnct;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the statistics.]
+
+  Description [The numbers of conflicts and learned clauses are added
+  over all solvers.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int bmcg2_sat_port_solvernum( bmcg2_sat_port * pArg )
+{
+    return ((Gluco2_Port_t *)pArg)->nSols;
+}
+int bmcg2_sat_port_varnum( bmcg2_sat_port * pArg )
+{
+    return ((Gluco2_Port_t *)pArg)->pSols[0].pSat->nVars();
+}
+int bmcg2_sat_port_clausenum( bmcg2_sat_port * pArg )
+{
+    return ((Gluco2_Port_t *)pArg)->pSols[0].pSat->nClauses();
+}
+int bmcg2_sat_port_learntnum( bmcg2_sat_port * pArg )
+{
+    Gluco2_Port_t * p = (Gluco2_Port_t *)pArg;
+    int k, Count = 0;
+    for ( k = 0; k < p->nSols; k++ )
+        Count += p->pSols[k].pSat->nLearnts();
+    return Count;
+}
+int bmcg2_sat_port_conflictnum( bmcg2_sat_port * pArg )
+{
+    Gluco2_Port_t * p = (Gluco2_Port_t *)pArg;
+    int k, Count = 0;
+    for ( k = 0; k < p->nSols; k++ )
+        Count += (int)p->pSols[k].pSat->conflicts;
+    return Count;
+}
+void bmcg2_sat_port_print_stats( bmcg2_sat_port * pArg )
+{
+    Gluco2_Port_t * p = (Gluco2_Port_t *)pArg;
+    int k;
+    for ( k = 0; k < p->nSols; k++ )
+    {
+        Gluco2_PortSol_t * pSol = p->pSols + k;
+        printf( "Solver %2d : Wins = %5d. Conf = %9d. Learn = %8d. Export = %8d. Import = %8d. Skip = %6d.\n",
+            k, pSol->nWins, (int)pSol->pSat->conflicts, pSol->pSat->nLearnts(),
+            (int)pSol->nExported, (int)pSol->nImported, (int)pSol->nSkipped );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the CNF using the portfolio.]
+
+  Description [Returns the model in vModel if the problem is SAT.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Glucose2_SolveCnfPort( Cnf_Dat_t * pCnf, Glucose2_Pars * pPars, Vec_Int_t * vModel )
+{
+    bmcg2_sat_port * p = bmcg2_sat_port_start( pPars->nThreads );
+    int i, status = 1;
+    while ( bmcg2_sat_port_varnum(p) < pCnf->nVars )
+        bmcg2_sat_port_addvar( p );
+    for ( i = 0; i < pCnf->nClauses && status; i++ )
+        status = bmcg2_sat_port_addclause( p, pCnf->pClauses[i], pCnf->pClauses[i+1]-pCnf->pClauses[i] );
+    if ( status )
+    {
+        bmcg2_sat_port_set_conflict_budget( p, pPars->nConfls );
+        status = bmcg2_sat_port_solve( p, NULL, 0 );
+    }
+    else
+        status = -1;
+    if ( status == 1 && vModel )
+    {
+        Vec_IntClear( vModel );
+        for ( i = 0; i < pCnf->nVars; i++ )
+            Vec_IntPush( vModel, bmcg2_sat_port_read_cex_varvalue(p, i) );
+    }
+    if ( pPars->verb )
+        bmcg2_sat_port_print_stats( p );
+    bmcg2_sat_port_stop( p );
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,72 @@
+/**CFile****************************************************************
+
+  FileName    [AbcGlucosePort2.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT solver Glucose 3.0 by Gilles Audemard and Laurent Simon.]
+
+  Synopsis    [Portfolio of Glucose solvers sharing learned clauses.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - September 6, 2017.]
+
+  Revision    [$Id: AbcGlucosePort2.h,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#ifndef ABC_SAT_GLUCOSE_PORT2_H_
+#define ABC_SAT_GLUCOSE_PORT2_H_
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+#include "misc/util/abc_global.h"
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the interface follows bmcg2_sat_solver; the declarations are kept apart
+// from AbcGlucose2.h, so that they can be used together with AbcGlucose.h
+
+typedef void bmcg2_sat_port;
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+extern bmcg2_sat_port *  bmcg2_sat_port_start( int nSols );
+extern void              bmcg2_sat_port_stop( bmcg2_sat_port * p );
+extern int               bmcg2_sat_port_addvar( bmcg2_sat_port * p );
+extern int               bmcg2_sat_port_addclause( bmcg2_sat_port * p, int * plits, int nlits );
+extern int               bmcg2_sat_port_solve( bmcg2_sat_port * p, int * plits, int nlits );
+extern int               bmcg2_sat_port_read_cex_varvalue( bmcg2_sat_port * p, int ivar );
+extern abctime           bmcg2_sat_port_set_runtime_limit( bmcg2_sat_port * p, abctime Limit );
+extern void              bmcg2_sat_port_set_conflict_budget( bmcg2_sat_port * p, int Limit );
+extern void              bmcg2_sat_port_set_runid( bmcg2_sat_port * p, int RunId );
+extern void              bmcg2_sat_port_set_stop_func( bmcg2_sat_port * p, int (*fnct)(int) );
+extern int               bmcg2_sat_port_solvernum( bmcg2_sat_port * p );
+extern int               bmcg2_sat_port_varnum( bmcg2_sat_port * p );
+extern int               bmcg2_sat_port_clausenum( bmcg2_sat_port * p );
+extern int               bmcg2_sat_port_learntnum( bmcg2_sat_port * p );
+extern int               bmcg2_sat_port_conflictnum( bmcg2_sat_port * p );
+extern void              bmcg2_sat_port_print_stats( bmcg2_sat_port * p );
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
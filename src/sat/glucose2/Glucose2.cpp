@@ -98,6 +98,13 @@ Solver::Solver() :
     , terminate_search_early(false)
     , pstop(NULL)
     , nRuntimeLimit(0)
+    , RunId(0)
+    , pFuncStop(NULL)
+    , pShareMan(NULL)
+    , pShareExport(NULL)
+    , pShareImport(NULL)
+    , nShareLbd(2)
+    , nShareSize(16)
 
     , verbosity      (0)
     , verbEveryConflicts(10000)
@@ -329,6 +336,34 @@ bool Solver::addClause_(vec<Lit>& ps)
     return true;
 }
 
+// adds a clause learned by another solver of the portfolio; the clause is
+// implied by the same set of original clauses, so it is added as learned
+bool Solver::addSharedClause(const Lit * pLits, int nLits, int lbd)
+{
+    assert(decisionLevel() == 0);
+    if (!ok) return false;
+    add_tmp.clear();
+    for (int i = 0; i < nLits; i++){
+        if (var(pLits[i]) >= nVars() || value(pLits[i]) == l_True)
+            return true;
+        if (value(pLits[i]) != l_False)
+            add_tmp.push(pLits[i]);
+    }
+    if (add_tmp.size() == 0)
+        return ok = false;
+    if (add_tmp.size() == 1){
+        uncheckedEnqueue(add_tmp[0]);
+        return ok = (propagate() == CRef_Undef);
+    }
+    CRef cr = ca.alloc(add_tmp, true);
+    ca[cr].setLBD(Abc_MinInt(lbd, add_tmp.size()));
+    ca[cr].setSizeWithoutSelectors(add_tmp.size());
+    learnts.push(cr);
+    attachClause(cr);
+    claBumpActivity(ca[cr]);
+    return true;
+}
+
 
 void Solver::attachClause(CRef cr) {
     const Clause& c = ca[cr];
@@ -1256,6 +1291,9 @@ lbool Solver::search(int nof_conflicts)
               fprintf(certifiedOutput, "0\n");
             }
 
+            if (pShareExport && (int)nblevels <= nShareLbd && learnt_clause.size() <= nShareSize)
+                pShareExport(pShareMan, (const Lit *)learnt_clause, learnt_clause.size(), nblevels);
+
             if (learnt_clause.size() == 1){
               uncheckedEnqueue(learnt_clause[0]);nbUn++;
             }else{
@@ -1282,10 +1320,17 @@ lbool Solver::search(int nof_conflicts)
                 if(incremental) { // DO NOT BACKTRACK UNTIL 0.. USELESS
                     bt = (decisionLevel()<assumptions.size()) ? decisionLevel() : assumptions.size();
                 }
+                // the shared clauses are imported at level 0
+                if (pShareImport && pShareImport(pShareMan, this, 1))
+                    bt = 0;
                 cancelUntil(bt);
                 return l_Undef; 
             }
 
+            // Add the clauses learned by other solvers:
+            if (decisionLevel() == 0 && pShareImport && !pShareImport(pShareMan, this, 0)) {
+                return l_False;
+            }
             // Simplify the set of problem clauses:
             if (decisionLevel() == 0 && !simplify()) {
                 return l_False;
@@ -1436,6 +1481,7 @@ printf("c ==================================[ Search Statistics (every %6d confl
       status = search(0); // the parameter is useless in glucose, kept to allow modifications
         if (!withinBudget() || terminate_search_early || (pstop && *pstop)) break;
         if (nRuntimeLimit && Abc_Clock() > nRuntimeLimit)                   break;
+        if (pFuncStop && pFuncStop(RunId))                                  break;
         curr_restarts++;
     }
 
@@ -63,6 +63,16 @@ public:
     bool terminate_search_early;         // used to stop the solver early if it as instructed by an external caller
     int * pstop;                         // another callback
     uint64_t nRuntimeLimit;              // runtime limit
+    int RunId;                           // the ID of the current run
+    int(*pFuncStop)(int);                // callback to terminate
+
+    // clause sharing in the portfolio (see AbcGlucosePort2.cpp)
+    void * pShareMan;                    // the solver's entry in the portfolio
+    void(*pShareExport)(void * p, const Lit * pLits, int nLits, int lbd); // called for each short learned clause
+    int(*pShareImport)(void * p, Solver * S, int fCheck); // adds the clauses of other solvers at level 0 (or checks if there are any)
+    int nShareLbd;                       // the largest LBD of exported clauses
+    int nShareSize;                      // the largest size of exported clauses
+    bool    addSharedClause(const Lit * pLits, int nLits, int lbd); // adds a clause learned by another solver
     vec<int> user_vec;
     vec<Lit> user_lits;
 
@@ -0,0 +1,657 @@
+//===--- drat.c -------------------------------------------------------------===
+//
+//                     satoko: Satisfiability solver
+//
+// This file is distributed under the BSD 2-Clause License.
+// See LICENSE for details.
+//
+//===------------------------------------------------------------------------===
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+
+#include "drat.h"
+#include "satoko.h"
+#include "solver.h"
+#include "utils/mem.h"
+#include "utils/vec/vec_char.h"
+#include "utils/vec/vec_uint.h"
+#include "misc/util/utilPool.h"
+
+#include "misc/util/abc_global.h"
+ABC_NAMESPACE_IMPL_START
+
+#define DRAT_BUF_SIZE (1 << 20)
+
+struct drat_buf {
+    char *data;
+    unsigned size;
+    unsigned cap;
+};
+
+struct drat_t_ {
+    FILE *file;
+    int binary;
+    int error;
+    struct drat_buf bufs[2];
+    struct drat_buf *cur;     /* Buffer filled by the solver */
+    struct drat_buf *pending; /* Buffer written by the writer thread */
+    Abc_Pool_t *pool;
+    Abc_Task_t *task;
+    /* Statistics */
+    long n_added;
+    long n_deleted;
+    long n_bytes;
+    abctime time_wait; /* Time the solver spent waiting for the writer */
+};
+
+//===------------------------------------------------------------------------===
+// Proof writer
+//===------------------------------------------------------------------------===
+static void *drat_write_task(void *arg)
+{
+    drat_t *p = (drat_t *)arg;
+    size_t n_written = fwrite(p->pending->data, 1, p->pending->size, p->file);
+    return (void *)(size_t)(n_written == p->pending->size ? 1 : 2);
+}
+
+static void drat_wait(drat_t *p)
+{
+    abctime clk;
+    if (p->task == NULL)
+        return;
+    clk = Abc_ClockWall();
+    if (Abc_TaskWait(p->task) != (void *)1)
+        p->error = 1;
+    Abc_TaskFree(p->task);
+    p->task = NULL;
+    p->time_wait += Abc_ClockWall() - clk;
+}
+
+/** Hands the current buffer over to the writer thread.
+ *
+ * The previous write has to be finished before, because its buffer becomes
+ * the current one.
+ */
+static void drat_flush(drat_t *p)
+{
+    drat_wait(p);
+    if (p->cur->size == 0)
+        return;
+    p->pending = p->cur;
+    p->cur = (p->cur == p->bufs) ? p->bufs + 1 : p->bufs;
+    p->cur->size = 0;
+    p->task = Abc_TaskStartBackground(p->pool, drat_write_task, p);
+}
+
+static inline void drat_reserve(drat_t *p, unsigned n_bytes)
+{
+    if (p->cur->size + n_bytes <= p->cur->cap)
+        return;
+    drat_flush(p);
+    if (n_bytes > p->cur->cap) {
+        p->cur->cap = n_bytes;
+        p->cur->data = satoko_realloc(char, p->cur->data, p->cur->cap);
+    }
+}
+
+static inline char *drat_put_binary(char *pos, unsigned lit)
+{
+    unsigned code = lit + 2;
+    while (code > 127) {
+        *pos++ = (char)(128 | (code & 127));
+        code >>= 7;
+    }
+    *pos++ = (char)code;
+    return pos;
+}
+
+static inline char *drat_put_text(char *pos, unsigned lit)
+{
+    char digits[12];
+    unsigned var = lit2var(lit) + 1;
+    unsigned n = 0;
+    if (lit_polarity(lit))
+        *pos++ = '-';
+    do {
+        digits[n++] = (char)('0' + var % 10);
+        var /= 10;
+    } while (var);
+    while (n)
+        *pos++ = digits[--n];
+    *pos++ = ' ';
+    return pos;
+}
+
+static void drat_write(drat_t *p, char tag, const unsigned *lits, unsigned size)
+{
+    char *pos;
+    unsigned i;
+
+    drat_reserve(p, 4 + 12 * size);
+    pos = p->cur->data + p->cur->size;
+    if (p->binary) {
+        *pos++ = tag;
+        for (i = 0; i < size; i++)
+            pos = drat_put_binary(pos, lits[i]);
+        *pos++ = 0;
+    } else {
+        if (tag == 'd') {
+            *pos++ = 'd';
+            *pos++ = ' ';
+        }
+        for (i = 0; i < size; i++)
+            pos = drat_put_text(pos, lits[i]);
+        *pos++ = '0';
+        *pos++ = '\n';
+    }
+    p->n_bytes += (pos - p->cur->data) - p->cur->size;
+    p->cur->size = (unsigned)(pos - p->cur->data);
+}
+
+drat_t *drat_start(const char *fname, int binary)
+{
+    drat_t *p;
+    FILE *file = fopen(fname, "wb");
+    unsigned i;
+
+    if (file == NULL)
+        return NULL;
+    p = satoko_calloc(drat_t, 1);
+    p->file = file;
+    p->binary = binary;
+    for (i = 0; i < 2; i++) {
+        p->bufs[i].cap = DRAT_BUF_SIZE;
+        p->bufs[i].data = satoko_alloc(char, p->bufs[i].cap);
+    }
+    p->cur = p->bufs;
+    p->pool = Abc_PoolStart(1);
+    return p;
+}
+
+/** Writes the rest of the proof and closes the file.
+ *
+ * Returns 0 if the proof could not be written completely.
+ */
+int drat_stop(drat_t *p, int verbose)
+{
+    int status;
+
+    drat_flush(p);
+    drat_wait(p);
+    Abc_PoolStop(p->pool);
+    status = (fclose(p->file) == 0) && !p->error;
+    if (verbose) {
+        printf("Proof: lemmas = %ld. deletions = %ld. written = %.2f MB. ",
+               p->n_added, p->n_deleted, 1.0 * p->n_bytes / (1 << 20));
+        printf("waiting = %.2f sec\n", 1.0 * p->time_wait / CLOCKS_PER_SEC);
+    }
+    satoko_free(p->bufs[0].data);
+    satoko_free(p->bufs[1].data);
+    satoko_free(p);
+    return status;
+}
+
+void drat_add(drat_t *p, const unsigned *lits, unsigned size)
+{
+    p->n_added++;
+    drat_write(p, 'a', lits, size);
+}
+
+void drat_delete(drat_t *p, const unsigned *lits, unsigned size)
+{
+    p->n_deleted++;
+    drat_write(p, 'd', lits, size);
+}
+
+//===------------------------------------------------------------------------===
+// Proof checker
+//===------------------------------------------------------------------------===
+/* The checker replays the proof forward on top of a solver instance, which
+ * provides the clause database, the watches and unit propagation. A lemma
+ * is accepted if it has the RUP property, or else the RAT property on its
+ * first literal. Deleted clauses are looked up in a hash table of clause
+ * references. As in drat-trim, deletions of unit clauses are ignored, and
+ * top-level assignments survive the deletion of their reasons. */
+typedef struct checker_t_ checker_t;
+struct checker_t_ {
+    solver_t *s;
+    vec_uint_t **buckets;
+    unsigned n_buckets;
+    unsigned n_entries;
+    vec_char_t *lit_marks;
+    vec_uint_t *lits;
+    vec_uint_t *temp;
+    int unsat;
+    long n_lemmas;
+    long n_rat;
+    long n_deleted;
+    long n_missing;
+};
+
+static checker_t *checker_start(void)
+{
+    checker_t *c = satoko_calloc(checker_t, 1);
+    unsigned i;
+    c->s = satoko_create();
+    c->n_buckets = 1 << 16;
+    c->buckets = satoko_alloc(vec_uint_t *, c->n_buckets);
+    for (i = 0; i < c->n_buckets; i++)
+        c->buckets[i] = vec_uint_alloc(0);
+    c->lit_marks = vec_char_alloc(0);
+    c->lits = vec_uint_alloc(0);
+    c->temp = vec_uint_alloc(0);
+    return c;
+}
+
+static void checker_stop(checker_t *c)
+{
+    unsigned i;
+    for (i = 0; i < c->n_buckets; i++)
+        vec_uint_free(c->buckets[i]);
+    satoko_free(c->buckets);
+    vec_char_free(c->lit_marks);
+    vec_uint_free(c->lits);
+    vec_uint_free(c->temp);
+    satoko_destroy(c->s);
+    satoko_free(c);
+}
+
+static inline void checker_reserve_var(checker_t *c, unsigned var)
+{
+    while (var >= (unsigned)satoko_varnum(c->s)) {
+        satoko_add_variable(c->s, 0);
+        vec_char_push_back(c->lit_marks, 0);
+        vec_char_push_back(c->lit_marks, 0);
+    }
+}
+
+/** Removes duplicate literals while keeping the order of the rest.
+ *
+ * Returns 0 if the clause is a tautology.
+ */
+static int checker_normalize(checker_t *c, vec_uint_t *lits)
+{
+    unsigned i, j = 0, lit;
+    int status = 1;
+    vec_uint_foreach(lits, lit, i) {
+        if (vec_char_at(c->lit_marks, lit_compl(lit)))
+            status = 0;
+        if (vec_char_at(c->lit_marks, lit))
+            continue;
+        vec_char_assign(c->lit_marks, lit, 1);
+        vec_uint_assign(lits, j++, lit);
+    }
+    vec_uint_shrink(lits, j);
+    vec_uint_foreach(lits, lit, i)
+        vec_char_assign(c->lit_marks, lit, 0);
+    return status;
+}
+
+/** Hash of the literal set (independent of the literal order) */
+static inline unsigned checker_hash(const unsigned *lits, unsigned size)
+{
+    unsigned i, sum = 0, prod = 1, mix = 0;
+    for (i = 0; i < size; i++) {
+        sum += lits[i];
+        prod *= lits[i] + 1;
+        mix ^= lits[i];
+    }
+    return (1023 * sum + prod) ^ (31 * mix);
+}
+
+static inline vec_uint_t *checker_bucket(checker_t *c, struct clause *clause)
+{
+    unsigned hash = checker_hash(&(clause->data[0].lit), clause->size);
+    return c->buckets[hash & (c->n_buckets - 1)];
+}
+
+static void checker_rehash(checker_t *c)
+{
+    vec_uint_t **buckets = c->buckets;
+    unsigned n_buckets = c->n_buckets;
+    unsigned i, j, cref;
+
+    c->n_buckets *= 2;
+    c->buckets = satoko_alloc(vec_uint_t *, c->n_buckets);
+    for (i = 0; i < c->n_buckets; i++)
+        c->buckets[i] = vec_uint_alloc(0);
+    for (i = 0; i < n_buckets; i++) {
+        vec_uint_foreach(buckets[i], cref, j)
+            vec_uint_push_back(checker_bucket(c, clause_fetch(c->s, cref)), cref);
+        vec_uint_free(buckets[i]);
+    }
+    satoko_free(buckets);
+}
+
+static void checker_insert(checker_t *c, unsigned cref)
+{
+    if (c->n_entries >= 2 * c->n_buckets)
+        checker_rehash(c);
+    vec_uint_push_back(checker_bucket(c, clause_fetch(c->s, cref)), cref);
+    c->n_entries++;
+}
+
+static unsigned checker_remove(checker_t *c, vec_uint_t *lits)
+{
+    unsigned hash = checker_hash(vec_uint_data(lits), vec_uint_size(lits));
+    vec_uint_t *bucket = c->buckets[hash & (c->n_buckets - 1)];
+    unsigned i, j, lit, cref, found = UNDEF;
+
+    vec_uint_foreach(lits, lit, i)
+        vec_char_assign(c->lit_marks, lit, 1);
+    vec_uint_foreach(bucket, cref, i) {
+        struct clause *clause = clause_fetch(c->s, cref);
+        if (clause->size != vec_uint_size(lits))
+            continue;
+        for (j = 0; j < clause->size; j++)
+            if (!vec_char_at(c->lit_marks, clause->data[j].lit))
+                break;
+        if (j < clause->size)
+            continue;
+        found = cref;
+        vec_uint_assign(bucket, i, vec_uint_at(bucket, vec_uint_size(bucket) - 1));
+        vec_uint_shrink(bucket, vec_uint_size(bucket) - 1);
+        c->n_entries--;
+        break;
+    }
+    vec_uint_foreach(lits, lit, i)
+        vec_char_assign(c->lit_marks, lit, 0);
+    return found;
+}
+
+/** Checks whether propagating the negation of the clause fails. */
+static int checker_rup(checker_t *c, const unsigned *lits, unsigned size)
+{
+    solver_t *s = c->s;
+    unsigned i;
+    int status = 0;
+
+    assert(solver_dlevel(s) == 0);
+    vec_uint_push_back(s->trail_lim, vec_uint_size(s->trail));
+    for (i = 0; i < size; i++) {
+        if (lit_value(s, lits[i]) == SATOKO_LIT_TRUE) {
+            status = 1;
+            break;
+        }
+        if (var_value(s, lit2var(lits[i])) == SATOKO_VAR_UNASSING)
+            solver_enqueue(s, lit_compl(lits[i]), UNDEF);
+    }
+    if (!status)
+        status = (solver_propagate(s) != UNDEF);
+    solver_cancel_until(s, 0);
+    return status;
+}
+
+/** Checks that all resolvents on the first literal have the RUP property. */
+static int checker_rat(checker_t *c, vec_uint_t *lits)
+{
+    solver_t *s = c->s;
+    unsigned pivot, cref, i, j;
+
+    if (vec_uint_size(lits) == 0)
+        return 0;
+    pivot = vec_uint_at(lits, 0);
+    if (lit_value(s, pivot) == SATOKO_LIT_FALSE)
+        return 0;
+    vec_uint_foreach(s->originals, cref, i) {
+        struct clause *clause = clause_fetch(s, cref);
+        if (clause->f_mark)
+            continue;
+        for (j = 0; j < clause->size; j++)
+            if (clause->data[j].lit == lit_compl(pivot))
+                break;
+        if (j == clause->size)
+            continue;
+        vec_uint_clear(c->temp);
+        for (j = 1; j < vec_uint_size(lits); j++)
+            vec_uint_push_back(c->temp, vec_uint_at(lits, j));
+        for (j = 0; j < clause->size; j++)
+            if (clause->data[j].lit != lit_compl(pivot))
+                vec_uint_push_back(c->temp, clause->data[j].lit);
+        if (!checker_rup(c, vec_uint_data(c->temp), vec_uint_size(c->temp)))
+            return 0;
+    }
+    return 1;
+}
+
+/** Returns 0 for true literals, 1 for unassigned ones and 2 for false ones. */
+static inline int checker_lit_rank(solver_t *s, unsigned lit)
+{
+    if (var_value(s, lit2var(lit)) == SATOKO_VAR_UNASSING)
+        return 1;
+    return lit_value(s, lit) == SATOKO_LIT_TRUE ? 0 : 2;
+}
+
+/** Adds the clause and propagates its consequences at the top level. */
+static void checker_add(checker_t *c, vec_uint_t *lits)
+{
+    solver_t *s = c->s;
+    unsigned i, lit, cref;
+    int rank;
+
+    if (c->unsat)
+        return;
+    /* Watch the true literals first, then the unassigned ones */
+    vec_uint_clear(c->temp);
+    for (rank = 0; rank < 3; rank++)
+        vec_uint_foreach(lits, lit, i)
+            if (checker_lit_rank(s, lit) == rank)
+                vec_uint_push_back(c->temp, lit);
+    assert(vec_uint_size(c->temp) == vec_uint_size(lits));
+    if (vec_uint_size(c->temp) == 0) {
+        c->unsat = 1;
+        return;
+    }
+    lit = vec_uint_at(c->temp, 0);
+    cref = UNDEF;
+    if (vec_uint_size(c->temp) > 1) {
+        cref = solver_clause_create(s, c->temp, 0);
+        clause_watch(s, cref);
+        checker_insert(c, cref);
+        if (lit_value(s, vec_uint_at(c->temp, 1)) != SATOKO_LIT_FALSE)
+            return;
+    }
+    if (lit_value(s, lit) == SATOKO_LIT_FALSE)
+        c->unsat = 1;
+    else if (var_value(s, lit2var(lit)) == SATOKO_VAR_UNASSING) {
+        solver_enqueue(s, lit, cref);
+        if (solver_propagate(s) != UNDEF)
+            c->unsat = 1;
+    }
+}
+
+/** Processes one proof step. Returns 0 if the lemma cannot be verified. */
+static int checker_step(checker_t *c, int is_delete)
+{
+    unsigned cref;
+
+    if (!checker_normalize(c, c->lits))
+        return 1;
+    if (is_delete) {
+        if (vec_uint_size(c->lits) < 2)
+            return 1;
+        cref = checker_remove(c, c->lits);
+        if (cref == UNDEF) {
+            c->n_missing++;
+            return 1;
+        }
+        clause_unwatch(c->s, cref);
+        clause_fetch(c->s, cref)->f_mark = 1;
+        c->n_deleted++;
+        return 1;
+    }
+    c->n_lemmas++;
+    if (!checker_rup(c, vec_uint_data(c->lits), vec_uint_size(c->lits))) {
+        if (!checker_rat(c, c->lits))
+            return 0;
+        c->n_rat++;
+    }
+    checker_add(c, c->lits);
+    return 1;
+}
+
+static inline void checker_push_dimacs(checker_t *c, int dimacs)
+{
+    unsigned var = (unsigned)(dimacs > 0 ? dimacs : -dimacs) - 1;
+    checker_reserve_var(c, var);
+    vec_uint_push_back(c->lits, var2lit(var, dimacs < 0));
+}
+
+static inline void checker_skip_line(char **pos, char *end)
+{
+    while (*pos < end && **pos != '\n')
+        (*pos)++;
+}
+
+/** Reads the next integer. Returns 0 at the end of the input or on error. */
+static int checker_read_int(char **pos, char *end, int *value)
+{
+    int sign = 1;
+    *value = 0;
+    while (*pos < end && (**pos == ' ' || **pos == '\t' || **pos == '\r' || **pos == '\n'))
+        (*pos)++;
+    if (*pos < end && **pos == '-') {
+        sign = -1;
+        (*pos)++;
+    }
+    if (*pos == end || **pos < '0' || **pos > '9')
+        return 0;
+    while (*pos < end && **pos >= '0' && **pos <= '9')
+        *value = *value * 10 + (*(*pos)++ - '0');
+    *value *= sign;
+    return 1;
+}
+
+static int checker_read_cnf(checker_t *c, char *pos, char *end)
+{
+    int dimacs;
+    while (pos < end) {
+        while (pos < end && (*pos == ' ' || *pos == '\t' || *pos == '\r' || *pos == '\n'))
+            pos++;
+        if (pos == end)
+            break;
+        if (*pos == 'c' || *pos == 'p') {
+            checker_skip_line(&pos, end);
+            continue;
+        }
+        if (!checker_read_int(&pos, end, &dimacs))
+            return 0;
+        if (dimacs) {
+            checker_push_dimacs(c, dimacs);
+            continue;
+        }
+        if (checker_normalize(c, c->lits))
+            checker_add(c, c->lits);
+        vec_uint_clear(c->lits);
+    }
+    return vec_uint_size(c->lits) == 0;
+}
+
+/** Replays the proof. Returns -1 on parse errors, 0 if a lemma fails. */
+static int checker_read_proof(checker_t *c, char *pos, char *end, int verbose)
+{
+    int binary = (memchr(pos, 0, (size_t)(end - pos)) != NULL);
+    int is_delete, dimacs;
+    unsigned code, shift;
+
+    while (pos < end && !c->unsat) {
+        vec_uint_clear(c->lits);
+        if (binary) {
+            if (*pos != 'a' && *pos != 'd')
+                return -1;
+            is_delete = (*pos++ == 'd');
+            while (1) {
+                code = 0;
+                shift = 0;
+                do {
+                    if (pos == end || shift > 28)
+                        return -1;
+                    code |= (unsigned)(*pos & 127) << shift;
+                    shift += 7;
+                } while (*pos++ & 128);
+                if (code == 0)
+                    break;
+                if (code < 2)
+                    return -1;
+                checker_push_dimacs(c, (code & 1) ? -(int)(code >> 1) : (int)(code >> 1));
+            }
+        } else {
+            while (pos < end && (*pos == ' ' || *pos == '\t' || *pos == '\r' || *pos == '\n'))
+                pos++;
+            if (pos == end)
+                break;
+            if (*pos == 'c') {
+                checker_skip_line(&pos, end);
+                continue;
+            }
+            is_delete = (*pos == 'd');
+            if (is_delete)
+                pos++;
+            while (1) {
+                if (!checker_read_int(&pos, end, &dimacs))
+                    return -1;
+                if (dimacs == 0)
+                    break;
+                checker_push_dimacs(c, dimacs);
+            }
+        }
+        if (!checker_step(c, is_delete)) {
+            if (verbose)
+                printf("Lemma %ld has neither the RUP nor the RAT property.\n", c->n_lemmas);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+int satoko_drat_check(char *fname_cnf, char *fname_proof, int verbose)
+{
+    abctime clk = Abc_Clock();
+    checker_t *c;
+    char *cnf, *proof;
+    iword n_cnf, n_proof;
+    FILE *file;
+    int status;
+
+    cnf = Abc_FileMap(fname_cnf, &n_cnf);
+    if (cnf == NULL) {
+        printf("Cannot read CNF file \"%s\".\n", fname_cnf);
+        return -1;
+    }
+    proof = Abc_FileMap(fname_proof, &n_proof);
+    if (proof == NULL) {
+        /* An empty file is a valid proof if the CNF fails propagation */
+        if ((file = fopen(fname_proof, "rb")) == NULL) {
+            printf("Cannot read proof file \"%s\".\n", fname_proof);
+            Abc_FileUnmap(cnf, n_cnf);
+            return -1;
+        }
+        fclose(file);
+    }
+    c = checker_start();
+    status = checker_read_cnf(c, cnf, cnf + n_cnf) ? 1 : -1;
+    if (status == -1)
+        printf("Cannot parse CNF file \"%s\".\n", fname_cnf);
+    else if (proof && !c->unsat) {
+        status = checker_read_proof(c, proof, proof + n_proof, verbose);
+        if (status == -1)
+            printf("Cannot parse proof file \"%s\" (lemma %ld).\n", fname_proof, c->n_lemmas + 1);
+    }
+    if (status == 1 && !c->unsat) {
+        if (verbose)
+            printf("The proof does not derive the empty clause.\n");
+        status = 0;
+    }
+    if (verbose) {
+        printf("Checked %ld lemmas (%ld RAT) and %ld deletions (%ld ignored).  ",
+               c->n_lemmas, c->n_rat, c->n_deleted, c->n_missing);
+        Abc_PrintTime(1, "Time", Abc_Clock() - clk);
+    }
+    checker_stop(c);
+    Abc_FileUnmap(proof, n_proof);
+    Abc_FileUnmap(cnf, n_cnf);
+    return status;
+}
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,33 @@
+//===--- drat.h -------------------------------------------------------------===
+//
+//                     satoko: Satisfiability solver
+//
+// This file is distributed under the BSD 2-Clause License.
+// See LICENSE for details.
+//
+//===------------------------------------------------------------------------===
+#ifndef satoko__drat_h
+#define satoko__drat_h
+
+#include "misc/util/abc_global.h"
+ABC_NAMESPACE_HEADER_START
+
+/* DRAT proof writer.
+ *
+ * Lemmas and deletions are encoded into a memory buffer. When the buffer is
+ * full, it is handed over to a writer thread and the solver continues with
+ * the second buffer, so it only waits for the disk if it produces the proof
+ * faster than the disk can take it. Both the binary and the text format read
+ * by drat-trim are supported. Literals use the solver encoding (2 * var +
+ * sign) and are written as DIMACS literals (var + 1).
+ */
+typedef struct drat_t_ drat_t;
+
+//===------------------------------------------------------------------------===
+extern drat_t *drat_start(const char *, int);
+extern int drat_stop(drat_t *, int);
+extern void drat_add(drat_t *, const unsigned *, unsigned);
+extern void drat_delete(drat_t *, const unsigned *, unsigned);
+
+ABC_NAMESPACE_HEADER_END
+#endif /* satoko__drat_h */
@@ -129,6 +129,21 @@ extern int satoko_final_conflict(satoko_t *, int **);
  *   file will not be a DIMACS. (value 1 will use 0 as ID).
  */
 extern void satoko_write_dimacs(satoko_t *, char *, int, int);
+
+/* Procedures for DRAT proof logging.
+ * - The proof has to be started before the first clause is added. It covers
+ *   the clauses given to the solver; learnt clauses, their deletions and the
+ *   empty clause are written as the solver derives them. Refutations under
+ *   assumptions and rollbacks to a bookmark are not supported.
+ * - The second argument of satoko_proof_start() is the file name and the
+ *   third one selects the binary format (value 1) or the text format.
+ * - satoko_drat_check() checks a proof against a DIMACS file in the way of
+ *   drat-trim (forward RUP and RAT checks) and reads both formats. It returns
+ *   1 if the proof is verified, 0 if not, and -1 if the files cannot be read.
+ */
+extern int satoko_proof_start(satoko_t *, char *, int);
+extern int satoko_proof_stop(satoko_t *);
+extern int satoko_drat_check(char *, char *, int);
 extern satoko_stats_t * satoko_stats(satoko_t *);
 extern satoko_opts_t * satoko_options(satoko_t *);
 
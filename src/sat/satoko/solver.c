@@ -347,6 +347,8 @@ static inline void solver_handle_conflict(solver_t *s, unsigned confl_cref)
 
     vec_uint_clear(s->temp_lits);
     solver_analyze(s, confl_cref, s->temp_lits, &bt_level, &lbd);
+    if (s->proof)
+        drat_add(s->proof, vec_uint_data(s->temp_lits), vec_uint_size(s->temp_lits));
     s->sum_lbd += lbd;
     b_queue_push(s->bq_lbd, lbd);
     solver_cancel_until(s, bt_level);
@@ -456,6 +458,8 @@ static inline void solver_reduce_cdb(solver_t *s)
         if (clause->f_deletable && clause->lbd > 2 && clause->size > 2 && lit_reason(s, clause->data[0].lit) != cref && (i < limit)) {
             clause->f_mark = 1;
             s->stats.n_learnt_lits -= clause->size;
+            if (s->proof)
+                drat_delete(s->proof, &(clause->data[0].lit), clause->size);
             clause_unwatch(s, cref);
             cdb_remove(s->all_clauses, clause);
         } else {
@@ -632,8 +636,11 @@ char solver_search(solver_t *s)
         if (confl_cref != UNDEF) {
             s->stats.n_conflicts++;
             s->stats.n_conflicts_all++;
-            if (solver_dlevel(s) == 0)
+            if (solver_dlevel(s) == 0) {
+                if (s->proof)
+                    drat_add(s->proof, NULL, 0);
                 return SATOKO_UNSAT;
+            }
             /* Restart heuristic */
             b_queue_push(s->bq_trail, vec_uint_size(s->trail));
             if (solver_block_rst(s))
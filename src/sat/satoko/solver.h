@@ -16,6 +16,7 @@
 
 #include "clause.h"
 #include "cdb.h"
+#include "drat.h"
 #include "satoko.h"
 #include "types.h"
 #include "watch_list.h"
@@ -106,6 +107,9 @@ struct solver_t_ {
     int     RunId;           
     int   (*pFuncStop)(int);  
 
+    /* DRAT proof (NULL if the proof is not logged) */
+    drat_t *proof;
+
     struct satoko_stats stats;
     struct satoko_opts opts;
 };
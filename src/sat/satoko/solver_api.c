@@ -131,6 +131,8 @@ solver_t * satoko_create()
 
 void satoko_destroy(solver_t *s)
 {
+    if (s->proof)
+        drat_stop(s->proof, 0);
     vec_uint_free(s->assumptions);
     vec_uint_free(s->final_conflict);
     cdb_free(s->all_clauses);
@@ -205,8 +207,11 @@ int satoko_simplify(solver_t * s)
     unsigned cref;
 
     assert(solver_dlevel(s) == 0);
-    if (solver_propagate(s) != UNDEF)
+    if (solver_propagate(s) != UNDEF) {
+        if (s->proof)
+            drat_add(s->proof, NULL, 0);
         return SATOKO_ERR;
+    }
     if (s->n_assigns_simplify == vec_uint_size(s->trail) || s->n_props_simplify > 0)
         return SATOKO_OK;
 
@@ -216,6 +221,8 @@ int satoko_simplify(solver_t * s)
     if (clause_is_satisfied(s, clause)) {
             clause->f_mark = 1;
             s->stats.n_original_lits -= clause->size;
+            if (s->proof)
+                drat_delete(s->proof, &(clause->data[0].lit), clause->size);
             clause_unwatch(s, cref);
         } else
             vec_uint_assign(s->originals, j++, cref);
@@ -276,12 +283,21 @@ int satoko_add_clause(solver_t *s, int *lits, int size)
         }
     }
 
+    /* The clause was strengthened by the top-level assignments */
+    if (s->proof && vec_uint_size(s->temp_lits) < (unsigned)size) {
+        drat_add(s->proof, vec_uint_data(s->temp_lits), vec_uint_size(s->temp_lits));
+        if (vec_uint_size(s->temp_lits) > 0)
+            drat_delete(s->proof, (unsigned *)lits, (unsigned)size);
+    }
     if (vec_uint_size(s->temp_lits) == 0) {
         s->status = SATOKO_ERR;
         return SATOKO_ERR;
     } if (vec_uint_size(s->temp_lits) == 1) {
         solver_enqueue(s, vec_uint_at(s->temp_lits, 0), UNDEF);
-        return (s->status = (solver_propagate(s) == UNDEF));
+        s->status = (solver_propagate(s) == UNDEF);
+        if (s->status == SATOKO_ERR && s->proof)
+            drat_add(s->proof, NULL, 0);
+        return s->status;
     }
     if ( 0 ) {
         for ( i = 0; i < vec_uint_size(s->temp_lits); i++ ) {
@@ -622,6 +638,29 @@ void satoko_write_dimacs(satoko_t *s, char *fname, int wrt_lrnt, int zero_var)
 
 }
 
+int satoko_proof_start(satoko_t *s, char *fname, int binary)
+{
+    assert(s->proof == NULL);
+    s->proof = drat_start(fname, binary);
+    if (s->proof == NULL) {
+        printf("Error: Cannot open proof file \"%s\".\n", fname);
+        return SATOKO_ERR;
+    }
+    return SATOKO_OK;
+}
+
+int satoko_proof_stop(satoko_t *s)
+{
+    int status;
+    if (s->proof == NULL)
+        return SATOKO_OK;
+    status = drat_stop(s->proof, s->opts.verbose);
+    s->proof = NULL;
+    if (!status)
+        printf("Error: Writing the proof has failed.\n");
+    return status ? SATOKO_OK : SATOKO_ERR;
+}
+
 int satoko_varnum(satoko_t *s)
 {
     return vec_char_size(s->assigns);